@@ -16,29 +16,31 @@
  *
  */
 
+#include <algorithm>
 #include <chrono>
 #include <iostream>
 #include <memory>
-#include <random>
 #include <string>
-#include <thread>
+#include <vector>
 
+#include <cxxopts.hpp>
 #include <grpc/grpc.h>
 #include <grpcpp/channel.h>
 #include <grpcpp/client_context.h>
 #include <grpcpp/create_channel.h>
 #include <grpcpp/security/credentials.h>
-#include <client/Models.grpc.pb.h>
+#include <remote/Models.grpc.pb.h>
 
 using grpc::Channel;
 using grpc::ClientContext;
-using grpc::ClientReader;
 using grpc::ClientReaderWriter;
-using grpc::ClientWriter;
 using grpc::Status;
 using simulation::models::VehicleDefinition;
 using simulation::models::VehicleInput;
+using simulation::models::VehicleInputBatch;
 using simulation::models::VehicleState;
+using simulation::models::VehicleStateBatch;
+using Clock = std::chrono::steady_clock;
 
 
 class RemoteControllerClient {
@@ -48,34 +50,220 @@ public:
 
     }
 
-    bool Create(const simulation::models::VehicleDefinition& def, simulation::models::VehicleState* state) {
+    bool Create(const VehicleDefinition& def, VehicleState* state) {
 
         ClientContext context;
         Status status = stub_->CreateUnit(&context, def, state);
 
         if (!status.ok()) {
-            std::cout << "GetFeature rpc failed." << std::endl;
+            std::cout << "CreateUnit rpc failed: " << status.error_message() << std::endl;
             return false;
         }
 
         return true;
     }
 
+    bool Destroy(const VehicleDefinition& def, VehicleState* state) {
+
+        ClientContext context;
+        Status status = stub_->DestroyUnit(&context, def, state);
+
+        if (!status.ok()) {
+            std::cout << "DestroyUnit rpc failed: " << status.error_message() << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * Sends one input per unary call
+     * @param units Number of units
+     * @param requests Number of inputs to be sent
+     * @param latencies Round trip times of the calls (in us)
+     * @param completed Number of answered inputs
+     * @return Flag to indicate success
+     */
+    bool RunUnary(unsigned int units, unsigned int requests, std::vector<double> &latencies, unsigned int &completed) {
+
+        VehicleInput input;
+        VehicleState state;
+
+        for(unsigned int i = 0; i < requests; ++i) {
+
+            input.set_id(i % units + 1);
+            input.set_pedal(0.5);
+
+            auto t0 = Clock::now();
+
+            ClientContext context;
+            Status status = stub_->SendRequest(&context, input, &state);
+
+            if (!status.ok()) {
+                std::cout << "SendRequest rpc failed: " << status.error_message() << std::endl;
+                return false;
+            }
+
+            latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+            completed++;
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Sends the inputs in batches over one bidirectional stream
+     * @param units Number of units
+     * @param requests Number of inputs to be sent
+     * @param batch Number of inputs per batch
+     * @param latencies Round trip times of the batches (in us)
+     * @param completed Number of answered inputs
+     * @return Flag to indicate success
+     */
+    bool RunStream(unsigned int units, unsigned int requests, unsigned int batch, std::vector<double> &latencies,
+                   unsigned int &completed) {
+
+        ClientContext context;
+        std::unique_ptr<ClientReaderWriter<VehicleInputBatch, VehicleStateBatch>> stream(
+                stub_->StreamRequests(&context));
+
+        VehicleInputBatch inputs;
+        VehicleStateBatch states;
+        bool broken = false;
+
+        for(unsigned int i = 0; i < requests; i += batch) {
+
+            // create batch
+            inputs.clear_inputs();
+            for(unsigned int j = i; j < std::min(requests, i + batch); ++j) {
+                auto input = inputs.add_inputs();
+                input->set_id(j % units + 1);
+                input->set_pedal(0.5);
+            }
+
+            auto t0 = Clock::now();
+
+            // send batch and wait for states
+            if(!stream->Write(inputs) || !stream->Read(&states)) {
+                broken = true;
+                break;
+            }
+
+            latencies.push_back(std::chrono::duration<double, std::micro>(Clock::now() - t0).count());
+            completed += static_cast<unsigned int>(states.states_size());
+
+        }
+
+        stream->WritesDone();
+        Status status = stream->Finish();
+
+        if (!status.ok()) {
+            std::cout << "StreamRequests rpc failed: " << status.error_message() << std::endl;
+            return false;
+        }
+
+        if (broken) {
+            std::cout << "StreamRequests rpc broke after " << completed << " inputs" << std::endl;
+            return false;
+        }
+
+        return true;
+
+    }
+
     std::unique_ptr<simulation::models::RemoteController::Stub> stub_;
 
 };
 
+
+double percentile(std::vector<double> &values, double p) {
+
+    if(values.empty())
+        return 0.0;
+
+    auto n = static_cast<size_t>(p * static_cast<double>(values.size() - 1));
+    std::nth_element(values.begin(), values.begin() + n, values.end());
+
+    return values[n];
+
+}
+
+
 int main(int argc, char** argv) {
 
-    // Expect only arg: --db_path=path/to/route_guide_db.json.
-    // std::string db = routeguide::GetDbFileContent(argc, argv);
-    RemoteControllerClient client(grpc::CreateChannel("localhost:50051", grpc::InsecureChannelCredentials()));
+    cxxopts::Options options("client", "Load generator for the remote controller server");
+
+    options.add_options()
+            ("a,address", "Server address", cxxopts::value<std::string>()->default_value("localhost:50051"))
+            ("u,units", "Number of units", cxxopts::value<unsigned int>()->default_value("10"))
+            ("r,requests", "Number of inputs to be sent", cxxopts::value<unsigned int>()->default_value("10000"))
+            ("b,batch", "Number of inputs per batch (stream mode)", cxxopts::value<unsigned int>()->default_value("10"))
+            ("m,mode", "Mode (unary|stream)", cxxopts::value<std::string>()->default_value("stream"))
+            ("h,help", "Show help")
+            ;
 
-    simulation::models::VehicleDefinition def;
-    simulation::models::VehicleState state;
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return 0;
+    }
+
+    auto units = std::max(1u, result["units"].as<unsigned int>());
+    auto requests = result["requests"].as<unsigned int>();
+    auto batch = std::max(1u, result["batch"].as<unsigned int>());
+    auto mode = result["mode"].as<std::string>();
+
+    if(mode != "unary" && mode != "stream") {
+        std::cout << "Unknown mode: " << mode << " (unary|stream)" << std::endl;
+        return 1;
+    }
+
+    RemoteControllerClient client(grpc::CreateChannel(result["address"].as<std::string>(),
+            grpc::InsecureChannelCredentials()));
+
+    // create units
+    for(unsigned int i = 1; i <= units; ++i) {
+
+        VehicleDefinition def;
+        VehicleState state;
+
+        def.set_id(i);
+        if(!client.Create(def, &state))
+            return 1;
+
+    }
+
+    // run load
+    std::vector<double> latencies;
+    latencies.reserve(requests);
+    unsigned int completed = 0;
+
+    auto t0 = Clock::now();
+    bool ok = mode == "unary"
+            ? client.RunUnary(units, requests, latencies, completed)
+            : client.RunStream(units, requests, batch, latencies, completed);
+    auto elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    // destroy units
+    for(unsigned int i = 1; i <= units; ++i) {
+
+        VehicleDefinition def;
+        VehicleState state;
+
+        def.set_id(i);
+        client.Destroy(def, &state);
+
+    }
 
-    def.set_id(1);
-    client.Create(def, &state);
+    // report (completed inputs only)
+    std::cout << "mode:       " << mode << std::endl;
+    std::cout << "inputs:     " << completed << " of " << requests << std::endl;
+    std::cout << "p50 (us):   " << percentile(latencies, 0.50) << std::endl;
+    std::cout << "p99 (us):   " << percentile(latencies, 0.99) << std::endl;
+    std::cout << "throughput: " << static_cast<double>(completed) / elapsed << " inputs/s" << std::endl;
 
-    return 0;
+    return ok ? 0 : 1;
 }
\ No newline at end of file
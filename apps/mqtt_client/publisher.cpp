@@ -0,0 +1,93 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <LongitudinalModel/LongitudinalFleet.h>
+#include <telemetry/PahoTransport.h>
+#include <telemetry/Publisher.h>
+
+#include <cxxopts.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+
+int main(int argc, char* argv[]) {
+
+    cxxopts::Options options("mqtt_publisher", "Publishes the states of simulated vehicles to an MQTT broker");
+
+    options.add_options()
+            ("a,address", "Broker address", cxxopts::value<std::string>()->default_value("tcp://localhost:1883"))
+            ("v,vehicles", "Number of vehicles", cxxopts::value<unsigned int>()->default_value("1000"))
+            ("s,steps", "Number of simulation steps", cxxopts::value<unsigned int>()->default_value("1000"))
+            ("b,batch", "Maximum number of states per message", cxxopts::value<unsigned int>()->default_value("256"))
+            ("p,partitions", "Number of topics (0: one per vehicle)", cxxopts::value<unsigned int>()->default_value("10"))
+            ("f,inflight", "Maximum number of messages in flight", cxxopts::value<unsigned int>()->default_value("16"))
+            ("q,qos", "Quality of service", cxxopts::value<int>()->default_value("1"))
+            ("h,help", "Show help")
+            ;
+
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return 0;
+    }
+
+    try {
+
+        auto vehicles = result["vehicles"].as<unsigned int>();
+        auto steps = result["steps"].as<unsigned int>();
+        double dt = 0.01;
+
+        telemetry::PahoTransport transport(result["address"].as<std::string>(), "mqtt_publisher",
+                result["qos"].as<int>());
+
+        telemetry::Publisher::Options publisherOptions{};
+        publisherOptions.maxBatch = result["batch"].as<unsigned int>();
+        publisherOptions.partitions = result["partitions"].as<unsigned int>();
+        publisherOptions.maxInFlight = result["inflight"].as<unsigned int>();
+
+        telemetry::Publisher publisher(transport, publisherOptions);
+
+        // vehicles with constant pedal
+        models::LongitudinalFleet fleet{};
+        for(unsigned int i = 0; i < vehicles; ++i) {
+            fleet.add();
+            fleet.setInput(i, 0.1 + 0.9 * i / vehicles);
+        }
+
+        // simulate and publish
+        auto start = Clock::now();
+        for(unsigned int k = 0; k < steps; ++k) {
+
+            fleet.step(dt);
+
+            for(unsigned int i = 0; i < vehicles; ++i)
+                publisher.push(i, dt * (k + 1), fleet.getState(i));
+
+        }
+
+        auto simulated = Clock::now();
+        publisher.flush();
+        auto published = Clock::now();
+
+        auto s = publisher.statistics();
+        double seconds = std::chrono::duration<double>(published - start).count();
+
+        std::cout << "simulation: " << std::chrono::duration<double>(simulated - start).count() << " s" << std::endl;
+        std::cout << "total: " << seconds << " s" << std::endl;
+        std::cout << "pushed: " << s.pushed << ", published: " << s.published << ", conflated: " << s.conflated
+                  << ", dropped: " << s.dropped << ", failed messages: " << s.failed << std::endl;
+        std::cout << "states/s: " << (double) s.published / seconds << ", messages/s: "
+                  << (double) s.messages / seconds << std::endl;
+
+    } catch(const std::exception &e) {
+
+        std::cerr << e.what() << std::endl;
+        return 1;
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,97 @@
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <LongitudinalModel/LongitudinalFleet.h>
+#include <stats/Histogram.h>
+#include <telemetry/CommandInbox.h>
+#include <telemetry/PahoTransport.h>
+
+#include <cxxopts.hpp>
+
+using Clock = std::chrono::steady_clock;
+
+
+int main(int argc, char* argv[]) {
+
+    cxxopts::Options options("mqtt_subscriber", "Drives simulated vehicles with pedal commands received from an MQTT broker");
+
+    options.add_options()
+            ("a,address", "Broker address", cxxopts::value<std::string>()->default_value("tcp://localhost:1883"))
+            ("v,vehicles", "Number of vehicles", cxxopts::value<unsigned int>()->default_value("1000"))
+            ("s,steps", "Number of simulation steps", cxxopts::value<unsigned int>()->default_value("1000"))
+            ("t,step-size", "Step size (real time) in ms", cxxopts::value<unsigned int>()->default_value("10"))
+            ("p,prefix", "Topic prefix (commands on \"<prefix>/<vehicle>/input\")", cxxopts::value<std::string>()->default_value("vehicles"))
+            ("q,qos", "Quality of service", cxxopts::value<int>()->default_value("1"))
+            ("h,help", "Show help")
+            ;
+
+    auto result = options.parse(argc, argv);
+
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return 0;
+    }
+
+    try {
+
+        auto vehicles = result["vehicles"].as<unsigned int>();
+        auto steps = result["steps"].as<unsigned int>();
+        auto stepSize = std::chrono::milliseconds(result["step-size"].as<unsigned int>());
+        double dt = std::chrono::duration<double>(stepSize).count();
+
+        models::LongitudinalFleet fleet{};
+        for(unsigned int i = 0; i < vehicles; ++i)
+            fleet.add();
+
+        // the inbox must outlive the subscription
+        telemetry::CommandInbox inbox(vehicles, result["prefix"].as<std::string>());
+        telemetry::PahoTransport transport(result["address"].as<std::string>(), "mqtt_subscriber",
+                result["qos"].as<int>());
+
+        inbox.subscribe(transport);
+
+        // latency from the arrival to the application of a command in us
+        stats::Histogram latencies{};
+
+        auto apply = [&fleet, &latencies](size_t unit, double pedal, std::chrono::microseconds latency) {
+            fleet.setInput(unit, pedal);
+            latencies.record((uint64_t) latency.count());
+        };
+
+        // simulate in real time, the commands are applied at the start of each step
+        auto next = Clock::now();
+        for(unsigned int k = 0; k < steps; ++k) {
+
+            inbox.drain(apply);
+            fleet.step(dt);
+
+            next += stepSize;
+            std::this_thread::sleep_until(next);
+
+        }
+
+        auto s = inbox.statistics();
+
+        std::cout << "received: " << s.received << ", applied: " << s.applied << ", superseded: " << s.superseded
+                  << ", malformed: " << s.malformed << ", unknown: " << s.unknown << std::endl;
+
+        std::cout << "latency (us): mean " << latencies.mean() << ", p50 " << latencies.percentile(50.0)
+                  << ", p90 " << latencies.percentile(90.0) << ", p99 " << latencies.percentile(99.0)
+                  << ", p99.9 " << latencies.percentile(99.9) << ", max " << latencies.max() << std::endl;
+
+        latencies.forEach([](uint64_t lower, uint64_t upper, uint64_t count) {
+            std::cout << "  [" << lower << ", " << upper << "]: " << count << std::endl;
+        });
+
+    } catch(const std::exception &e) {
+
+        std::cerr << e.what() << std::endl;
+        return 1;
+
+    }
+
+    return 0;
+
+}
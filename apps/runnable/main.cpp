@@ -1,46 +1,80 @@
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
+#include <string>
 
-#include <two/two.h>
-#include <one/one.h>
+#include <parallel/ThreadPool.h>
+#include <sweep/Runner.h>
 
 #include <cxxopts.hpp>
 
+using Clock = std::chrono::steady_clock;
+
+
 int main(int argc, char* argv[]) {
 
-    cxxopts::Options options("MyProgram", "One line description of MyProgram");
+    cxxopts::Options options("runnable", "Parameter sweep of the PID controlled longitudinal model");
 
     options.add_options()
-            ("d,debug", "Enable debugging") // a bool parameter
-            ("i,integer", "Int param", cxxopts::value<int>())
-            ("f,file", "File name", cxxopts::value<std::string>())
-            ("v,verbose", "Verbose output", cxxopts::value<bool>()->default_value("false"))
+            ("kp", "Proportional gain (begin:end:steps or value)", cxxopts::value<std::string>()->default_value("0.005:0.05:10"))
+            ("ki", "Integral gain (begin:end:steps or value)", cxxopts::value<std::string>()->default_value("0.0005:0.005:10"))
+            ("kd", "Derivative gain (begin:end:steps or value)", cxxopts::value<std::string>()->default_value("0.0"))
+            ("mass", "Vehicle mass (begin:end:steps or value)", cxxopts::value<std::string>()->default_value("1000:2000:5"))
+            ("torque", "Maximum torque (begin:end:steps or value)", cxxopts::value<std::string>()->default_value("5000"))
+            ("speed", "Target speed (begin:end:steps or value)", cxxopts::value<std::string>()->default_value("20"))
+            ("d,duration", "Simulated time per run", cxxopts::value<double>()->default_value("60"))
+            ("s,step", "Time step size", cxxopts::value<double>()->default_value("0.01"))
+            ("band", "Settling band relative to the target speed", cxxopts::value<double>()->default_value("0.02"))
+            ("t,threads", "Number of threads (0: all cores)", cxxopts::value<unsigned int>()->default_value("0"))
+            ("b,batch", "Number of runs simulated in lockstep", cxxopts::value<unsigned int>()->default_value("256"))
+            ("o,output", "Columnar output file", cxxopts::value<std::string>()->default_value("sweep.col"))
             ("h,help", "Show help")
             ;
 
-
     auto result = options.parse(argc, argv);
 
-    if (result.count("help"))
-    {
+    if (result.count("help")) {
         std::cout << options.help() << std::endl;
-        exit(0);
+        return 0;
     }
-    bool debug = result["debug"].as<bool>();
 
-    std::string bar;
-    if (result.count("file"))
-        bar = result["file"].as<std::string>();
+    try {
+
+        // sweep definition
+        sweep::Definition definition{};
+        definition.kP = sweep::Range::parse(result["kp"].as<std::string>());
+        definition.kI = sweep::Range::parse(result["ki"].as<std::string>());
+        definition.kD = sweep::Range::parse(result["kd"].as<std::string>());
+        definition.mass = sweep::Range::parse(result["mass"].as<std::string>());
+        definition.maxTorque = sweep::Range::parse(result["torque"].as<std::string>());
+        definition.targetSpeed = sweep::Range::parse(result["speed"].as<std::string>());
+        definition.duration = result["duration"].as<double>();
+        definition.timeStepSize = result["step"].as<double>();
+        definition.settlingBand = result["band"].as<double>();
+
+        auto output = result["output"].as<std::string>();
 
-    int foo = result["integer"].as<int>();
+        parallel::ThreadPool pool(result["threads"].as<unsigned int>());
+        sweep::Runner runner(definition, &pool, result["batch"].as<unsigned int>());
 
-    std::cout << "debug: " << (debug ? "yes" : "no") << std::endl;
-    std::cout << "bar: " << bar << std::endl;
-    std::cout << "foo: " << foo << std::endl;
+        std::cout << "runs: " << definition.size() << ", threads: " << pool.size() << std::endl;
 
-    one();
-    two();
+        // run
+        auto start = Clock::now();
+        auto runs = runner.run(output);
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        std::cout << "output: " << output << std::endl;
+        std::cout << "time: " << seconds << " s" << std::endl;
+        std::cout << "runs/s: " << (double) runs / seconds << std::endl;
+
+    } catch(const std::exception &e) {
+
+        std::cerr << e.what() << std::endl;
+        return 1;
+
+    }
 
-    std::cout << "Hello, World!" << std::endl;
     return 0;
 
-}
\ No newline at end of file
+}
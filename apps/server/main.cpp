@@ -16,89 +16,70 @@
  *
  */
 
-#include <algorithm>
-#include <chrono>
-#include <cmath>
 #include <iostream>
 #include <memory>
 #include <string>
 
-#include <grpc/grpc.h>
+#include <cxxopts.hpp>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
-#include <grpcpp/server_context.h>
 #include <grpcpp/security/server_credentials.h>
-#include <server/Models.grpc.pb.h>
+#include <remote/AsyncRemoteServer.h>
+#include <remote/RemoteController.h>
 
 using grpc::Server;
 using grpc::ServerBuilder;
-using grpc::ServerContext;
-using grpc::ServerReader;
-using grpc::ServerReaderWriter;
-using grpc::ServerWriter;
-using grpc::Status;
-using simulation::models::VehicleDefinition;
-using simulation::models::VehicleInput;
-using simulation::models::VehicleState;
-using std::chrono::system_clock;
 
 
-class RemoteControllerImpl final : public simulation::models::RemoteController::Service {
+void RunSyncServer(const std::string &server_address) {
 
-public:
+    remote::RemoteControllerImpl service;
 
-    explicit RemoteControllerImpl() {
-        // simulation::models::Parse(db, &feature_list_);
-    }
-
-    Status CreateUnit(::grpc::ServerContext *context, const ::simulation::models::VehicleDefinition *request,
-                      ::simulation::models::VehicleState *response) override {
-
-        std::cout << "Create Unit" << std::endl;
-
-        response->set_acceleration(0.0);
-        response->set_velocity(0.0);
-        response->set_distance(0.0);
-
-        return Status::OK;
-
-    }
-
-    Status SendRequest(::grpc::ServerContext *context, const ::simulation::models::VehicleInput *request,
-                       ::simulation::models::VehicleState *response) override {
+    ServerBuilder builder;
+    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+    builder.RegisterService(&service);
+    std::unique_ptr<Server> server(builder.BuildAndStart());
+    std::cout << "Server listening on " << server_address << std::endl;
 
-        std::cout << "Send request" << std::endl;
-        return Service::SendRequest(context, request, response);
+    server->Wait();
 
-    }
+}
 
+void RunAsyncServer(const std::string &server_address, size_t threads, size_t cqs) {
 
-private:
+    remote::AsyncRemoteServer server(threads, cqs);
+    server.start(server_address);
 
-    std::mutex mu_;
+    std::cout << "Server listening on " << server_address << " (" << server.getNumberOfShards() << " shards, "
+              << cqs << " completion queues)" << std::endl;
 
-};
+    server.wait();
 
-void RunServer() {
+}
 
-    std::string server_address("0.0.0.0:50051");
-    RemoteControllerImpl service;
+int main(int argc, char** argv) {
 
-    ServerBuilder builder;
-    builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
-    builder.RegisterService(&service);
-    std::unique_ptr<Server> server(builder.BuildAndStart());
-    std::cout << "Server listening on " << server_address << std::endl;
+    cxxopts::Options options("server", "Simulates longitudinal vehicle units for remote clients");
 
-    server->Wait();
+    options.add_options()
+            ("a,address", "Listening address", cxxopts::value<std::string>()->default_value("0.0.0.0:50051"))
+            ("t,threads", "Number of unit shards/threads (0 = hardware threads)", cxxopts::value<size_t>()->default_value("0"))
+            ("c,cqs", "Number of completion queues", cxxopts::value<size_t>()->default_value("1"))
+            ("s,sync", "Runs the synchronous server")
+            ("h,help", "Show help")
+            ;
 
-}
+    auto result = options.parse(argc, argv);
 
-int main(int argc, char** argv) {
+    if (result.count("help")) {
+        std::cout << options.help() << std::endl;
+        return 0;
+    }
 
-    // Expect only arg: --db_path=path/to/route_guide_db.json.
-    // std::string db = routeguide::GetDbFileContent(argc, argv);
-    RunServer();
+    if (result.count("sync"))
+        RunSyncServer(result["address"].as<std::string>());
+    else
+        RunAsyncServer(result["address"].as<std::string>(), result["threads"].as<size_t>(), result["cqs"].as<size_t>());
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <google/protobuf/arena.h>
+#include <proto/Models.pb.h>
+#include <proto/PID_controller.h>
+#include <simulation/Model.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+class BenchmarkModel : public sim::Model<simulation::models::VehicleState> {
+
+public:
+
+    explicit BenchmarkModel(google::protobuf::Arena *arena) : sim::Model<simulation::models::VehicleState>(arena) {}
+
+    void reset() override {}
+
+    bool step(double simTime, double timeStepSize) override {
+
+        _data->set_velocity(_data->velocity() + timeStepSize);
+        return true;
+
+    }
+
+};
+
+
+static void BM_PIDSave_Heap(benchmark::State &state) {
+
+    PID_controller pid{};
+    pid.create();
+
+    auto start = bench::allocations();
+    for(auto _ : state) {
+
+        // fresh message per call
+        simulation::models::PID msg;
+        pid.save(&msg);
+        benchmark::DoNotOptimize(msg.ByteSizeLong());
+
+    }
+
+    bench::reportAllocations(state, start);
+
+}
+
+
+static void BM_PIDSave_Arena(benchmark::State &state) {
+
+    PID_controller pid{};
+    pid.create();
+
+    alignas(8) static char block[512];
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = sizeof(block);
+
+    auto start = bench::allocations();
+    for(auto _ : state) {
+
+        // message on an arena with a stack block
+        google::protobuf::Arena arena(options);
+        auto msg = google::protobuf::Arena::CreateMessage<simulation::models::PID>(&arena);
+        pid.save(msg);
+        benchmark::DoNotOptimize(msg->ByteSizeLong());
+
+    }
+
+    bench::reportAllocations(state, start);
+
+}
+
+
+static void BM_StateBatch_Heap(benchmark::State &state) {
+
+    auto n = (int) state.range(0);
+    std::string buffer;
+    buffer.reserve(1 << 16);
+
+    auto start = bench::allocations();
+    for(auto _ : state) {
+
+        // fresh batch per request
+        simulation::models::VehicleStateBatch batch;
+        for(int i = 0; i < n; ++i)
+            batch.add_states()->set_id((uint32_t) i);
+
+        batch.SerializeToString(&buffer);
+
+    }
+
+    bench::reportAllocations(state, start);
+
+}
+
+
+static void BM_StateBatch_Arena(benchmark::State &state) {
+
+    auto n = (int) state.range(0);
+    std::string buffer;
+    buffer.reserve(1 << 16);
+
+    // arena reset in bulk after every request
+    google::protobuf::Arena arena;
+
+    auto start = bench::allocations();
+    for(auto _ : state) {
+
+        auto batch = google::protobuf::Arena::CreateMessage<simulation::models::VehicleStateBatch>(&arena);
+        for(int i = 0; i < n; ++i)
+            batch->add_states()->set_id((uint32_t) i);
+
+        batch->SerializeToString(&buffer);
+        arena.Reset();
+
+    }
+
+    bench::reportAllocations(state, start);
+
+}
+
+
+static void BM_Models(benchmark::State &state) {
+
+    bool onArena = state.range(0) == 1;
+    google::protobuf::Arena arena;
+
+    auto start = bench::allocations();
+    for(auto _ : state) {
+
+        // create and drop a set of models per tick
+        {
+            std::vector<std::unique_ptr<BenchmarkModel>> models;
+            models.reserve(100);
+            for(int i = 0; i < 100; ++i) {
+                models.emplace_back(new BenchmarkModel(onArena ? &arena : nullptr));
+                models.back()->step(0.0, 0.01);
+            }
+        }
+
+        arena.Reset();
+
+    }
+
+    bench::reportAllocations(state, start);
+    state.SetLabel(onArena ? "arena" : "heap");
+
+}
+
+
+BENCHMARK(BM_PIDSave_Heap);
+BENCHMARK(BM_PIDSave_Arena);
+BENCHMARK(BM_StateBatch_Heap)->Arg(10)->Arg(100);
+BENCHMARK(BM_StateBatch_Arena)->Arg(10)->Arg(100);
+BENCHMARK(BM_Models)->Arg(0)->Arg(1);
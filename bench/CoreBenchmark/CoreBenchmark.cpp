@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+/*
+ * Single-call latency of the hot paths of the project. Each benchmark measures exactly one call of the function under
+ * test per iteration, so the results can be compared across releases (@see run_benchmarks target).
+ */
+
+#include <benchmark/benchmark.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <proto/Models.pb.h>
+#include <proto/PID_controller.h>
+#include <simulation/Model.h>
+#include <cstdio>
+#include <string>
+
+
+class BenchmarkModel : public sim::Model<double> {
+
+public:
+
+    double value = 0.0;
+
+    void reset() override {
+
+        value = 0.0;
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        value += timeStepSize;
+        return true;
+
+    }
+
+};
+
+
+// framework overhead of a model step (step time check, time update and the step call)
+static void BM_ModelSimStep(benchmark::State &state) {
+
+    BenchmarkModel model{};
+    model.create();
+    model.setTimeStepSize(0.01);
+    model.initialize(0.0);
+
+    double simTime = 0.0;
+    for(auto _ : state) {
+
+        simTime += 0.01;
+        benchmark::DoNotOptimize(model.simStep(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+static void BM_PIDControllerStep(benchmark::State &state) {
+
+    PID_controller pid{};
+    pid.create();
+    pid.setParameters(0.01, 0.001, 0.0001);
+
+    double simTime = 0.0;
+    for(auto _ : state) {
+
+        simTime += 0.01;
+        pid.setInput(1.0);
+        pid.step(simTime, 0.01);
+        benchmark::DoNotOptimize(pid.getOutput());
+
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+static void BM_LongitudinalModelStep(benchmark::State &state) {
+
+    models::LongitudinalModel vehicle{};
+
+    for(auto _ : state) {
+
+        vehicle.modelStep(0.1, 0.01);
+        benchmark::ClobberMemory();
+
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// save the controller to the message and serialize it into a reused buffer
+static void BM_PIDSave(benchmark::State &state) {
+
+    PID_controller pid{};
+    pid.create();
+
+    simulation::models::PID msg;
+    std::string buffer;
+
+    for(auto _ : state) {
+
+        pid.save(&msg);
+        msg.SerializeToString(&buffer);
+        benchmark::DoNotOptimize(buffer.data());
+
+    }
+
+    state.SetBytesProcessed(state.iterations() * (int64_t) buffer.size());
+
+}
+
+
+// parse the message from a buffer and load the controller from it
+static void BM_PIDLoad(benchmark::State &state) {
+
+    PID_controller pid{};
+    pid.create();
+
+    simulation::models::PID msg;
+    std::string buffer;
+    pid.save(&msg);
+    msg.SerializeToString(&buffer);
+
+    for(auto _ : state) {
+
+        msg.ParseFromString(buffer);
+        pid.load(msg);
+        benchmark::ClobberMemory();
+
+    }
+
+    state.SetBytesProcessed(state.iterations() * (int64_t) buffer.size());
+
+}
+
+
+// save and load through a file (includes the file system)
+static void BM_PIDFileRoundTrip(benchmark::State &state) {
+
+    const std::string path = "CoreBenchmark_pid.bin";
+
+    PID_controller pid{};
+    pid.create();
+
+    for(auto _ : state) {
+
+        pid.save(path);
+        pid.load(path);
+
+    }
+
+    std::remove(path.c_str());
+
+}
+
+
+BENCHMARK(BM_ModelSimStep);
+BENCHMARK(BM_PIDControllerStep);
+BENCHMARK(BM_LongitudinalModelStep);
+BENCHMARK(BM_PIDSave);
+BENCHMARK(BM_PIDLoad);
+BENCHMARK(BM_PIDFileRoundTrip);
@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/EventTimeServer.h>
+#include <simulation/Port.h>
+#include <simulation/TimeServer.h>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+
+constexpr static const size_t PRODUCERS = 10;
+constexpr static const double STEP_SIZE = 0.001;
+
+
+// writes a value, which changes with the given period
+class Producer : public sim::Model<double> {
+
+public:
+
+    sim::Output<double> out{this};
+    double period = 1.0;
+
+    void reset() override {}
+
+    bool step(double simTime, double) override {
+
+        out.set(std::floor(simTime / period + 1e-9));
+        return true;
+
+    }
+
+};
+
+
+// accumulates the changes of the input
+class Consumer : public sim::Model<double> {
+
+public:
+
+    sim::Input<double> in{this};
+    double last = 0.0;
+    double sum = 0.0;
+
+    void reset() override {
+
+        last = 0.0;
+        sum = 0.0;
+
+    }
+
+    bool step(double, double) override {
+
+        auto value = in.get();
+        if(value != last) {
+            sum += value;
+            last = value;
+        }
+
+        return true;
+
+    }
+
+};
+
+
+//!< Producers running at 1 ms and consumers connected to them
+struct Scenario {
+
+    std::vector<std::unique_ptr<Producer>> producers{};
+    std::vector<std::unique_ptr<Consumer>> consumers{};
+
+    /**
+     * Creates the models
+     * @param n Number of consumers
+     * @param period Period of the changes of the producers in ms
+     * @param eventDriven Flag to run the consumers event-driven (otherwise they poll the input at 1 ms)
+     */
+    Scenario(size_t n, long period, bool eventDriven) {
+
+        for(size_t i = 0; i < PRODUCERS; ++i) {
+
+            producers.emplace_back(new Producer);
+            producers.back()->period = (double) period * 1e-3;
+            producers.back()->create();
+            producers.back()->setTimeStepSize(STEP_SIZE);
+            producers.back()->initialize(0.0);
+
+        }
+
+        for(size_t i = 0; i < n; ++i) {
+
+            consumers.emplace_back(new Consumer);
+            auto &consumer = *consumers.back();
+
+            consumer.create();
+            if(eventDriven)
+                consumer.setExecutionMode(Consumer::ExecutionMode::EVENT_DRIVEN);
+            else
+                consumer.setTimeStepSize(STEP_SIZE);
+
+            consumer.initialize(0.0);
+            consumer.in.connect(producers[i % PRODUCERS]->out);
+            consumer.in.setTrigger(eventDriven);
+
+        }
+
+    }
+
+    //!< Registers the models (producers first)
+    template<typename Server>
+    void registerModels(Server &server) {
+
+        for(auto &p : producers)
+            server.registerModel(p.get());
+
+        for(auto &c : consumers)
+            server.registerModel(c.get());
+
+    }
+
+};
+
+
+template<typename Server>
+static void run(benchmark::State &state, bool eventDriven) {
+
+    Scenario scenario((size_t) state.range(0), (long) state.range(1), eventDriven);
+
+    Server server{};
+    scenario.registerModels(server);
+
+    // one iteration is one simulation step of 1 ms
+    unsigned long i = 0;
+    unsigned long steps = 0;
+    for(auto _ : state)
+        steps += server.step(STEP_SIZE * (double) i++);
+
+    state.counters["model_steps"] = benchmark::Counter((double) steps, benchmark::Counter::kAvgIterations);
+
+}
+
+
+// the consumers poll their inputs at 1 ms
+static void BM_FixedStep(benchmark::State &state) {
+
+    run<sim::TimeServer>(state, false);
+
+}
+
+
+// the consumers are woken up by the changes of their inputs
+static void BM_EventDriven(benchmark::State &state) {
+
+    run<sim::EventTimeServer>(state, true);
+
+}
+
+
+// number of consumers and period of the changes in ms
+BENCHMARK(BM_FixedStep)->Args({1000, 10})->Args({1000, 1000})->Args({10000, 1000});
+BENCHMARK(BM_EventDriven)->Args({1000, 10})->Args({1000, 1000})->Args({10000, 1000});
@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <three/fleet.h>
+#include <vector>
+
+
+// steps a fleet through the C interface: range(0) units, range(1) steps per call
+static void fleetThroughput(benchmark::State &state, threelib::FleetMode mode) {
+
+    auto units = (size_t) state.range(0);
+    auto steps = (unsigned int) state.range(1);
+
+    std::vector<double> inputs(units, mode == threelib::FLEET_OPEN_LOOP ? 0.05 : 10.0);
+    std::vector<double> gains(units, 0.01);
+    std::vector<double> zeros(units, 0.0);
+    std::vector<double> v(units);
+
+    threelib::Fleet *fleet = threelib::fleetCreate(units, mode);
+    if(mode == threelib::FLEET_CLOSED_LOOP)
+        threelib::fleetSetControllerGains(fleet, 0, units, gains.data(), gains.data(), zeros.data());
+
+    auto start = bench::allocations();
+
+    for(auto _ : state) {
+
+        // one round trip: write inputs, step, read states
+        threelib::fleetSetInputs(fleet, 0, units, inputs.data());
+        threelib::fleetStep(fleet, 0.01, steps);
+        threelib::fleetGetStates(fleet, 0, units, nullptr, v.data(), nullptr);
+
+        benchmark::DoNotOptimize(v.data());
+
+    }
+
+    bench::reportAllocations(state, start);
+    state.SetItemsProcessed((int64_t) state.iterations() * state.range(0) * state.range(1));
+
+    threelib::fleetDestroy(fleet);
+
+}
+
+
+static void BM_FleetOpenLoop(benchmark::State &state) {
+
+    fleetThroughput(state, threelib::FLEET_OPEN_LOOP);
+
+}
+
+
+static void BM_FleetClosedLoop(benchmark::State &state) {
+
+    fleetThroughput(state, threelib::FLEET_CLOSED_LOOP);
+
+}
+
+
+// number of units, steps per call
+BENCHMARK(BM_FleetOpenLoop)->Args({1, 1})->Args({1000, 1})->Args({1000, 100})->Args({100000, 1});
+BENCHMARK(BM_FleetClosedLoop)->Args({1, 1})->Args({1000, 1})->Args({1000, 100})->Args({100000, 1});
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/Fork.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+class BenchmarkModel : public sim::Model<double>, public models::LongitudinalModel {
+
+public:
+
+    void reset() override {}
+
+    bool step(double simTime, double timeStepSize) override {
+
+        modelStep(0.5, timeStepSize);
+        return true;
+
+    }
+
+    void saveState(sim::SnapshotWriter &writer) const override {
+
+        sim::Model<double>::saveState(writer);
+        writer.write(state);
+        writer.write(getParameters());
+
+    }
+
+    void loadState(sim::SnapshotReader &reader) override {
+
+        sim::Model<double>::loadState(reader);
+        reader.read(state);
+
+        models::Parameters parameters{};
+        reader.read(parameters);
+        setParameters(parameters);
+
+    }
+
+};
+
+
+constexpr static const size_t MODELS = 100;
+constexpr static const double WARM_UP = 10.0;
+constexpr static const double END_TIME = 11.0;
+constexpr static const double TIME_STEP_SIZE = 0.01;
+
+
+std::vector<std::unique_ptr<BenchmarkModel>> createModels() {
+
+    std::vector<std::unique_ptr<BenchmarkModel>> models{};
+    for(size_t i = 0; i < MODELS; ++i) {
+
+        models.emplace_back(new BenchmarkModel);
+        models.back()->create();
+        models.back()->setIDAndName("model-" + std::to_string(i), "Model");
+        models.back()->setTimeStepSize(TIME_STEP_SIZE);
+        models.back()->initialize(0.0);
+
+    }
+
+    return models;
+
+}
+
+
+void simulate(std::vector<std::unique_ptr<BenchmarkModel>> &models, double start, double end) {
+
+    sim::TimeServer server{};
+    for(auto &m : models)
+        server.registerModel(m.get());
+
+    for(unsigned long k = 1; start + (double) k * TIME_STEP_SIZE < end + 1e-9; ++k)
+        server.step(start + (double) k * TIME_STEP_SIZE);
+
+}
+
+
+// every variant simulates the warm-up from the initialization
+static void BM_Variants_Resimulate(benchmark::State &state) {
+
+    auto n = (size_t) state.range(0);
+
+    for(auto _ : state) {
+        for(size_t b = 0; b < n; ++b) {
+
+            auto models = createModels();
+            auto parameters = models[0]->getParameters();
+            parameters.mass += (double) b;
+            models[0]->setParameters(parameters);
+
+            simulate(models, 0.0, WARM_UP);
+            simulate(models, WARM_UP, END_TIME);
+
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+// the warm-up is simulated once, the variants are forked from it
+static void BM_Variants_Fork(benchmark::State &state) {
+
+    auto n = (size_t) state.range(0);
+
+    for(auto _ : state) {
+
+        auto models = createModels();
+        simulate(models, 0.0, WARM_UP);
+
+        std::vector<sim::ModelBase *> pointers{};
+        for(auto &m : models)
+            pointers.push_back(m.get());
+
+        sim::Fork fork(pointers, WARM_UP, [](size_t) {
+            return std::unique_ptr<sim::ModelBase>(new BenchmarkModel);
+        });
+
+        auto branches = fork.branch(n);
+        for(size_t b = 0; b < n; ++b) {
+            auto model = branches[b].get<BenchmarkModel>(0);
+            auto parameters = model->getParameters();
+            parameters.mass += (double) b;
+            model->setParameters(parameters);
+        }
+
+        benchmark::DoNotOptimize(fork.run(branches, END_TIME, TIME_STEP_SIZE));
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK(BM_Variants_Resimulate)->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Variants_Fork)->RangeMultiplier(4)->Range(1, 64)->Unit(benchmark::kMillisecond);
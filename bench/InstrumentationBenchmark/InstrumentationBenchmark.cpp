@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/Instrumentation.h>
+#include <simulation/Model.h>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class BenchmarkModel : public sim::Model<double> {
+
+public:
+
+    double value = 0.0;
+
+    void reset() override {
+
+        value = 0.0;
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        value += timeStepSize;
+        return true;
+
+    }
+
+};
+
+
+// instrumented model step (the same model as BM_ModelSimStep of CoreBenchmark)
+static void BM_InstrumentedSimStep(benchmark::State &state) {
+
+    BenchmarkModel model{};
+    model.create();
+    model.setTimeStepSize(0.01);
+    model.initialize(0.0);
+
+    double simTime = 0.0;
+    for(auto _ : state) {
+
+        simTime += 0.01;
+        benchmark::DoNotOptimize(model.simStep(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// instrumented simulation step, in which the model is not stepped
+static void BM_InstrumentedSkip(benchmark::State &state) {
+
+    BenchmarkModel model{};
+    model.create();
+    model.setTimeStepSize(1e9);
+    model.initialize(0.0);
+    model.simStep(0.0);
+
+    double simTime = 0.0;
+    for(auto _ : state) {
+
+        simTime += 0.01;
+        benchmark::DoNotOptimize(model.simStep(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// snapshot and export of the given number of models
+static void BM_Export(benchmark::State &state) {
+
+    std::vector<std::unique_ptr<BenchmarkModel>> models{};
+    for(long i = 0; i < state.range(0); ++i) {
+        models.emplace_back(new BenchmarkModel);
+        models.back()->create();
+        models.back()->setIDAndName("model-" + std::to_string(i), "Benchmark");
+        models.back()->setTimeStepSize(0.01);
+        models.back()->initialize(0.0);
+        for(int k = 0; k < 100; ++k)
+            models.back()->simStep(0.01 * k);
+    }
+
+    std::stringstream ss;
+    for(auto _ : state) {
+
+        ss.str("");
+        auto statistics = sim::Instrumentation::global().snapshot();
+        if(state.range(1) == 0)
+            sim::Instrumentation::writeJSON(ss, statistics);
+        else
+            sim::Instrumentation::writePrometheus(ss, statistics);
+
+        benchmark::DoNotOptimize(ss.tellp());
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK(BM_InstrumentedSimStep);
+BENCHMARK(BM_InstrumentedSkip);
+
+// number of models, format (0: JSON, 1: Prometheus)
+BENCHMARK(BM_Export)->ArgsProduct({{10, 1000}, {0, 1}});
@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <LongitudinalModel/LongitudinalFleet.h>
+#include <vector>
+
+
+static void BM_LongitudinalModel(benchmark::State &state) {
+
+    std::vector<models::LongitudinalModel> vehicles((size_t) state.range(0));
+
+    for(auto _ : state) {
+
+        for(auto &v : vehicles)
+            v.modelStep(0.1, 0.01);
+
+        benchmark::ClobberMemory();
+
+    }
+
+    // vehicle steps per second
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+static void BM_LongitudinalFleet(benchmark::State &state) {
+
+    models::LongitudinalFleet fleet{};
+    if(!fleet.setKernel((models::LongitudinalFleet::Kernel) state.range(1))) {
+        state.SkipWithError("Kernel not supported");
+        return;
+    }
+
+    for(long i = 0; i < state.range(0); ++i)
+        fleet.setInput(fleet.add(), 0.1);
+
+    for(auto _ : state) {
+
+        fleet.step(0.01);
+        benchmark::ClobberMemory();
+
+    }
+
+    // vehicle steps per second
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK(BM_LongitudinalModel)->Arg(1000)->Arg(100000);
+BENCHMARK(BM_LongitudinalFleet)
+    ->Args({1000, (long) models::LongitudinalFleet::Kernel::SCALAR})
+    ->Args({1000, (long) models::LongitudinalFleet::Kernel::AVX2})
+    ->Args({100000, (long) models::LongitudinalFleet::Kernel::SCALAR})
+    ->Args({100000, (long) models::LongitudinalFleet::Kernel::AVX2});
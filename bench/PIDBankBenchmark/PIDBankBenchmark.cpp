@@ -0,0 +1,92 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <proto/PIDBank.h>
+#include <memory>
+#include <vector>
+
+
+static void BM_PIDController(benchmark::State &state) {
+
+    // one heap object per controller
+    std::vector<std::unique_ptr<PID_controller>> controllers{};
+    for(long i = 0; i < state.range(0); ++i) {
+
+        controllers.emplace_back(new PID_controller);
+        controllers.back()->create();
+        controllers.back()->setParameters(1.0, 0.1, 0.01);
+        controllers.back()->reset();
+        controllers.back()->setInput(1.0);
+
+    }
+
+    double t = 0.0;
+    for(auto _ : state) {
+
+        for(auto &c : controllers)
+            c->step(t, 0.01);
+
+        t += 0.01;
+        benchmark::ClobberMemory();
+
+    }
+
+    // controller steps per second
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+static void BM_PIDBank(benchmark::State &state) {
+
+    PIDBank bank{};
+    if(!bank.setKernel((PIDBank::Kernel) state.range(1))) {
+        state.SkipWithError("Kernel not supported");
+        return;
+    }
+
+    for(long i = 0; i < state.range(0); ++i)
+        bank.setInput(bank.add(1.0, 0.1, 0.01), 1.0);
+
+    double t = 0.0;
+    for(auto _ : state) {
+
+        bank.step(t, 0.01);
+
+        t += 0.01;
+        benchmark::ClobberMemory();
+
+    }
+
+    // controller steps per second
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK(BM_PIDController)->Arg(100000);
+BENCHMARK(BM_PIDBank)
+    ->Args({100000, (long) PIDBank::Kernel::SCALAR})
+    ->Args({100000, (long) PIDBank::Kernel::AVX2});
@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/PacedTimeServer.h>
+#include <chrono>
+
+
+class PacingModel : public sim::Model<double> {
+
+public:
+
+    PacingModel() {
+
+        create();
+        setTimeStepSize(0.001);
+        initialize(0.0);
+
+    }
+
+    void reset() override {}
+
+    bool step(double, double) override {
+
+        return true;
+
+    }
+
+};
+
+
+// one iteration runs 100 steps of 1 ms in real time, the counters are the start delays of the steps
+static void BM_PacingJitter(benchmark::State &state) {
+
+    PacingModel model{};
+
+    sim::PacedTimeServer<> server{};
+    server.setSpinTime(std::chrono::microseconds(state.range(0)));
+    server.registerModel(&model);
+
+    double time = 0.0;
+    for(auto _ : state)
+        time = server.run(time + 0.001, time + 0.1);
+
+    auto &lateness = server.lateness();
+    state.counters["p50_us"] = (double) lateness.percentile(50.0) / 1000.0;
+    state.counters["p99_us"] = (double) lateness.percentile(99.0) / 1000.0;
+    state.counters["max_us"] = (double) lateness.max() / 1000.0;
+    state.counters["overruns"] = (double) server.statistics().overruns;
+
+}
+
+
+// argument: spin time in us
+BENCHMARK(BM_PacingJitter)->Arg(0)->Arg(50)->Arg(200)->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
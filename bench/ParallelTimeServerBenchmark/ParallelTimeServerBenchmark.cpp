@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/ParallelTimeServer.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+class WorkloadModel : public sim::Model<double> {
+
+public:
+
+    double x = 0.0;
+
+    void reset() override {
+
+        x = 0.0;
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        // a small amount of work per step
+        for(int i = 0; i < 100; ++i)
+            x = std::sin(x + simTime) + std::min(1.0, timeStepSize);
+
+        return true;
+
+    }
+
+};
+
+
+static void BM_ParallelTimeServer(benchmark::State &state) {
+
+    // create models
+    std::vector<std::unique_ptr<WorkloadModel>> models{};
+    for(size_t i = 0; i < 10000; ++i) {
+
+        models.emplace_back(new WorkloadModel);
+        models.back()->create();
+        models.back()->setTimeStepSize(0.001);
+        models.back()->initialize(0.0);
+
+    }
+
+    // create pool and server
+    parallel::ThreadPool pool((size_t) state.range(0));
+    sim::ParallelTimeServer server(&pool);
+    for(auto &m : models)
+        server.registerModel(m.get());
+
+    unsigned long i = 0;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(server.step(0.001 * (double) i++));
+
+    state.SetItemsProcessed(state.iterations() * (long) models.size());
+
+}
+
+
+BENCHMARK(BM_ParallelTimeServer)
+    ->RangeMultiplier(2)->Range(1, (long) std::max(1u, std::thread::hardware_concurrency()))
+    ->UseRealTime();
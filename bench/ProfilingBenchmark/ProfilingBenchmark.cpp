@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <profiling/Tracer.h>
+#include <simulation/Model.h>
+#include <sstream>
+
+using profiling::Tracer;
+
+
+class BenchmarkModel : public sim::Model<double> {
+
+public:
+
+    double value = 0.0;
+
+    void reset() override {
+
+        value = 0.0;
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        value += timeStepSize;
+        return true;
+
+    }
+
+};
+
+
+// drains the rings before they are full (not measured)
+static void drain(benchmark::State &state, unsigned long i) {
+
+    if(i % (Tracer::CAPACITY / 4) != 0)
+        return;
+
+    state.PauseTiming();
+    Tracer::global().clear();
+    state.ResumeTiming();
+
+}
+
+
+static void BM_Span(benchmark::State &state) {
+
+    Tracer::global().clear();
+    Tracer::global().enable(state.range(0) != 0);
+
+    unsigned long i = 0;
+    for(auto _ : state) {
+
+        {
+            PROFILE_SPAN("bench", "span");
+        }
+
+        drain(state, ++i);
+
+    }
+
+    Tracer::global().enable(false);
+    Tracer::global().clear();
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// model step with the simStep and step spans (compare with BM_ModelSimStep of CoreBenchmark)
+static void BM_TracedSimStep(benchmark::State &state) {
+
+    BenchmarkModel model{};
+    model.create();
+    model.setTimeStepSize(0.01);
+    model.initialize(0.0);
+
+    Tracer::global().clear();
+    Tracer::global().enable(state.range(0) != 0);
+
+    unsigned long i = 0;
+    double simTime = 0.0;
+    for(auto _ : state) {
+
+        simTime += 0.01;
+        benchmark::DoNotOptimize(model.simStep(simTime));
+
+        drain(state, ++i);
+
+    }
+
+    Tracer::global().enable(false);
+    Tracer::global().clear();
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// export of a full ring
+static void BM_Export(benchmark::State &state) {
+
+    std::stringstream ss;
+    for(auto _ : state) {
+
+        state.PauseTiming();
+        ss.str("");
+        for(size_t i = 0; i < Tracer::CAPACITY; ++i)
+            Tracer::global().record("bench", "span", Tracer::now(), 100);
+        state.ResumeTiming();
+
+        Tracer::global().writeChromeTrace(ss);
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * (int64_t) Tracer::CAPACITY);
+
+}
+
+
+// tracing disabled, enabled
+BENCHMARK(BM_Span)->Arg(0)->Arg(1);
+BENCHMARK(BM_TracedSimStep)->Arg(0)->Arg(1);
+BENCHMARK(BM_Export);
@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/server_builder.h>
+#include <remote/AsyncRemoteServer.h>
+#include <remote/RemoteController.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using simulation::models::VehicleInputBatch;
+using simulation::models::VehicleStateBatch;
+using Stream = grpc::ClientReaderWriter<VehicleInputBatch, VehicleStateBatch>;
+
+
+// sends one input per call (unary round trip) to a unit of the given stub
+static void unaryRoundTrip(benchmark::State &state, simulation::models::RemoteController::Stub &stub) {
+
+    grpc::ClientContext createContext;
+    simulation::models::VehicleDefinition def;
+    simulation::models::VehicleInput input;
+    simulation::models::VehicleState s;
+
+    def.set_id(1);
+    stub.CreateUnit(&createContext, def, &s);
+
+    input.set_id(1);
+    input.set_pedal(0.1);
+
+    for(auto _ : state) {
+
+        // a client context can only be used for one call
+        grpc::ClientContext context;
+        if(!stub.SendRequest(&context, input, &s).ok()) {
+            state.SkipWithError("Call failed");
+            break;
+        }
+
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// unary round trip against the synchronous server
+static void BM_SyncRoundTrip(benchmark::State &state) {
+
+    int port = 0;
+    remote::RemoteControllerImpl service;
+
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&service);
+    std::unique_ptr<grpc::Server> server(builder.BuildAndStart());
+
+    auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials());
+    auto stub = simulation::models::RemoteController::NewStub(channel);
+
+    unaryRoundTrip(state, *stub);
+
+    server->Shutdown();
+
+}
+
+
+// unary round trip against the asynchronous server
+static void BM_AsyncRoundTrip(benchmark::State &state) {
+
+    int port = 0;
+    remote::AsyncRemoteServer server(1, 1);
+    server.start("127.0.0.1:0", &port);
+
+    auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials());
+    auto stub = simulation::models::RemoteController::NewStub(channel);
+
+    unaryRoundTrip(state, *stub);
+
+}
+
+
+static void BM_AsyncRemoteServer(benchmark::State &state) {
+
+    const uint32_t units = 1000;
+    const uint32_t batch = 100;
+    const size_t clients = 4;
+
+    // start server on a free port
+    int port = 0;
+    remote::AsyncRemoteServer server((size_t) state.range(0), (size_t) state.range(1));
+    server.start("127.0.0.1:0", &port);
+
+    auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials());
+    auto stub = simulation::models::RemoteController::NewStub(channel);
+
+    // create units
+    for(uint32_t id = 1; id <= units; ++id) {
+
+        grpc::ClientContext context;
+        simulation::models::VehicleDefinition def;
+        simulation::models::VehicleState s;
+
+        def.set_id(id);
+        stub->CreateUnit(&context, def, &s);
+
+    }
+
+    // one stream per client, each client steps its part of the units
+    std::vector<std::unique_ptr<grpc::ClientContext>> contexts{};
+    std::vector<std::unique_ptr<Stream>> streams{};
+    std::vector<VehicleInputBatch> inputs(clients);
+    VehicleStateBatch states{};
+
+    for(size_t c = 0; c < clients; ++c) {
+
+        contexts.emplace_back(new grpc::ClientContext);
+        streams.emplace_back(stub->StreamRequests(contexts.back().get()));
+
+        for(uint32_t i = 0; i < batch; ++i) {
+            auto input = inputs[c].add_inputs();
+            input->set_id((uint32_t) ((c * batch + i) % units) + 1);
+            input->set_pedal(0.5);
+        }
+
+    }
+
+    for(auto _ : state) {
+
+        for(size_t c = 0; c < clients; ++c)
+            streams[c]->Write(inputs[c]);
+
+        for(size_t c = 0; c < clients; ++c)
+            streams[c]->Read(&states);
+
+    }
+
+    for(auto &s : streams) {
+        s->WritesDone();
+        s->Finish();
+    }
+
+    state.SetItemsProcessed(state.iterations() * (long) (clients * batch));
+
+}
+
+
+BENCHMARK(BM_SyncRoundTrip)->UseRealTime();
+BENCHMARK(BM_AsyncRoundTrip)->UseRealTime();
+BENCHMARK(BM_AsyncRemoteServer)
+    ->ArgsProduct({benchmark::CreateRange(1, (long) std::max(1u, std::thread::hardware_concurrency()), 2), {1, 2}})
+    ->UseRealTime();
@@ -0,0 +1,85 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <parallel/ShardedExecutor.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <algorithm>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+
+static void BM_ShardedUnits(benchmark::State &state) {
+
+    const uint32_t units = 10000;
+    const uint32_t batch = 100;
+
+    parallel::ShardedExecutor executor((size_t) state.range(0));
+
+    // units owned by their shards
+    std::vector<std::unordered_map<uint32_t, models::LongitudinalModel>> shards(executor.size());
+    for(uint32_t id = 0; id < units; ++id)
+        shards[executor.shardOf(id)][id] = models::LongitudinalModel{};
+
+    // split the ids into batches by shard, as a server does with its requests
+    std::vector<std::vector<std::vector<uint32_t>>> batches{};
+    for(uint32_t b = 0; b < units; b += batch) {
+
+        batches.emplace_back(executor.size());
+        for(uint32_t id = b; id < b + batch; ++id)
+            batches.back()[executor.shardOf(id)].push_back(id);
+
+    }
+
+    for(auto _ : state) {
+
+        for(auto &b : batches) {
+
+            for(size_t s = 0; s < b.size(); ++s) {
+
+                if(b[s].empty())
+                    continue;
+
+                executor.post(s, [&shards, &b, s] {
+                    for(auto id : b[s])
+                        shards[s][id].modelStep(0.5, 0.001);
+                });
+
+            }
+
+        }
+
+        executor.sync();
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * (long) units);
+
+}
+
+
+BENCHMARK(BM_ShardedUnits)
+    ->RangeMultiplier(2)->Range(1, (long) std::max(1u, std::thread::hardware_concurrency()))
+    ->UseRealTime();
@@ -0,0 +1,155 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/Snapshot.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+class BenchmarkModel : public sim::Model<double>, public models::LongitudinalModel {
+
+public:
+
+    void reset() override {}
+
+    bool step(double simTime, double timeStepSize) override {
+
+        modelStep(0.5, 0.01);
+        return true;
+
+    }
+
+    void saveState(sim::SnapshotWriter &writer) const override {
+
+        sim::Model<double>::saveState(writer);
+        writer.write(state);
+
+    }
+
+    void loadState(sim::SnapshotReader &reader) override {
+
+        sim::Model<double>::loadState(reader);
+        reader.read(state);
+
+    }
+
+};
+
+
+class SnapshotFixture : public benchmark::Fixture {
+
+public:
+
+    std::vector<std::unique_ptr<BenchmarkModel>> models{};
+    std::unique_ptr<parallel::ThreadPool> pool{};
+    std::unique_ptr<sim::Snapshot> snapshot{};
+    const std::string path = "SnapshotBenchmark.bin";
+
+    void SetUp(const benchmark::State &state) override {
+
+        auto n = (size_t) state.range(0);
+        pool.reset(state.range(1) > 1 ? new parallel::ThreadPool((size_t) state.range(1)) : nullptr);
+        snapshot.reset(new sim::Snapshot(pool.get()));
+
+        models.clear();
+        for(size_t i = 0; i < n; ++i) {
+
+            models.emplace_back(new BenchmarkModel);
+            models.back()->create();
+            models.back()->setIDAndName("model-" + std::to_string(i), "Model");
+            models.back()->setTimeStepSize(0.01);
+            models.back()->initialize(0.0);
+            models.back()->simStep(0.0);
+
+            snapshot->registerModel(models.back().get());
+
+        }
+
+        snapshot->save(path);
+
+    }
+
+    void TearDown(const benchmark::State &) override {
+
+        snapshot.reset();
+        pool.reset();
+        models.clear();
+
+        std::remove(path.c_str());
+
+    }
+
+};
+
+
+BENCHMARK_DEFINE_F(SnapshotFixture, Save)(benchmark::State &state) {
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(snapshot->save(path));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK_DEFINE_F(SnapshotFixture, SaveIncremental)(benchmark::State &state) {
+
+    for(auto _ : state) {
+
+        // 1% of the models changed
+        state.PauseTiming();
+        for(size_t i = 0; i < models.size(); i += 100)
+            models[i]->setDirty(true);
+        state.ResumeTiming();
+
+        benchmark::DoNotOptimize(snapshot->save(path, true));
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK_DEFINE_F(SnapshotFixture, Load)(benchmark::State &state) {
+
+    for(auto _ : state)
+        benchmark::DoNotOptimize(snapshot->load(path));
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+// arguments: number of models, number of threads
+BENCHMARK_REGISTER_F(SnapshotFixture, Save)
+    ->ArgsProduct({{1000, 10000, 100000, 1000000}, {1, 4}})->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_REGISTER_F(SnapshotFixture, SaveIncremental)
+    ->ArgsProduct({{1000, 10000, 100000, 1000000}, {1}})->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_REGISTER_F(SnapshotFixture, Load)
+    ->ArgsProduct({{1000, 10000, 100000, 1000000}, {1, 4}})->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <solver/DormandPrince.h>
+#include <solver/ExplicitEuler.h>
+#include <solver/RungeKutta4.h>
+#include <cmath>
+
+
+constexpr static const double INPUT = 0.05;
+constexpr static const double END_TIME = 60.0;
+
+
+// analytic solution of the vehicle accelerating with constant input from standstill: m v' = F - k v^2
+static models::State analytic(double t) {
+
+    models::Parameters p{};
+
+    double k = 0.5 * p.rhoAir * p.airDragParam;
+    double force = 4.0 * INPUT * p.maxTorque / 0.3;
+    double omega = std::sqrt(force * k) / p.mass;
+
+    return {0.0, std::sqrt(force / k) * std::tanh(omega * t), p.mass / k * std::log(std::cosh(omega * t))};
+
+}
+
+
+// reports the error of the final state and the cost of one run
+static void report(benchmark::State &state, const models::State &result, double evaluations, double steps) {
+
+    auto reference = analytic(END_TIME);
+
+    state.counters["error_s"] = std::abs(result.s - reference.s);
+    state.counters["error_v"] = std::abs(result.v - reference.v);
+    state.counters["evaluations"] = evaluations;
+    state.counters["steps"] = steps;
+
+}
+
+
+// runs the scenario with the given time step (in ms) and solver, returns the final state
+template<typename Step>
+static models::State run(double timeStepSize, Step &&step) {
+
+    models::LongitudinalModel model{};
+
+    auto n = (unsigned int) std::lround(END_TIME / timeStepSize);
+    for(unsigned int i = 0; i < n; ++i)
+        step(model, timeStepSize);
+
+    return model.getState();
+
+}
+
+
+// the fixed scheme adds 0.5 * a * dt (instead of 0.5 * a * dt^2) to the distance, which leaves an error of v / 2
+static void BM_FixedScheme(benchmark::State &state) {
+
+    double timeStepSize = (double) state.range(0) * 1e-3;
+    models::State result{};
+
+    for(auto _ : state) {
+
+        result = run(timeStepSize, [] (models::LongitudinalModel &model, double dt) { model.modelStep(INPUT, dt); });
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    double steps = std::round(END_TIME / timeStepSize);
+    report(state, result, steps, steps);
+
+}
+
+
+template<typename Solver>
+static void BM_FixedStepSolver(benchmark::State &state) {
+
+    double timeStepSize = (double) state.range(0) * 1e-3;
+    models::State result{};
+    Solver solver{};
+
+    for(auto _ : state) {
+
+        solver.reset();
+        result = run(timeStepSize, [&solver] (models::LongitudinalModel &model, double dt) {
+            model.modelStep(INPUT, dt, solver);
+        });
+
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    report(state, result, (double) solver.evaluations(), (double) solver.steps());
+
+}
+
+
+// adaptive solver with the tolerance 10^-range(0) and the model time step range(1) (in ms)
+static void BM_DormandPrince(benchmark::State &state) {
+
+    double tolerance = std::pow(10.0, -(double) state.range(0));
+    double timeStepSize = (double) state.range(1) * 1e-3;
+    models::State result{};
+    solver::DormandPrince solver(tolerance, tolerance);
+
+    for(auto _ : state) {
+
+        solver.reset();
+        result = run(timeStepSize, [&solver] (models::LongitudinalModel &model, double dt) {
+            model.modelStep(INPUT, dt, solver);
+        });
+
+        benchmark::DoNotOptimize(result);
+
+    }
+
+    report(state, result, (double) solver.evaluations(), (double) solver.steps());
+    state.counters["rejected"] = (double) solver.rejected();
+
+}
+
+
+// time step sizes in ms
+BENCHMARK(BM_FixedScheme)->Arg(1)->Arg(10)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(BM_FixedStepSolver, solver::ExplicitEuler)->Arg(1)->Arg(10)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(BM_FixedStepSolver, solver::RungeKutta4)->Arg(10)->Arg(100)->Arg(500)->Arg(1000);
+
+// tolerance exponents and time step sizes in ms
+BENCHMARK(BM_DormandPrince)->Args({6, 100})->Args({4, 1000})->Args({6, 1000})->Args({8, 1000})->Args({10, 1000})
+        ->Args({8, 60000});
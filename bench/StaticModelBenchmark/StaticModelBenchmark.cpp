@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/Model.h>
+#include <simulation/StaticModel.h>
+#include <simulation/StaticModelSet.h>
+#include <memory>
+#include <vector>
+
+
+constexpr static const size_t MODELS = 1000;
+constexpr static const double STEP_SIZE = 0.001;
+
+
+// first order lag: x' = (u - x) / T
+class VirtualPlant : public sim::Model<double> {
+
+public:
+
+    double input = 1.0;
+
+    double value() const { return *_data; }
+
+    void reset() override { *_data = 0.0; }
+
+    bool step(double, double timeStepSize) override {
+
+        *_data += (input - *_data) * timeStepSize * 10.0;
+        return true;
+
+    }
+
+};
+
+
+// PI controller of the plant
+class VirtualController : public sim::Model<double> {
+
+public:
+
+    VirtualPlant *plant = nullptr;
+    double integral = 0.0;
+
+    void reset() override { *_data = 0.0; integral = 0.0; }
+
+    bool step(double, double) override {
+
+        double error = 1.0 - plant->value();
+        integral += error * STEP_SIZE;
+        *_data = 2.0 * error + 0.5 * integral;
+        plant->input = *_data;
+
+        return true;
+
+    }
+
+};
+
+
+class StaticPlant : public sim::StaticModel<StaticPlant, double> {
+
+public:
+
+    double input = 1.0;
+
+    void reset() { _data = 0.0; }
+
+    bool step(double, double timeStepSize) {
+
+        _data += (input - _data) * timeStepSize * 10.0;
+        return true;
+
+    }
+
+};
+
+
+class StaticController : public sim::StaticModel<StaticController, double> {
+
+public:
+
+    StaticPlant *plant = nullptr;
+    double integral = 0.0;
+
+    void reset() { _data = 0.0; integral = 0.0; }
+
+    bool step(double, double) {
+
+        double error = 1.0 - plant->getData();
+        integral += error * STEP_SIZE;
+        _data = 2.0 * error + 0.5 * integral;
+        plant->input = _data;
+
+        return true;
+
+    }
+
+};
+
+
+template<typename M>
+static void setup(M &model) {
+
+    model.create();
+    model.setTimeStepSize(STEP_SIZE);
+    model.initialize(0.0);
+
+}
+
+
+// reports the time per model step
+static void reportSteps(benchmark::State &state, size_t stepsPerIteration) {
+
+    state.counters["time_per_step"] = benchmark::Counter((double) stepsPerIteration,
+            benchmark::Counter::kIsIterationInvariantRate | benchmark::Counter::kInvert);
+
+}
+
+
+// many small models of the same type behind the model interface
+static void BM_VirtualDispatch(benchmark::State &state) {
+
+    std::vector<std::unique_ptr<VirtualPlant>> plants{};
+    std::vector<sim::ModelBase *> models{};
+    for(size_t i = 0; i < MODELS; ++i) {
+        plants.emplace_back(new VirtualPlant);
+        setup(*plants.back());
+        models.push_back(plants.back().get());
+    }
+
+    double time = 0.0;
+    for(auto _ : state) {
+
+        for(auto m : models)
+            benchmark::DoNotOptimize(m->simStep(time));
+
+        time += STEP_SIZE;
+
+    }
+
+    reportSteps(state, MODELS);
+
+}
+
+
+// the same models stepped statically
+static void BM_StaticDispatch(benchmark::State &state) {
+
+    std::vector<StaticPlant> plants(MODELS);
+    for(auto &p : plants)
+        setup(p);
+
+    double time = 0.0;
+    for(auto _ : state) {
+
+        for(auto &p : plants)
+            benchmark::DoNotOptimize(p.simStep(time));
+
+        time += STEP_SIZE;
+
+    }
+
+    reportSteps(state, MODELS);
+
+}
+
+
+// a closed loop of two models behind the model interface
+static void BM_VirtualLoop(benchmark::State &state) {
+
+    VirtualPlant plant{};
+    VirtualController controller{};
+    controller.plant = &plant;
+
+    setup(controller);
+    setup(plant);
+
+    std::vector<sim::ModelBase *> models{&controller, &plant};
+
+    double time = 0.0;
+    for(auto _ : state) {
+
+        for(auto m : models)
+            m->simStep(time);
+
+        time += STEP_SIZE;
+
+    }
+
+    benchmark::DoNotOptimize(plant.value());
+    reportSteps(state, 2);
+
+}
+
+
+// the same loop in a static model set
+static void BM_StaticLoop(benchmark::State &state) {
+
+    sim::StaticModelSet<StaticController, StaticPlant> set{};
+    set.get<StaticController>().plant = &set.get<StaticPlant>();
+
+    set.create();
+    set.forEach([](auto &model) { model.setTimeStepSize(STEP_SIZE); });
+    set.initialize(0.0);
+
+    double time = 0.0;
+    for(auto _ : state) {
+
+        set.simStep(time);
+        time += STEP_SIZE;
+
+    }
+
+    benchmark::DoNotOptimize(set.get<StaticPlant>().getData());
+    reportSteps(state, 2);
+
+}
+
+
+BENCHMARK(BM_VirtualDispatch);
+BENCHMARK(BM_StaticDispatch);
+BENCHMARK(BM_VirtualLoop);
+BENCHMARK(BM_StaticLoop);
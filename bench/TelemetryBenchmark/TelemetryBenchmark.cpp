@@ -0,0 +1,156 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <common/AllocationCounter.h>
+#include <proto/Models.pb.h>
+#include <telemetry/CommandInbox.h>
+#include <telemetry/InProcessBroker.h>
+#include <telemetry/Publisher.h>
+#include <chrono>
+#include <string>
+#include <vector>
+
+
+constexpr static const uint32_t VEHICLES = 1000;
+constexpr static const int STEPS = 100;
+
+
+// one iteration pushes 100 steps of 1000 vehicles and waits until all states are published
+static void BM_PublishThroughput(benchmark::State &state) {
+
+    telemetry::InProcessBroker broker(std::chrono::microseconds(state.range(2)));
+
+    telemetry::Publisher::Options options{};
+    options.partitions = (size_t) state.range(0);
+    options.maxBatch = (size_t) state.range(1);
+    options.maxPending = std::max<size_t>(options.maxPending, options.maxBatch);
+
+    telemetry::Publisher publisher(broker, options);
+
+    double time = 0.0;
+    for(auto _ : state) {
+
+        for(int k = 0; k < STEPS; ++k) {
+
+            for(uint32_t id = 0; id < VEHICLES; ++id)
+                publisher.push(id, time, models::State{0.0, time, 0.0});
+
+            time += 0.01;
+
+        }
+
+        publisher.flush();
+
+    }
+
+    auto s = publisher.statistics();
+    state.counters["published"] = benchmark::Counter((double) s.published, benchmark::Counter::kIsRate);
+    state.counters["messages"] = benchmark::Counter((double) s.messages, benchmark::Counter::kIsRate);
+    state.counters["lost"] = (double) (s.dropped + s.conflated) / (double) s.pushed;
+
+}
+
+
+// push latency of the simulation thread only
+static void BM_Push(benchmark::State &state) {
+
+    telemetry::InProcessBroker broker{};
+    telemetry::Publisher publisher(broker);
+
+    uint32_t id = 0;
+    for(auto _ : state)
+        benchmark::DoNotOptimize(publisher.push(id++ % VEHICLES, 0.0, models::State{}));
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// receive path of a command: parse the topic, decode the message and post it to the mailbox
+static void BM_ReceiveCommand(benchmark::State &state) {
+
+    telemetry::CommandInbox inbox(VEHICLES);
+
+    // serialized commands and topics of all vehicles
+    std::vector<std::string> topics{}, payloads{};
+    for(uint32_t id = 0; id < VEHICLES; ++id) {
+
+        simulation::models::VehicleInput input{};
+        input.set_pedal(0.001 * id);
+        input.set_id(id);
+
+        topics.push_back(inbox.topic(id));
+        payloads.push_back(input.SerializeAsString());
+
+    }
+
+    uint32_t id = 0;
+    auto start = bench::allocations();
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(inbox.receive(topics[id].c_str(), payloads[id].data(), payloads[id].size()));
+        id = (id + 1) % VEHICLES;
+    }
+
+    bench::reportAllocations(state, start);
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+// start of a tick: take the commands of the given percentage of the units
+static void BM_DrainCommands(benchmark::State &state) {
+
+    auto units = (size_t) state.range(0);
+    auto stride = (size_t) (100 / state.range(1));
+
+    telemetry::CommandInbox inbox(units);
+
+    double sum = 0.0;
+    for(auto _ : state) {
+
+        state.PauseTiming();
+        for(size_t i = 0; i < units; i += stride)
+            inbox.post(i, 0.5);
+        state.ResumeTiming();
+
+        inbox.drain([&sum](size_t, double pedal, std::chrono::microseconds) { sum += pedal; });
+
+    }
+
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * (int64_t) units);
+
+}
+
+
+// arguments: partitions, batch size, broker latency in us
+BENCHMARK(BM_PublishThroughput)
+    ->Args({0, 1, 0})->Args({0, 256, 0})->Args({10, 1, 0})->Args({10, 256, 0})->Args({10, 256, 200})
+    ->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_Push);
+BENCHMARK(BM_ReceiveCommand);
+
+// arguments: units, percentage of units with a command
+BENCHMARK(BM_DrainCommands)->Args({1000, 10})->Args({10000, 1})->Args({10000, 10})->Args({10000, 100});
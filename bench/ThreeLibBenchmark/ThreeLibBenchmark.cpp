@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <three/three.h>
+#include <vector>
+
+
+// one call through the C interface per element
+static void BM_PerElementAdd(benchmark::State &state) {
+
+    std::vector<double> a((size_t) state.range(0), 1.0);
+
+    for(auto _ : state) {
+
+        for(auto &e : a)
+            threelib::add(&e, 1e-9);
+
+        benchmark::ClobberMemory();
+
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * state.range(0));
+
+}
+
+
+// one call for the whole array
+static void BM_AddArray(benchmark::State &state) {
+
+    std::vector<double> a((size_t) state.range(0), 1.0);
+
+    for(auto _ : state) {
+
+        threelib::addArray(a.data(), a.size(), 1e-9);
+        benchmark::ClobberMemory();
+
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * state.range(0));
+
+}
+
+
+// contiguous array processed by the strided (non-SIMD) path
+static void BM_AddStrided(benchmark::State &state) {
+
+    std::vector<double> a((size_t) state.range(0), 1.0);
+
+    for(auto _ : state) {
+
+        threelib::addStrided(a.data(), a.size(), 1, 1e-9);
+        benchmark::ClobberMemory();
+
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * state.range(0));
+
+}
+
+
+static void BM_AxpyArray(benchmark::State &state) {
+
+    std::vector<double> y((size_t) state.range(0), 1.0);
+    std::vector<double> x((size_t) state.range(0), 2.0);
+
+    for(auto _ : state) {
+
+        threelib::axpyArray(y.data(), x.data(), y.size(), 1e-9);
+        benchmark::ClobberMemory();
+
+    }
+
+    state.SetItemsProcessed((int64_t) state.iterations() * state.range(0));
+
+}
+
+
+// large arrays split over the hardware threads
+static void BM_AxpyArrayParallel(benchmark::State &state) {
+
+    std::vector<double> y((size_t) state.range(0), 1.0);
+    std::vector<double> x((size_t) state.range(0), 2.0);
+
+    threelib::setThreads(0, (size_t) 1 << 16);
+
+    for(auto _ : state) {
+
+        threelib::axpyArray(y.data(), x.data(), y.size(), 1e-9);
+        benchmark::ClobberMemory();
+
+    }
+
+    threelib::setThreads(1, 0);
+
+    state.SetItemsProcessed((int64_t) state.iterations() * state.range(0));
+
+}
+
+
+// number of values
+BENCHMARK(BM_PerElementAdd)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_AddArray)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_AddStrided)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_AxpyArray)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_AxpyArrayParallel)->Arg(1 << 20)->Arg(1 << 23);
@@ -0,0 +1,167 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <simulation/TimeServer.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+
+template<typename Time>
+class BenchmarkModel : public sim::Model<double, Time> {
+
+public:
+
+    Time value{};
+
+    void reset() override {
+
+        value = Time{};
+
+    }
+
+    bool step(Time simTime, Time timeStepSize) override {
+
+        value += timeStepSize;
+        return true;
+
+    }
+
+};
+
+
+/**
+ * Creates the given number of models with mixed rates. The given share of models runs at 1 ms, the remaining models run
+ * at 10 ms and 100 ms in equal parts.
+ * @tparam Time Time type of the models
+ * @param n Number of models
+ * @param fastShare Share of the 1 ms models in percent
+ * @return Models
+ */
+template<typename Time>
+std::vector<std::unique_ptr<BenchmarkModel<Time>>> createModels(size_t n, size_t fastShare) {
+
+    std::vector<std::unique_ptr<BenchmarkModel<Time>>> models{};
+    for(size_t i = 0; i < n; ++i) {
+
+        // select rate
+        auto p = i % 100;
+        double stepSize = p < fastShare ? 0.001 : (p % 2 ? 0.01 : 0.1);
+
+        models.emplace_back(new BenchmarkModel<Time>);
+        models.back()->create();
+        models.back()->setTimeStepSize(sim::TimeTraits<Time>::fromSeconds(stepSize));
+        models.back()->initialize(Time{});
+
+    }
+
+    return models;
+
+}
+
+
+static void BM_Polling(benchmark::State &state) {
+
+    auto models = createModels<double>((size_t) state.range(0), (size_t) state.range(1));
+
+    unsigned long i = 0;
+    for(auto _ : state) {
+
+        double simTime = 0.001 * (double) i++;
+        for(auto &m : models)
+            benchmark::DoNotOptimize(m->simStep(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+static void BM_TimeServer(benchmark::State &state) {
+
+    auto models = createModels<double>((size_t) state.range(0), (size_t) state.range(1));
+
+    sim::TimeServer server{};
+    for(auto &m : models)
+        server.registerModel(m.get());
+
+    unsigned long i = 0;
+    for(auto _ : state) {
+
+        double simTime = 0.001 * (double) i++;
+        benchmark::DoNotOptimize(server.step(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+// the same with the integer time base
+static void BM_TickPolling(benchmark::State &state) {
+
+    auto models = createModels<sim::Ticks>((size_t) state.range(0), (size_t) state.range(1));
+
+    unsigned long i = 0;
+    for(auto _ : state) {
+
+        auto simTime = std::chrono::milliseconds(i++);
+        for(auto &m : models)
+            benchmark::DoNotOptimize(m->simStep(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+static void BM_TickTimeServer(benchmark::State &state) {
+
+    auto models = createModels<sim::Ticks>((size_t) state.range(0), (size_t) state.range(1));
+
+    sim::TickTimeServer server{};
+    for(auto &m : models)
+        server.registerModel(m.get());
+
+    unsigned long i = 0;
+    for(auto _ : state) {
+
+        auto simTime = std::chrono::milliseconds(i++);
+        benchmark::DoNotOptimize(server.step(simTime));
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+BENCHMARK(BM_Polling)->Args({1000, 33})->Args({10000, 33})->Args({10000, 5});
+BENCHMARK(BM_TimeServer)->Args({1000, 33})->Args({10000, 33})->Args({10000, 5});
+BENCHMARK(BM_TickPolling)->Args({1000, 33})->Args({10000, 33})->Args({10000, 5});
+BENCHMARK(BM_TickTimeServer)->Args({1000, 33})->Args({10000, 33})->Args({10000, 5});
@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <trace/Recorder.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+// one iteration records one sample of each signal (one simulation step at 1 kHz)
+static void BM_RecordStep(benchmark::State &state) {
+
+    auto signals = (size_t) state.range(0);
+    std::string path = "TraceBenchmark.trc";
+
+    trace::Recorder::Options options{};
+    options.compression = (trace::Compression) state.range(1);
+
+    if(!trace::Recorder::isSupported(options.compression)) {
+        state.SkipWithError("Compression is not supported.");
+        return;
+    }
+
+    {
+        trace::Recorder recorder(path, options);
+
+        std::vector<trace::Signal> handles{};
+        for(size_t i = 0; i < signals; ++i)
+            handles.push_back(recorder.addSignal("signal-" + std::to_string(i)));
+
+        double time = 0.0;
+        for(auto _ : state) {
+
+            for(size_t i = 0; i < signals; ++i)
+                handles[i].record(time, time * (double) i);
+
+            time += 0.001;
+
+        }
+
+        recorder.close();
+
+        state.counters["stalls"] = (double) recorder.stalls();
+
+    }
+
+    std::remove(path.c_str());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+// one iteration records one sample of each signal, paced to 1 kHz real time (the target load of the recorder)
+static void BM_RecordPaced(benchmark::State &state) {
+
+    typedef std::chrono::steady_clock Clock;
+
+    auto signals = (size_t) state.range(0);
+    std::string path = "TraceBenchmark.trc";
+
+    double maxStep = 0.0;
+
+    {
+        trace::Recorder recorder(path);
+
+        std::vector<trace::Signal> handles{};
+        for(size_t i = 0; i < signals; ++i)
+            handles.push_back(recorder.addSignal("signal-" + std::to_string(i)));
+
+        double time = 0.0;
+        auto next = Clock::now();
+        for(auto _ : state) {
+
+            auto start = Clock::now();
+
+            for(size_t i = 0; i < signals; ++i)
+                handles[i].record(time, time * (double) i);
+
+            auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            state.SetIterationTime(elapsed);
+            maxStep = std::max(maxStep, elapsed);
+
+            // wait for the next step
+            time += 0.001;
+            next += std::chrono::milliseconds(1);
+            std::this_thread::sleep_until(next);
+
+        }
+
+        recorder.close();
+
+        state.counters["stalls"] = (double) recorder.stalls();
+
+    }
+
+    std::remove(path.c_str());
+    state.counters["max_step_us"] = maxStep * 1e6;
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+
+}
+
+
+// arguments: number of signals, compression
+BENCHMARK(BM_RecordStep)->ArgsProduct({{100, 10000}, {0, 1}})->Unit(benchmark::kMicrosecond);
+
+// arguments: number of signals
+BENCHMARK(BM_RecordPaced)->Arg(1000)->Arg(10000)->Iterations(2000)->UseManualTime()->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,113 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <benchmark/benchmark.h>
+#include <remote/UnitRegistry.h>
+#include <memory>
+#include <unordered_map>
+
+
+// the allocated bytes of a standard map (nodes and buckets, approximated)
+template<typename Map>
+static size_t approximateMemoryUsage(const Map &map) {
+
+    return map.size() * (sizeof(typename Map::value_type) + 2 * sizeof(void *)) + map.bucket_count() * sizeof(void *);
+
+}
+
+
+static void BM_UnitRegistry(benchmark::State &state) {
+
+    auto n = (uint32_t) state.range(0);
+
+    remote::UnitRegistry units;
+    size_t memory = 0;
+
+    for(auto _ : state) {
+
+        for(uint32_t id = 0; id < n; ++id)
+            benchmark::DoNotOptimize(units.create(id));
+
+        memory = units.memoryUsage();
+
+        for(uint32_t id = 0; id < n; ++id)
+            units.destroy(id);
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["bytes_per_unit"] = (double) memory / n;
+    state.counters["unit_size"] = (double) sizeof(remote::Unit);
+    state.counters["controller_size"] = (double) sizeof(PID_controller);
+
+}
+
+
+static void BM_UnorderedMap(benchmark::State &state) {
+
+    auto n = (uint32_t) state.range(0);
+
+    std::unordered_map<uint32_t, std::unique_ptr<remote::Unit>> units;
+    size_t memory = 0;
+
+    for(auto _ : state) {
+
+        for(uint32_t id = 0; id < n; ++id)
+            benchmark::DoNotOptimize(units.emplace(id, std::unique_ptr<remote::Unit>(new remote::Unit)));
+
+        memory = approximateMemoryUsage(units) + units.size() * sizeof(remote::Unit);
+
+        for(uint32_t id = 0; id < n; ++id)
+            units.erase(id);
+
+    }
+
+    state.SetItemsProcessed(state.iterations() * n);
+    state.counters["bytes_per_unit"] = (double) memory / n;
+
+}
+
+
+static void BM_UnitRegistryLookup(benchmark::State &state) {
+
+    auto n = (uint32_t) state.range(0);
+
+    remote::UnitRegistry units;
+    for(uint32_t id = 0; id < n; ++id)
+        units.create(id * 7919u);
+
+    uint32_t i = 0;
+    for(auto _ : state) {
+        benchmark::DoNotOptimize(units.find((i % n) * 7919u));
+        i++;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+
+}
+
+
+BENCHMARK(BM_UnitRegistry)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_UnorderedMap)->RangeMultiplier(10)->Range(1000, 1000000);
+BENCHMARK(BM_UnitRegistryLookup)->RangeMultiplier(10)->Range(1000, 1000000);
@@ -0,0 +1,224 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "AllocationCounter.h"
+
+
+//!< The number of heap allocations of the process
+static std::atomic<unsigned long> allocationCount{0};
+
+
+//!< Allocates the memory and counts the allocation, returns nullptr if no memory is available
+static void *allocate(size_t size) noexcept {
+
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+
+}
+
+
+//!< Allocates the memory and counts the allocation, throws if no memory is available
+static void *allocateOrThrow(size_t size) {
+
+    if(void *ptr = allocate(size))
+        return ptr;
+
+    throw std::bad_alloc();
+
+}
+
+
+namespace bench {
+
+
+    unsigned long allocations() {
+
+        return allocationCount.load(std::memory_order_relaxed);
+
+    }
+
+
+    void reportAllocations(benchmark::State &state, unsigned long start) {
+
+        state.counters["allocs_per_iter"] = (double) (allocations() - start) / (double) state.iterations();
+
+    }
+
+}
+
+
+// scalar and array forms
+
+void *operator new(size_t size) {
+
+    return allocateOrThrow(size);
+
+}
+
+void *operator new[](size_t size) {
+
+    return allocateOrThrow(size);
+
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+
+    return allocate(size);
+
+}
+
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+
+    return allocate(size);
+
+}
+
+void operator delete(void *ptr) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete[](void *ptr) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete[](void *ptr, size_t) noexcept {
+
+    std::free(ptr);
+
+}
+
+
+#ifdef __cpp_aligned_new
+
+// aligned forms (C++17)
+
+//!< Allocates aligned memory and counts the allocation, returns nullptr if no memory is available
+static void *allocateAligned(size_t size, std::align_val_t alignment) noexcept {
+
+    auto align = std::max(sizeof(void *), (size_t) alignment);
+
+    void *ptr = nullptr;
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+    return posix_memalign(&ptr, align, size == 0 ? 1 : size) == 0 ? ptr : nullptr;
+
+}
+
+//!< Allocates aligned memory and counts the allocation, throws if no memory is available
+static void *allocateAlignedOrThrow(size_t size, std::align_val_t alignment) {
+
+    if(void *ptr = allocateAligned(size, alignment))
+        return ptr;
+
+    throw std::bad_alloc();
+
+}
+
+void *operator new(size_t size, std::align_val_t alignment) {
+
+    return allocateAlignedOrThrow(size, alignment);
+
+}
+
+void *operator new[](size_t size, std::align_val_t alignment) {
+
+    return allocateAlignedOrThrow(size, alignment);
+
+}
+
+void *operator new(size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+
+    return allocateAligned(size, alignment);
+
+}
+
+void *operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept {
+
+    return allocateAligned(size, alignment);
+
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete(void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete[](void *ptr, std::align_val_t, const std::nothrow_t &) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+
+    std::free(ptr);
+
+}
+
+void operator delete[](void *ptr, size_t, std::align_val_t) noexcept {
+
+    std::free(ptr);
+
+}
+
+#endif
@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_ALLOCATIONCOUNTER_H
+#define DUMMYPROJECT_ALLOCATIONCOUNTER_H
+
+#include <benchmark/benchmark.h>
+
+namespace bench {
+
+
+    /**
+     * @brief Returns the number of heap allocations of the process.
+     *
+     * A benchmark counts the allocations by compiling AllocationCounter.cpp into its executable, which replaces the
+     * global operator new and delete in all forms (scalar, array, nothrow, sized and aligned). The allocations of all
+     * threads and of linked shared libraries are counted.
+     *
+     * @return Number of allocations since the start of the process
+     */
+    unsigned long allocations();
+
+
+    /**
+     * Reports the heap allocations per iteration since the given count as counter "allocs_per_iter"
+     * @param state Benchmark state
+     * @param start Number of allocations before the benchmark loop (@see allocations())
+     */
+    void reportAllocations(benchmark::State &state, unsigned long start);
+
+}
+
+#endif //DUMMYPROJECT_ALLOCATIONCOUNTER_H
@@ -0,0 +1,69 @@
+# ------------------------------------------------------------------------------
+# Benchmarking
+#
+# * Include this file when benchmarks are enabled
+# * Put your benchmarks in the root/bench folder
+# * add a CMakeLists.txt and use add_gbenchmark(...) macro
+# * build the target run_benchmarks to run all benchmarks, the results are
+#   written as JSON to BENCHMARK_OUTPUT_DIR (one file per benchmark)
+# ------------------------------------------------------------------------------
+
+# options
+set(BENCHMARK_OUTPUT_DIR "${CMAKE_BINARY_DIR}/benchmarks" CACHE PATH "Output directory of the benchmark results")
+set(BENCHMARK_FILTER "." CACHE STRING "Regular expression of the benchmarks to be run by run_benchmarks")
+
+# define macro
+macro(add_gbenchmark BENCHNAME)
+
+    # link library
+    target_link_libraries(${BENCHNAME} PRIVATE benchmark::benchmark_main)
+    set_target_properties(${BENCHNAME} PROPERTIES FOLDER "Benchmarks")
+
+    # register for run_benchmarks
+    set_property(GLOBAL APPEND PROPERTY DUMMY_BENCHMARK_TARGETS ${BENCHNAME})
+
+endmacro()
+
+
+# message
+message(STATUS "Benchmarking (google benchmark) enabled")
+
+# find google benchmark (--benchmark_context requires version 1.6)
+find_package(benchmark 1.6 REQUIRED)
+
+# add benchmark folder
+add_subdirectory(${PROJECT_SOURCE_DIR}/bench)
+
+
+# revision to be stored with the results
+find_package(Git QUIET)
+if(GIT_FOUND)
+    execute_process(COMMAND ${GIT_EXECUTABLE} rev-parse --short HEAD
+            WORKING_DIRECTORY ${PROJECT_SOURCE_DIR}
+            OUTPUT_VARIABLE BENCHMARK_REVISION
+            OUTPUT_STRIP_TRAILING_WHITESPACE
+            ERROR_QUIET)
+endif(GIT_FOUND)
+
+# one command per benchmark
+get_property(BENCHMARK_TARGETS GLOBAL PROPERTY DUMMY_BENCHMARK_TARGETS)
+set(BENCHMARK_COMMANDS)
+foreach(BENCHNAME ${BENCHMARK_TARGETS})
+    list(APPEND BENCHMARK_COMMANDS COMMAND $<TARGET_FILE:${BENCHNAME}>
+            --benchmark_filter=${BENCHMARK_FILTER}
+            --benchmark_out=${BENCHMARK_OUTPUT_DIR}/${BENCHNAME}.json
+            --benchmark_out_format=json
+            --benchmark_context=version=${PROJECT_VERSION}
+            --benchmark_context=revision=${BENCHMARK_REVISION}
+            --benchmark_context=build_type=${CMAKE_BUILD_TYPE})
+endforeach()
+
+# run all benchmarks
+file(MAKE_DIRECTORY ${BENCHMARK_OUTPUT_DIR})
+add_custom_target(run_benchmarks
+        ${BENCHMARK_COMMANDS}
+        DEPENDS ${BENCHMARK_TARGETS}
+        WORKING_DIRECTORY ${BENCHMARK_OUTPUT_DIR}
+        COMMENT "Running benchmarks, results are written to ${BENCHMARK_OUTPUT_DIR}"
+        USES_TERMINAL
+        VERBATIM)
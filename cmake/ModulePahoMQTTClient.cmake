@@ -5,6 +5,7 @@ set(PAHO_MQTTPP3_INCLUDE_DIR ${PAHO_MQTT3C_INCLUDE_DIR})
 # searching for library file
 find_library(PAHO_MQTT3C_LIBRARY paho-mqtt3c)
 find_library(PAHO_MQTTPP3_LIBRARY paho-mqttpp3)
+find_library(PAHO_MQTT3A_LIBRARY paho-mqtt3a)
 
 if (PAHO_MQTT3C_INCLUDE_DIR AND PAHO_MQTT3C_LIBRARY)
 
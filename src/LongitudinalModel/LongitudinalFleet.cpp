@@ -0,0 +1,296 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include "LongitudinalFleet.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define LONGITUDINALFLEET_X86_SIMD
+#include <immintrin.h>
+#endif
+
+namespace models {
+
+
+    /**
+     * Scalar kernel, same calculation as LongitudinalModel::modelStep()
+     */
+    static void stepScalar(const double *mass, const double *maxTorque, const double *airDragParam,
+            const double *rhoAir, const double *input, double *a, double *v, double *s, double delta_t,
+            size_t begin, size_t end) {
+
+        for(size_t i = begin; i < end; ++i) {
+
+            double torque = input[i] * maxTorque[i];
+            double airDrag = 0.5 * rhoAir[i] * airDragParam[i] * v[i] * v[i];
+            double driveForce = 4.0 * torque / 0.3;
+
+            // calculate dynamics
+            a[i] = (driveForce - airDrag) / mass[i];
+            double ds = std::max(0.0, 0.5 * a[i] * delta_t + v[i] * delta_t);
+
+            // update system
+            s[i] += ds;
+            v[i] += a[i] * delta_t;
+            v[i] = std::max(0.0, v[i]);
+
+        }
+
+    }
+
+
+#ifdef LONGITUDINALFLEET_X86_SIMD
+
+    /**
+     * AVX2 kernel (four vehicles per instruction), same order of operations as the scalar kernel
+     */
+    __attribute__((target("avx2")))
+    static void stepAVX2(const double *mass, const double *maxTorque, const double *airDragParam,
+            const double *rhoAir, const double *input, double *a, double *v, double *s, double delta_t,
+            size_t begin, size_t end) {
+
+        const __m256d zero = _mm256_setzero_pd();
+        const __m256d half = _mm256_set1_pd(0.5);
+        const __m256d four = _mm256_set1_pd(4.0);
+        const __m256d radius = _mm256_set1_pd(0.3);
+        const __m256d dt = _mm256_set1_pd(delta_t);
+
+        size_t i = begin;
+        for(; i + 4 <= end; i += 4) {
+
+            __m256d vi = _mm256_loadu_pd(v + i);
+
+            // torque = input * maxTorque
+            __m256d torque = _mm256_mul_pd(_mm256_loadu_pd(input + i), _mm256_loadu_pd(maxTorque + i));
+
+            // airDrag = 0.5 * rhoAir * airDragParam * v * v
+            __m256d airDrag = _mm256_mul_pd(half, _mm256_loadu_pd(rhoAir + i));
+            airDrag = _mm256_mul_pd(airDrag, _mm256_loadu_pd(airDragParam + i));
+            airDrag = _mm256_mul_pd(airDrag, vi);
+            airDrag = _mm256_mul_pd(airDrag, vi);
+
+            // driveForce = 4.0 * torque / 0.3
+            __m256d driveForce = _mm256_div_pd(_mm256_mul_pd(four, torque), radius);
+
+            // a = (driveForce - airDrag) / mass
+            __m256d ai = _mm256_div_pd(_mm256_sub_pd(driveForce, airDrag), _mm256_loadu_pd(mass + i));
+
+            // ds = max(0.0, 0.5 * a * dt + v * dt)
+            __m256d ds = _mm256_add_pd(_mm256_mul_pd(_mm256_mul_pd(half, ai), dt), _mm256_mul_pd(vi, dt));
+            ds = _mm256_max_pd(ds, zero);
+
+            // s += ds, v = max(0.0, v + a * dt)
+            _mm256_storeu_pd(s + i, _mm256_add_pd(_mm256_loadu_pd(s + i), ds));
+            _mm256_storeu_pd(v + i, _mm256_max_pd(_mm256_add_pd(vi, _mm256_mul_pd(ai, dt)), zero));
+            _mm256_storeu_pd(a + i, ai);
+
+        }
+
+        // remaining vehicles
+        stepScalar(mass, maxTorque, airDragParam, rhoAir, input, a, v, s, delta_t, i, end);
+
+    }
+
+#endif
+
+
+    LongitudinalFleet::LongitudinalFleet() : _kernel(Kernel::SCALAR) {
+
+        // select fastest kernel
+        setKernel(Kernel::AVX2);
+
+    }
+
+
+    size_t LongitudinalFleet::add(const Parameters &parameters, const State &state) {
+
+        _mass.push_back(parameters.mass);
+        _maxTorque.push_back(parameters.maxTorque);
+        _airDragParam.push_back(parameters.airDragParam);
+        _rhoAir.push_back(parameters.rhoAir);
+
+        _input.push_back(0.0);
+
+        _a.push_back(state.a);
+        _v.push_back(state.v);
+        _s.push_back(state.s);
+
+        return _mass.size() - 1;
+
+    }
+
+
+    void LongitudinalFleet::reserve(size_t n) {
+
+        for(auto vec : {&_mass, &_maxTorque, &_airDragParam, &_rhoAir, &_input, &_a, &_v, &_s})
+            vec->reserve(n);
+
+    }
+
+
+    size_t LongitudinalFleet::size() const {
+
+        return _mass.size();
+
+    }
+
+
+    void LongitudinalFleet::setInput(size_t index, double input) {
+
+        _input.at(index) = input;
+
+    }
+
+
+    double *LongitudinalFleet::inputs() {
+
+        return _input.data();
+
+    }
+
+
+    const double *LongitudinalFleet::inputs() const {
+
+        return _input.data();
+
+    }
+
+
+    State LongitudinalFleet::getState(size_t index) const {
+
+        return State{_a.at(index), _v.at(index), _s.at(index)};
+
+    }
+
+
+    void LongitudinalFleet::setState(size_t index, const State &state) {
+
+        _a.at(index) = state.a;
+        _v.at(index) = state.v;
+        _s.at(index) = state.s;
+
+    }
+
+
+    Parameters LongitudinalFleet::getParameters(size_t index) const {
+
+        return Parameters{_mass.at(index), _maxTorque.at(index), _airDragParam.at(index), _rhoAir.at(index)};
+
+    }
+
+
+    void LongitudinalFleet::setParameters(size_t index, const Parameters &parameters) {
+
+        _mass.at(index) = parameters.mass;
+        _maxTorque.at(index) = parameters.maxTorque;
+        _airDragParam.at(index) = parameters.airDragParam;
+        _rhoAir.at(index) = parameters.rhoAir;
+
+    }
+
+
+    const double *LongitudinalFleet::accelerations() const {
+
+        return _a.data();
+
+    }
+
+
+    const double *LongitudinalFleet::velocities() const {
+
+        return _v.data();
+
+    }
+
+
+    const double *LongitudinalFleet::distances() const {
+
+        return _s.data();
+
+    }
+
+
+    LongitudinalFleet::Kernel LongitudinalFleet::getKernel() const {
+
+        return _kernel;
+
+    }
+
+
+    bool LongitudinalFleet::setKernel(Kernel kernel) {
+
+        if(!isSupported(kernel))
+            return false;
+
+        _kernel = kernel;
+        return true;
+
+    }
+
+
+    bool LongitudinalFleet::isSupported(Kernel kernel) {
+
+        switch(kernel) {
+            case Kernel::SCALAR:
+                return true;
+            case Kernel::AVX2:
+#ifdef LONGITUDINALFLEET_X86_SIMD
+                return __builtin_cpu_supports("avx2");
+#else
+                return false;
+#endif
+        }
+
+        return false;
+
+    }
+
+
+    void LongitudinalFleet::step(double delta_t) {
+
+        step(delta_t, 0, size());
+
+    }
+
+
+    void LongitudinalFleet::step(double delta_t, size_t begin, size_t end) {
+
+        // check range
+        if(begin > end || end > size())
+            throw std::out_of_range("Invalid range of vehicles.");
+
+#ifdef LONGITUDINALFLEET_X86_SIMD
+        if(_kernel == Kernel::AVX2) {
+            stepAVX2(_mass.data(), _maxTorque.data(), _airDragParam.data(), _rhoAir.data(), _input.data(),
+                    _a.data(), _v.data(), _s.data(), delta_t, begin, end);
+            return;
+        }
+#endif
+
+        stepScalar(_mass.data(), _maxTorque.data(), _airDragParam.data(), _rhoAir.data(), _input.data(),
+                _a.data(), _v.data(), _s.data(), delta_t, begin, end);
+
+    }
+
+}
@@ -0,0 +1,224 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_LONGITUDINALFLEET_H
+#define DUMMYPROJECT_LONGITUDINALFLEET_H
+
+#include <memory/AlignedAllocator.h>
+#include "LongitudinalModel.h"
+
+namespace models {
+
+
+    /**
+     * @brief A fleet of longitudinal vehicle models, which are stepped all at once.
+     *
+     * The parameters, inputs and states of the vehicles are stored as structure of arrays, so that the vehicles can be
+     * stepped with vectorized (SIMD) kernels. The calculation is the same as in LongitudinalModel::modelStep() in the same
+     * order of operations, so the results are identical to the scalar model (as long as the compiler does not contract
+     * the operations of the scalar model to fused multiply-adds).
+     */
+    class LongitudinalFleet {
+
+    public:
+
+        //!< Implementation of the step calculation
+        enum class Kernel {SCALAR, AVX2};
+
+
+    protected:
+
+        // system parameters
+        memory::AlignedVector<double> _mass{};
+        memory::AlignedVector<double> _maxTorque{};
+        memory::AlignedVector<double> _airDragParam{};
+        memory::AlignedVector<double> _rhoAir{};
+
+        // inputs
+        memory::AlignedVector<double> _input{};
+
+        // system states
+        memory::AlignedVector<double> _a{};
+        memory::AlignedVector<double> _v{};
+        memory::AlignedVector<double> _s{};
+
+        // kernel
+        Kernel _kernel;
+
+
+    public:
+
+
+        /**
+         * Constructor. Selects the fastest kernel supported by the CPU.
+         */
+        LongitudinalFleet();
+
+
+        /**
+         * Destructor
+         */
+        virtual ~LongitudinalFleet() = default;
+
+
+        /**
+         * Adds a vehicle to the fleet
+         * @param parameters Parameters of the vehicle
+         * @param state Initial state of the vehicle
+         * @return Index of the vehicle
+         */
+        size_t add(const Parameters &parameters = Parameters{}, const State &state = State{});
+
+
+        /**
+         * Reserves memory for the given number of vehicles
+         * @param n Number of vehicles
+         */
+        void reserve(size_t n);
+
+
+        /**
+         * Returns the number of vehicles
+         * @return Number of vehicles
+         */
+        size_t size() const;
+
+
+        /**
+         * Sets the input (pedal value) of a vehicle
+         * @param index Index of the vehicle
+         * @param input Input
+         */
+        void setInput(size_t index, double input);
+
+
+        /**
+         * Returns the inputs (pedal values) of all vehicles to be written directly
+         * @return Pointer to the inputs
+         */
+        double *inputs();
+
+
+        /**
+         * Returns the inputs (pedal values) of all vehicles
+         * @return Pointer to the inputs
+         */
+        const double *inputs() const;
+
+
+        /**
+         * Returns the state of a vehicle
+         * @param index Index of the vehicle
+         * @return State
+         */
+        State getState(size_t index) const;
+
+
+        /**
+         * Sets the state of a vehicle
+         * @param index Index of the vehicle
+         * @param state State
+         */
+        void setState(size_t index, const State &state);
+
+
+        /**
+         * Returns the parameters of a vehicle
+         * @param index Index of the vehicle
+         * @return Parameters
+         */
+        Parameters getParameters(size_t index) const;
+
+
+        /**
+         * Sets the parameters of a vehicle
+         * @param index Index of the vehicle
+         * @param parameters Parameters
+         */
+        void setParameters(size_t index, const Parameters &parameters);
+
+
+        /**
+         * Returns the accelerations of all vehicles
+         * @return Pointer to the accelerations
+         */
+        const double *accelerations() const;
+
+
+        /**
+         * Returns the velocities of all vehicles
+         * @return Pointer to the velocities
+         */
+        const double *velocities() const;
+
+
+        /**
+         * Returns the distances of all vehicles
+         * @return Pointer to the distances
+         */
+        const double *distances() const;
+
+
+        /**
+         * Returns the kernel used for the step calculation
+         * @return Kernel
+         */
+        Kernel getKernel() const;
+
+
+        /**
+         * Sets the kernel used for the step calculation
+         * @param kernel Kernel
+         * @return Flag indicating whether the kernel is supported by the CPU (otherwise the kernel is not changed)
+         */
+        bool setKernel(Kernel kernel);
+
+
+        /**
+         * Returns true, if the kernel is supported by the CPU
+         * @param kernel Kernel
+         * @return Support flag
+         */
+        static bool isSupported(Kernel kernel);
+
+
+        /**
+         * Steps all vehicles with their actual inputs (@see LongitudinalModel::modelStep())
+         * @param delta_t Time step size
+         */
+        void step(double delta_t);
+
+
+        /**
+         * Steps the vehicles in the given range with their actual inputs
+         * @param delta_t Time step size
+         * @param begin First index
+         * @param end End index (excluded)
+         */
+        void step(double delta_t, size_t begin, size_t end);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_LONGITUDINALFLEET_H
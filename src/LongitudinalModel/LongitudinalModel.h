@@ -27,6 +27,7 @@
 #define DUMMYPROJECT_LONGITUDINALMODEL_H
 
 #include <algorithm>
+#include <solver/Solver.h>
 
 
 namespace models {
@@ -38,6 +39,14 @@ namespace models {
     };
 
 
+    struct Parameters {
+        double mass = 1300.0;
+        double maxTorque = 5000.0;
+        double airDragParam = 0.6;
+        double rhoAir = 1.2041;
+    };
+
+
     class LongitudinalModel {
 
     protected:
@@ -49,7 +58,35 @@ namespace models {
         double rhoAir = 1.2041;
 
         // system state
-        State state;
+        State state{};
+
+
+        /**
+         * @brief Dynamics of the model with the state vector (s, v) for the integration with a solver
+         */
+        class Dynamics : public solver::System {
+
+            const LongitudinalModel &_model;
+            double _input;
+
+        public:
+
+            Dynamics(const LongitudinalModel &model, double input) : _model(model), _input(input) {}
+
+            size_t size() const override {
+
+                return 2;
+
+            }
+
+            void derivatives(double, const double *x, double *dxdt) const override {
+
+                dxdt[0] = std::max(0.0, x[1]);
+                dxdt[1] = _model.acceleration(_input, x[1]);
+
+            }
+
+        };
 
 
     public:
@@ -75,12 +112,73 @@ namespace models {
 
         }
 
+
+        /**
+         * Integrates the dynamics over the time step with the given solver. In contrast to the fixed scheme of
+         * modelStep(input, delta_t), which is first order in the velocity, a higher order or adaptive solver allows much
+         * larger time steps at the same accuracy. The acceleration of the state is the one at the end of the step.
+         * @param input Input (pedal value)
+         * @param delta_t Time step
+         * @param solver Solver to be used
+         */
+        void modelStep(double input, double delta_t, solver::Solver &solver) {
+
+            double x[2] = {state.s, state.v};
+            solver.integrate(Dynamics(*this, input), 0.0, delta_t, x);
+
+            // update system
+            state.s = x[0];
+            state.v = std::max(0.0, x[1]);
+            state.a = acceleration(input, state.v);
+
+        }
+
+
+        /**
+         * Calculates the acceleration for the given input and velocity. The vehicle does not roll backwards, so the
+         * acceleration is not negative at standstill.
+         * @param input Input (pedal value)
+         * @param v Velocity
+         * @return Acceleration
+         */
+        double acceleration(double input, double v) const {
+
+            double torque = input * maxTorque;
+            double airDrag = 0.5 * rhoAir * airDragParam * v * v;
+            double driveForce = 4.0 * torque / 0.3;
+
+            double a = (driveForce - airDrag) / mass;
+            return v <= 0.0 ? std::max(0.0, a) : a;
+
+        }
+
         State getState() const {
 
             return state;
 
         }
 
+        void setState(const State &s) {
+
+            state = s;
+
+        }
+
+        Parameters getParameters() const {
+
+            return Parameters{mass, maxTorque, airDragParam, rhoAir};
+
+        }
+
+        void setParameters(const Parameters &parameters) {
+
+            mass = parameters.mass;
+            maxTorque = parameters.maxTorque;
+            airDragParam = parameters.airDragParam;
+            rhoAir = parameters.rhoAir;
+
+        }
+
     };
 
 }
@@ -0,0 +1,132 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_ALIGNEDALLOCATOR_H
+#define DUMMYPROJECT_ALIGNEDALLOCATOR_H
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+namespace memory {
+
+
+    /**
+     * An allocator providing memory aligned to the given boundary (e.g. for SIMD loads and stores or to avoid false
+     * sharing of cache lines)
+     * @tparam T Value type
+     * @tparam Alignment Alignment in bytes (power of two, at least the size of a pointer)
+     */
+    template<typename T, size_t Alignment = 64>
+    class AlignedAllocator {
+
+    public:
+
+        typedef T value_type;
+
+        template<typename U>
+        struct rebind {
+            typedef AlignedAllocator<U, Alignment> other;
+        };
+
+
+        /**
+         * Constructor
+         */
+        AlignedAllocator() = default;
+
+
+        /**
+         * Copy constructor for other value types
+         */
+        template<typename U>
+        explicit AlignedAllocator(const AlignedAllocator<U, Alignment> &) {}
+
+
+        /**
+         * Allocates aligned memory for n elements
+         * @param n Number of elements
+         * @return Pointer to the memory
+         */
+        T *allocate(size_t n) {
+
+            if(n == 0)
+                return nullptr;
+
+            void *ptr = nullptr;
+
+#ifdef _WIN32
+            ptr = _aligned_malloc(n * sizeof(T), Alignment);
+#else
+            if(posix_memalign(&ptr, Alignment, n * sizeof(T)) != 0)
+                ptr = nullptr;
+#endif
+
+            if(ptr == nullptr)
+                throw std::bad_alloc();
+
+            return static_cast<T *>(ptr);
+
+        }
+
+
+        /**
+         * Frees the memory
+         * @param ptr Pointer to the memory
+         */
+        void deallocate(T *ptr, size_t) {
+
+#ifdef _WIN32
+            _aligned_free(ptr);
+#else
+            free(ptr);
+#endif
+
+        }
+
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment> &) const {
+            return true;
+        }
+
+
+        template<typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment> &) const {
+            return false;
+        }
+
+    };
+
+
+    //!< A vector with aligned memory
+    template<typename T, size_t Alignment = 64>
+    using AlignedVector = std::vector<T, AlignedAllocator<T, Alignment>>;
+
+}
+
+#endif //DUMMYPROJECT_ALIGNEDALLOCATOR_H
@@ -0,0 +1,326 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_FLATHASHMAP_H
+#define DUMMYPROJECT_FLATHASHMAP_H
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace memory {
+
+
+    /**
+     * @brief A hash map with open addressing and linear probing.
+     *
+     * All entries are stored in one flat array, so a lookup touches one or a few adjacent cache lines and inserting or
+     * erasing an entry allocates no memory (except when the map grows). The capacity is a power of two and the map
+     * grows at a load factor of 7/8. Erased entries are removed by shifting the following entries of the probe sequence
+     * back (no tombstones). Pointers to values are invalidated by insert() and erase().
+     *
+     * @tparam Key Key type
+     * @tparam Value Value type (default constructible)
+     * @tparam Hash Hash function of the keys
+     */
+    template<typename Key, typename Value, typename Hash = std::hash<Key>>
+    class FlatHashMap {
+
+    protected:
+
+        //!< An entry of the map
+        struct Entry {
+            Key key{};                              //!< The key
+            Value value{};                          //!< The value
+        };
+
+        std::vector<Entry> _entries{};              //!< The entries
+        std::vector<uint8_t> _used{};               //!< Flags indicating used entries
+        size_t _size = 0;                           //!< Number of used entries
+        size_t _mask = 0;                           //!< Capacity - 1
+        Hash _hash{};                               //!< The hash function
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param capacity Initial capacity
+         */
+        explicit FlatHashMap(size_t capacity = 16) {
+
+            rehash(capacity);
+
+        }
+
+
+        /**
+         * Returns the number of entries
+         * @return Number of entries
+         */
+        size_t size() const {
+
+            return _size;
+
+        }
+
+
+        /**
+         * Returns the number of slots
+         * @return Capacity
+         */
+        size_t capacity() const {
+
+            return _entries.size();
+
+        }
+
+
+        /**
+         * Returns the memory allocated by the map
+         * @return Memory in bytes
+         */
+        size_t memoryUsage() const {
+
+            return _entries.capacity() * sizeof(Entry) + _used.capacity();
+
+        }
+
+
+        /**
+         * Reserves slots for the given number of entries
+         * @param n Number of entries
+         */
+        void reserve(size_t n) {
+
+            if(n + n / 7 > capacity())
+                rehash(n + n / 7 + 1);
+
+        }
+
+
+        /**
+         * Removes all entries (the capacity is kept)
+         */
+        void clear() {
+
+            for(size_t i = 0; i < _entries.size(); ++i) {
+                if(_used[i])
+                    _entries[i] = Entry{};
+            }
+
+            std::fill(_used.begin(), _used.end(), 0);
+            _size = 0;
+
+        }
+
+
+        /**
+         * Returns the value of the key
+         * @param key Key
+         * @return Pointer to the value (nullptr, if the key does not exist)
+         */
+        Value *find(const Key &key) {
+
+            auto i = index(key);
+            return i == npos() ? nullptr : &_entries[i].value;
+
+        }
+
+
+        /**
+         * Returns the value of the key
+         * @param key Key
+         * @return Pointer to the value (nullptr, if the key does not exist)
+         */
+        const Value *find(const Key &key) const {
+
+            auto i = index(key);
+            return i == npos() ? nullptr : &_entries[i].value;
+
+        }
+
+
+        /**
+         * Returns whether the key exists
+         * @param key Key
+         * @return Flag
+         */
+        bool contains(const Key &key) const {
+
+            return index(key) != npos();
+
+        }
+
+
+        /**
+         * Inserts the value, if the key does not exist
+         * @param key Key
+         * @param value Value
+         * @return Pointer to the value of the key and flag indicating whether the value was inserted
+         */
+        std::pair<Value *, bool> insert(const Key &key, Value value) {
+
+            // grow at a load factor of 7/8
+            if((_size + 1) * 8 > capacity() * 7)
+                rehash(capacity() * 2);
+
+            // probe for the key or a free slot
+            for(size_t i = slot(key); ; i = (i + 1) & _mask) {
+
+                if(!_used[i]) {
+                    _entries[i].key = key;
+                    _entries[i].value = std::move(value);
+                    _used[i] = 1;
+                    _size++;
+                    return {&_entries[i].value, true};
+                }
+
+                if(_entries[i].key == key)
+                    return {&_entries[i].value, false};
+
+            }
+
+        }
+
+
+        /**
+         * Erases the key
+         * @param key Key
+         * @return Flag indicating whether the key existed
+         */
+        bool erase(const Key &key) {
+
+            auto i = index(key);
+            if(i == npos())
+                return false;
+
+            // shift the following entries of the probe sequence back
+            for(size_t j = (i + 1) & _mask; _used[j]; j = (j + 1) & _mask) {
+
+                // the entry can be moved to the gap, if its home slot is not within (i, j]
+                auto home = slot(_entries[j].key);
+                if(((j - home) & _mask) >= ((j - i) & _mask)) {
+                    _entries[i] = std::move(_entries[j]);
+                    i = j;
+                }
+
+            }
+
+            _entries[i] = Entry{};
+            _used[i] = 0;
+            _size--;
+
+            return true;
+
+        }
+
+
+        /**
+         * Calls the function for every entry
+         * @param function Function to be called with the key and the value
+         */
+        template<typename F>
+        void forEach(F function) {
+
+            for(size_t i = 0; i < _entries.size(); ++i) {
+                if(_used[i])
+                    function(_entries[i].key, _entries[i].value);
+            }
+
+        }
+
+
+    protected:
+
+
+        static constexpr size_t npos() {
+
+            return (size_t) -1;
+
+        }
+
+
+        /**
+         * Returns the home slot of the key (fibonacci hashing, spreads consecutive keys)
+         * @param key Key
+         * @return Slot index
+         */
+        size_t slot(const Key &key) const {
+
+            return (size_t) (((uint64_t) _hash(key) * 0x9E3779B97F4A7C15ull) >> 32) & _mask;
+
+        }
+
+
+        /**
+         * Returns the slot of the key
+         * @param key Key
+         * @return Slot index (npos, if the key does not exist)
+         */
+        size_t index(const Key &key) const {
+
+            for(size_t i = slot(key); _used[i]; i = (i + 1) & _mask) {
+                if(_entries[i].key == key)
+                    return i;
+            }
+
+            return npos();
+
+        }
+
+
+        /**
+         * Resizes the map to at least the given capacity and re-inserts the entries
+         * @param n Capacity
+         */
+        void rehash(size_t n) {
+
+            // next power of two
+            size_t c = 16;
+            while(c < n)
+                c *= 2;
+
+            auto entries = std::move(_entries);
+            auto used = std::move(_used);
+
+            _entries = std::vector<Entry>(c);
+            _used = std::vector<uint8_t>(c, 0);
+            _mask = c - 1;
+            _size = 0;
+
+            for(size_t i = 0; i < entries.size(); ++i) {
+                if(used[i])
+                    insert(entries[i].key, std::move(entries[i].value));
+            }
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_FLATHASHMAP_H
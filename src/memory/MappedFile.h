@@ -0,0 +1,195 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_MAPPEDFILE_H
+#define DUMMYPROJECT_MAPPEDFILE_H
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace memory {
+
+
+    /**
+     * @brief A file mapped into memory (POSIX).
+     *
+     * A file opened for reading is mapped read-only, the pages are loaded on access. A file created for writing is
+     * resized to the given size and mapped writable, the pages are written back by the operating system or by sync().
+     */
+    class MappedFile {
+
+        int _fd = -1;                               //!< The file descriptor
+        char *_data = nullptr;                      //!< The mapped memory
+        size_t _size = 0;                           //!< The size of the file
+
+
+    public:
+
+
+        /**
+         * Opens the file for reading
+         * @param path Path of the file
+         */
+        explicit MappedFile(const std::string &path) {
+
+            _fd = ::open(path.c_str(), O_RDONLY);
+            if(_fd < 0)
+                fail("open", path);
+
+            struct stat st{};
+            if(::fstat(_fd, &st) != 0)
+                fail("stat", path);
+
+            map(path, (size_t) st.st_size, PROT_READ);
+
+        }
+
+
+        /**
+         * Creates (or truncates) the file with the given size for writing
+         * @param path Path of the file
+         * @param size Size of the file
+         */
+        MappedFile(const std::string &path, size_t size) {
+
+            _fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+            if(_fd < 0)
+                fail("create", path);
+
+            if(::ftruncate(_fd, (off_t) size) != 0)
+                fail("resize", path);
+
+            map(path, size, PROT_READ | PROT_WRITE);
+
+        }
+
+
+        /**
+         * Destructor. Unmaps and closes the file.
+         */
+        virtual ~MappedFile() {
+
+            if(_data != nullptr)
+                ::munmap(_data, _size);
+
+            if(_fd >= 0)
+                ::close(_fd);
+
+        }
+
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+
+        /**
+         * Returns the mapped memory
+         * @return Pointer to the memory (nullptr for empty files)
+         */
+        char *data() {
+
+            return _data;
+
+        }
+
+
+        /**
+         * Returns the mapped memory
+         * @return Pointer to the memory (nullptr for empty files)
+         */
+        const char *data() const {
+
+            return _data;
+
+        }
+
+
+        /**
+         * Returns the size of the file
+         * @return Size in bytes
+         */
+        size_t size() const {
+
+            return _size;
+
+        }
+
+
+        /**
+         * Writes the changed pages back to the file and waits for completion
+         */
+        void sync() {
+
+            if(_data != nullptr && ::msync(_data, _size, MS_SYNC) != 0)
+                throw std::runtime_error(std::string("Mapped file could not be synced: ") + std::strerror(errno));
+
+        }
+
+
+    protected:
+
+
+        void map(const std::string &path, size_t size, int protection) {
+
+            _size = size;
+
+            // empty files cannot be mapped
+            if(size == 0)
+                return;
+
+            auto ptr = ::mmap(nullptr, size, protection, MAP_SHARED, _fd, 0);
+            if(ptr == MAP_FAILED)
+                fail("map", path);
+
+            _data = static_cast<char *>(ptr);
+
+            // files are usually processed front to back
+            ::madvise(ptr, size, MADV_SEQUENTIAL);
+
+        }
+
+
+        void fail(const std::string &action, const std::string &path) {
+
+            auto error = std::string(std::strerror(errno));
+
+            if(_fd >= 0)
+                ::close(_fd);
+
+            _fd = -1;
+
+            throw std::runtime_error("Could not " + action + " file " + path + ": " + error);
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_MAPPEDFILE_H
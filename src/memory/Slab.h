@@ -0,0 +1,252 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SLAB_H
+#define DUMMYPROJECT_SLAB_H
+
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace memory {
+
+
+    /**
+     * @brief A slab allocator for objects of one type.
+     *
+     * The objects are constructed in blocks of a fixed number of slots. The slots of destroyed objects are kept in a
+     * free list and reused by the next created objects, blocks are only released with the slab. Creating and destroying
+     * objects therefore allocates no memory once the slab has grown to its peak size, and the objects stay in place
+     * (pointers remain valid until the object is destroyed). An object is addressed by its handle, the slot index.
+     *
+     * @tparam T Type of the objects
+     * @tparam BlockSize Number of slots per block
+     */
+    template<typename T, size_t BlockSize = 1024>
+    class Slab {
+
+    public:
+
+        typedef uint32_t Handle;
+
+
+    protected:
+
+        typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Storage;
+
+        std::vector<std::unique_ptr<Storage[]>> _blocks{};     //!< The blocks of slots
+        std::vector<Handle> _free{};                            //!< The free slots (used as stack)
+        std::vector<bool> _alive{};                             //!< Flags indicating constructed objects
+        size_t _size = 0;                                       //!< Number of objects
+
+
+    public:
+
+
+        /**
+         * Constructor
+         */
+        Slab() = default;
+
+
+        /**
+         * Destructor. Destroys the remaining objects.
+         */
+        virtual ~Slab() {
+
+            for(size_t i = 0; i < _alive.size(); ++i) {
+                if(_alive[i])
+                    get((Handle) i)->~T();
+            }
+
+        }
+
+
+        Slab(const Slab &) = delete;
+        Slab &operator=(const Slab &) = delete;
+
+
+        /**
+         * Constructs an object in a free slot
+         * @param args Arguments of the constructor
+         * @return Handle of the object
+         */
+        template<typename... Args>
+        Handle create(Args &&... args) {
+
+            // new block, if no slot is free
+            if(_free.empty())
+                grow();
+
+            auto handle = _free.back();
+            new(get(handle)) T(std::forward<Args>(args)...);
+
+            _free.pop_back();
+            _alive[handle] = true;
+            _size++;
+
+            return handle;
+
+        }
+
+
+        /**
+         * Destroys the object and frees its slot
+         * @param handle Handle of the object
+         */
+        void destroy(Handle handle) {
+
+            if(!alive(handle))
+                throw std::invalid_argument("Handle does not address an object.");
+
+            get(handle)->~T();
+
+            _alive[handle] = false;
+            _free.push_back(handle);
+            _size--;
+
+        }
+
+
+        /**
+         * Returns whether the handle addresses an object
+         * @param handle Handle
+         * @return Flag
+         */
+        bool alive(Handle handle) const {
+
+            return handle < _alive.size() && _alive[handle];
+
+        }
+
+
+        /**
+         * Returns the object of the handle
+         * @param handle Handle of the object (unchecked)
+         * @return The object
+         */
+        T &operator[](Handle handle) {
+
+            return *get(handle);
+
+        }
+
+
+        /**
+         * Returns the object of the handle
+         * @param handle Handle of the object (unchecked)
+         * @return The object
+         */
+        const T &operator[](Handle handle) const {
+
+            return *reinterpret_cast<const T *>(&_blocks[handle / BlockSize][handle % BlockSize]);
+
+        }
+
+
+        /**
+         * Returns the number of objects
+         * @return Number of objects
+         */
+        size_t size() const {
+
+            return _size;
+
+        }
+
+
+        /**
+         * Returns the number of slots
+         * @return Number of slots
+         */
+        size_t capacity() const {
+
+            return _blocks.size() * BlockSize;
+
+        }
+
+
+        /**
+         * Returns the memory allocated by the slab
+         * @return Memory in bytes
+         */
+        size_t memoryUsage() const {
+
+            return capacity() * sizeof(Storage) + _free.capacity() * sizeof(Handle) + _alive.capacity() / 8
+                   + _blocks.capacity() * sizeof(std::unique_ptr<Storage[]>);
+
+        }
+
+
+        /**
+         * Reserves slots for the given number of objects
+         * @param n Number of objects
+         */
+        void reserve(size_t n) {
+
+            while(capacity() < n)
+                grow();
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Returns the memory of the slot
+         * @param handle Slot index
+         * @return Pointer to the memory
+         */
+        T *get(Handle handle) {
+
+            return reinterpret_cast<T *>(&_blocks[handle / BlockSize][handle % BlockSize]);
+
+        }
+
+
+        /**
+         * Adds a block and pushes its slots to the free list
+         */
+        void grow() {
+
+            auto first = capacity();
+            _blocks.emplace_back(new Storage[BlockSize]);
+            _alive.resize(first + BlockSize, false);
+
+            // lowest handle on top of the stack
+            _free.reserve(capacity());
+            for(size_t i = BlockSize; i > 0; --i)
+                _free.push_back((Handle) (first + i - 1));
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_SLAB_H
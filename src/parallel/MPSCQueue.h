@@ -0,0 +1,145 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_MPSCQUEUE_H
+#define DUMMYPROJECT_MPSCQUEUE_H
+
+#include <atomic>
+#include <utility>
+
+namespace parallel {
+
+
+    /**
+     * @brief A lock-free, unbounded multi-producer single-consumer queue.
+     *
+     * Any thread can push values, only one thread (the consumer) may pop values. The queue is a linked list of nodes
+     * with a stub node: the producers swap the head atomically and link the previous head afterwards, the consumer
+     * follows the links from the tail. A value pushed by a producer, which has not linked its node yet, is not visible
+     * to the consumer until the link is set.
+     *
+     * @tparam T Type of the values
+     */
+    template<typename T>
+    class MPSCQueue {
+
+    protected:
+
+        //!< A node of the queue
+        struct Node {
+            std::atomic<Node *> next{nullptr};      //!< The next node
+            T value{};                              //!< The value
+        };
+
+        std::atomic<Node *> _head;                  //!< The last pushed node (producers)
+        char _padding[64]{};                        //!< Padding to avoid false sharing between producers and consumer
+        Node *_tail;                                //!< The stub node before the next value (consumer)
+
+
+    public:
+
+
+        /**
+         * Constructor
+         */
+        MPSCQueue() {
+
+            auto stub = new Node;
+            _head.store(stub, std::memory_order_relaxed);
+            _tail = stub;
+
+        }
+
+
+        /**
+         * Destructor. Deletes the remaining values.
+         */
+        virtual ~MPSCQueue() {
+
+            T value{};
+            while(pop(value));
+
+            delete _tail;
+
+        }
+
+
+        MPSCQueue(const MPSCQueue &) = delete;
+        MPSCQueue &operator=(const MPSCQueue &) = delete;
+
+
+        /**
+         * Pushes a value to the queue (any thread)
+         * @param value Value to be pushed
+         */
+        void push(T value) {
+
+            auto node = new Node;
+            node->value = std::move(value);
+
+            // append node and link it to the previous one
+            auto prev = _head.exchange(node, std::memory_order_acq_rel);
+            prev->next.store(node, std::memory_order_release);
+
+        }
+
+
+        /**
+         * Pops the next value from the queue (consumer thread only)
+         * @param value Value to be filled
+         * @return Flag indicating whether a value was popped
+         */
+        bool pop(T &value) {
+
+            auto tail = _tail;
+            auto next = tail->next.load(std::memory_order_acquire);
+
+            if(next == nullptr)
+                return false;
+
+            // the popped node becomes the new stub
+            value = std::move(next->value);
+            _tail = next;
+
+            delete tail;
+
+            return true;
+
+        }
+
+
+        /**
+         * Returns whether the queue has no visible value (consumer thread only)
+         * @return Flag indicating whether the queue is empty
+         */
+        bool empty() const {
+
+            return _tail->next.load(std::memory_order_acquire) == nullptr;
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_MPSCQUEUE_H
@@ -0,0 +1,191 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SPSCQUEUE_H
+#define DUMMYPROJECT_SPSCQUEUE_H
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+namespace parallel {
+
+
+    /**
+     * @brief A lock-free, bounded single-producer single-consumer ring buffer.
+     *
+     * One thread (the producer) may push values, one thread (the consumer) may pop values. The values are stored in a
+     * preallocated ring, so pushing and popping never allocates. The producer and the consumer each own one index and
+     * keep a cached copy of the other index, so the shared indexes are only read when the cached copy indicates a full
+     * or an empty ring.
+     *
+     * @tparam T Type of the values
+     */
+    template<typename T>
+    class SPSCQueue {
+
+    protected:
+
+        std::vector<T> _ring;                       //!< The ring of values
+        size_t _mask;                               //!< The capacity minus one (capacity is a power of two)
+
+        char _padding0[64]{};                       //!< Padding to avoid false sharing between ring and indexes
+
+        std::atomic<size_t> _head{0};               //!< The next index to be written (producer)
+        size_t _tailCache = 0;                      //!< The last seen tail (producer)
+
+        char _padding1[64]{};                       //!< Padding to avoid false sharing between producer and consumer
+
+        std::atomic<size_t> _tail{0};               //!< The next index to be read (consumer)
+        size_t _headCache = 0;                      //!< The last seen head (consumer)
+
+        char _padding2[64]{};                       //!< Padding to avoid false sharing with adjacent data
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param capacity Capacity of the ring (power of two)
+         */
+        explicit SPSCQueue(size_t capacity) : _ring(capacity), _mask(capacity - 1) {
+
+            if(capacity == 0 || (capacity & (capacity - 1)) != 0)
+                throw std::invalid_argument("Capacity must be a power of two.");
+
+        }
+
+
+        SPSCQueue(const SPSCQueue &) = delete;
+        SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+
+        /**
+         * Returns the capacity of the ring
+         * @return Capacity
+         */
+        size_t capacity() const {
+
+            return _ring.size();
+
+        }
+
+
+        /**
+         * Returns the number of values pushed so far (producer thread only)
+         * @return Number of pushed values
+         */
+        size_t pushed() const {
+
+            return _head.load(std::memory_order_relaxed);
+
+        }
+
+
+        /**
+         * Pushes a value to the ring (producer thread only)
+         * @param value Value to be pushed
+         * @return Flag indicating whether the value was pushed (false: the ring is full)
+         */
+        bool push(const T &value) {
+
+            auto head = _head.load(std::memory_order_relaxed);
+
+            // check space
+            if(head - _tailCache > _mask) {
+                _tailCache = _tail.load(std::memory_order_acquire);
+                if(head - _tailCache > _mask)
+                    return false;
+            }
+
+            _ring[head & _mask] = value;
+            _head.store(head + 1, std::memory_order_release);
+
+            return true;
+
+        }
+
+
+        /**
+         * Pops the next value from the ring (consumer thread only)
+         * @param value Value to be filled
+         * @return Flag indicating whether a value was popped
+         */
+        bool pop(T &value) {
+
+            auto tail = _tail.load(std::memory_order_relaxed);
+
+            // check values
+            if(tail == _headCache) {
+                _headCache = _head.load(std::memory_order_acquire);
+                if(tail == _headCache)
+                    return false;
+            }
+
+            value = _ring[tail & _mask];
+            _tail.store(tail + 1, std::memory_order_release);
+
+            return true;
+
+        }
+
+
+        /**
+         * Pops all visible values at once and passes them to the function (consumer thread only)
+         * @tparam F Type of the function
+         * @param function Function to be called for each value
+         * @return Number of popped values
+         */
+        template<typename F>
+        size_t consume(F &&function) {
+
+            auto tail = _tail.load(std::memory_order_relaxed);
+            auto head = _head.load(std::memory_order_acquire);
+
+            for(auto i = tail; i != head; ++i)
+                function(_ring[i & _mask]);
+
+            _tail.store(head, std::memory_order_release);
+            _headCache = head;
+
+            return head - tail;
+
+        }
+
+
+        /**
+         * Returns whether the ring has no visible value (consumer thread only)
+         * @return Flag indicating whether the ring is empty
+         */
+        bool empty() const {
+
+            return _tail.load(std::memory_order_relaxed) == _head.load(std::memory_order_acquire);
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_SPSCQUEUE_H
@@ -0,0 +1,145 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include "ShardedExecutor.h"
+
+namespace parallel {
+
+
+    ShardedExecutor::ShardedExecutor(size_t shards) {
+
+        // number of shards
+        if(shards == 0)
+            shards = std::max(1u, std::thread::hardware_concurrency());
+
+        // create shards and start workers
+        for(size_t i = 0; i < shards; ++i)
+            _shards.emplace_back(new Shard);
+
+        for(auto &s : _shards)
+            s->thread = std::thread(&ShardedExecutor::work, this, std::ref(*s));
+
+    }
+
+
+    ShardedExecutor::~ShardedExecutor() {
+
+        // stop workers
+        _stop = true;
+
+        for(auto &s : _shards) {
+            std::lock_guard<std::mutex> lock(s->mutex);
+            s->condition.notify_one();
+        }
+
+        // join workers
+        for(auto &s : _shards)
+            s->thread.join();
+
+    }
+
+
+    size_t ShardedExecutor::size() const {
+
+        return _shards.size();
+
+    }
+
+
+    size_t ShardedExecutor::shardOf(uint64_t key) const {
+
+        // fibonacci hashing to spread consecutive keys
+        return (size_t) ((key * 0x9E3779B97F4A7C15ull) >> 32) % _shards.size();
+
+    }
+
+
+    void ShardedExecutor::post(size_t shard, Task task) {
+
+        if(shard >= _shards.size())
+            throw std::out_of_range("Shard index out of range.");
+
+        auto &s = *_shards[shard];
+        s.mailbox.push(std::move(task));
+
+        // wake up the worker, if parked (the fence pairs with the one in work())
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(s.sleeping.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(s.mutex);
+            s.condition.notify_one();
+        }
+
+    }
+
+
+    void ShardedExecutor::sync() {
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t remaining = _shards.size();
+
+        // the marker task is executed after all tasks posted before
+        for(size_t i = 0; i < _shards.size(); ++i) {
+            post(i, [&mutex, &condition, &remaining] {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(--remaining == 0)
+                    condition.notify_one();
+            });
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        condition.wait(lock, [&remaining] { return remaining == 0; });
+
+    }
+
+
+    void ShardedExecutor::work(Shard &shard) {
+
+        Task task;
+
+        while(true) {
+
+            // work until the mailbox is empty
+            while(shard.mailbox.pop(task)) {
+                task();
+                task = nullptr;
+            }
+
+            if(_stop)
+                return;
+
+            // park until a task is posted
+            std::unique_lock<std::mutex> lock(shard.mutex);
+            shard.sleeping.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            shard.condition.wait(lock, [this, &shard] { return _stop || !shard.mailbox.empty(); });
+            shard.sleeping.store(false, std::memory_order_relaxed);
+
+        }
+
+    }
+
+}
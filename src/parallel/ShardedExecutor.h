@@ -0,0 +1,131 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SHARDEDEXECUTOR_H
+#define DUMMYPROJECT_SHARDEDEXECUTOR_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "MPSCQueue.h"
+
+namespace parallel {
+
+
+    /**
+     * @brief An executor with one worker thread per shard.
+     *
+     * Every shard owns a worker thread and a mailbox (@see MPSCQueue). Tasks posted to a shard are executed by its
+     * worker in the order they are posted. State, which is only accessed by the tasks of one shard, therefore needs no
+     * lock. A key (e.g. the ID of an object) is mapped to its shard by shardOf(). Tasks must not throw.
+     */
+    class ShardedExecutor {
+
+    public:
+
+        typedef std::function<void()> Task;
+
+
+    protected:
+
+        //!< A shard
+        struct Shard {
+            MPSCQueue<Task> mailbox{};              //!< The tasks to be executed
+            std::mutex mutex{};                     //!< Mutex to park the worker
+            std::condition_variable condition{};    //!< Condition to wake up the worker
+            std::atomic<bool> sleeping{false};      //!< Flag indicating that the worker is parked
+            std::thread thread{};                   //!< The worker thread
+        };
+
+        std::vector<std::unique_ptr<Shard>> _shards{};  //!< The shards
+        std::atomic<bool> _stop{false};                 //!< Flag to stop the workers
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param shards Number of shards (0 = number of hardware threads)
+         */
+        explicit ShardedExecutor(size_t shards = 0);
+
+
+        /**
+         * Destructor. Executes the remaining tasks and joins the worker threads.
+         */
+        virtual ~ShardedExecutor();
+
+
+        ShardedExecutor(const ShardedExecutor &) = delete;
+        ShardedExecutor &operator=(const ShardedExecutor &) = delete;
+
+
+        /**
+         * Returns the number of shards
+         * @return Number of shards
+         */
+        size_t size() const;
+
+
+        /**
+         * Returns the shard of the given key
+         * @param key Key
+         * @return Index of the shard
+         */
+        size_t shardOf(uint64_t key) const;
+
+
+        /**
+         * Posts a task to the shard (any thread)
+         * @param shard Index of the shard
+         * @param task Task to be executed
+         */
+        void post(size_t shard, Task task);
+
+
+        /**
+         * Waits until all tasks posted before the call are executed
+         */
+        void sync();
+
+
+    protected:
+
+
+        /**
+         * The loop of the worker threads
+         * @param shard The shard of the worker
+         */
+        void work(Shard &shard);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_SHARDEDEXECUTOR_H
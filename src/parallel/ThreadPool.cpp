@@ -0,0 +1,206 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include "ThreadPool.h"
+
+namespace parallel {
+
+
+    ThreadPool::ThreadPool(size_t threads) {
+
+        // number of threads
+        if(threads == 0)
+            threads = std::max(1u, std::thread::hardware_concurrency());
+
+        // create queues and start workers
+        _queues = std::vector<Queue>(threads);
+        for(size_t i = 1; i < threads; ++i)
+            _threads.emplace_back(&ThreadPool::work, this, i);
+
+    }
+
+
+    ThreadPool::~ThreadPool() {
+
+        // stop workers
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+
+        _condition.notify_all();
+
+        // join workers
+        for(auto &t : _threads)
+            t.join();
+
+    }
+
+
+    size_t ThreadPool::size() const {
+
+        return _queues.size();
+
+    }
+
+
+    void ThreadPool::parallelFor(size_t n, const RangeFunction &function, size_t chunkSize) {
+
+        if(n == 0)
+            return;
+
+        // serial execution (single thread or nested loop)
+        bool expected = false;
+        if(_queues.size() == 1 || !_busy.compare_exchange_strong(expected, true)) {
+            function(0, n);
+            return;
+        }
+
+        // chunk size: some chunks per thread to balance the load
+        if(chunkSize == 0)
+            chunkSize = std::max((size_t) 1, n / (4 * _queues.size()));
+
+        // create job
+        Job job{};
+        job.function = &function;
+        job.remaining = (n + chunkSize - 1) / chunkSize;
+
+        // distribute chunks in contiguous blocks over the queues
+        size_t noOfChunks = job.remaining;
+        for(size_t c = 0; c < noOfChunks; ++c) {
+
+            auto &queue = _queues[c * _queues.size() / noOfChunks];
+
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.chunks.push_back(Chunk{&job, c * chunkSize, std::min(n, (c + 1) * chunkSize)});
+
+        }
+
+        // wake up workers
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _generation++;
+        }
+
+        _condition.notify_all();
+
+        // participate
+        Chunk chunk{};
+        while(job.remaining.load(std::memory_order_acquire) > 0) {
+
+            if(take(0, chunk))
+                execute(chunk);
+            else
+                std::this_thread::yield();
+
+        }
+
+        // release pool
+        _busy = false;
+
+        // re-throw
+        if(job.exception)
+            std::rethrow_exception(job.exception);
+
+    }
+
+
+    void ThreadPool::work(size_t index) {
+
+        unsigned long generation = 0;
+        Chunk chunk{};
+
+        while(true) {
+
+            // work until no chunk is available
+            while(take(index, chunk))
+                execute(chunk);
+
+            // wait for next loop
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [this, generation] { return _stop || _generation != generation; });
+
+            if(_stop)
+                return;
+
+            generation = _generation;
+
+        }
+
+    }
+
+
+    bool ThreadPool::take(size_t index, Chunk &chunk) {
+
+        // own queue (front)
+        {
+            auto &queue = _queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(!queue.chunks.empty()) {
+                chunk = queue.chunks.front();
+                queue.chunks.pop_front();
+                return true;
+            }
+        }
+
+        // steal from other queues (back)
+        for(size_t i = 1; i < _queues.size(); ++i) {
+
+            auto &queue = _queues[(index + i) % _queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(!queue.chunks.empty()) {
+                chunk = queue.chunks.back();
+                queue.chunks.pop_back();
+                return true;
+            }
+
+        }
+
+        return false;
+
+    }
+
+
+    void ThreadPool::execute(const Chunk &chunk) {
+
+        auto job = chunk.job;
+
+        try {
+
+            (*job->function)(chunk.begin, chunk.end);
+
+        } catch(...) {
+
+            std::lock_guard<std::mutex> lock(job->mutex);
+            if(!job->exception)
+                job->exception = std::current_exception();
+
+        }
+
+        // the job must not be accessed after the decrement
+        job->remaining.fetch_sub(1, std::memory_order_acq_rel);
+
+    }
+
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_THREADPOOL_H
+#define DUMMYPROJECT_THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace parallel {
+
+
+    /**
+     * @brief A work-stealing thread pool for data parallel loops.
+     *
+     * A loop (@see parallelFor()) is split into chunks, which are distributed over the queues of the threads. Every
+     * thread works on its own queue first and steals chunks from the other queues when its queue is empty. The calling
+     * thread participates in the execution and the call returns, when all chunks are processed (barrier). The pool
+     * executes one loop at a time, nested loops are executed serially by the calling thread.
+     */
+    class ThreadPool {
+
+    public:
+
+        typedef std::function<void(size_t, size_t)> RangeFunction;
+
+
+    protected:
+
+        //!< A loop to be executed
+        struct Job {
+            const RangeFunction *function;          //!< The function to be executed for each chunk
+            std::atomic<size_t> remaining;          //!< Number of chunks not processed yet
+            std::mutex mutex;                       //!< Mutex to save the exception
+            std::exception_ptr exception = nullptr; //!< The first exception thrown by the function
+        };
+
+        //!< A chunk of a loop
+        struct Chunk {
+            Job *job;                               //!< The loop the chunk belongs to
+            size_t begin;                           //!< First index of the chunk
+            size_t end;                             //!< End index of the chunk (excluded)
+        };
+
+        //!< A queue of chunks of a thread
+        struct Queue {
+            std::mutex mutex;                       //!< Mutex of the queue
+            std::deque<Chunk> chunks;               //!< The chunks of the queue
+            char padding[64];                       //!< Padding to avoid false sharing between the queues
+        };
+
+        std::vector<std::thread> _threads{};        //!< The worker threads
+        std::vector<Queue> _queues;                 //!< The queues (index 0 for the calling thread)
+
+        std::mutex _mutex{};                        //!< Mutex to wait for new loops
+        std::condition_variable _condition{};       //!< Condition to wake up the workers
+        unsigned long _generation = 0;              //!< Counter of the started loops
+        bool _stop = false;                         //!< Flag to stop the workers
+
+        std::atomic<bool> _busy{false};             //!< Flag indicating that a loop is executed
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param threads Number of threads including the calling thread (0 = number of hardware threads)
+         */
+        explicit ThreadPool(size_t threads = 0);
+
+
+        /**
+         * Destructor. Stops and joins the worker threads.
+         */
+        virtual ~ThreadPool();
+
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+
+        /**
+         * Returns the number of threads including the calling thread
+         * @return Number of threads
+         */
+        size_t size() const;
+
+
+        /**
+         * @brief Executes the function for the index range [0, n) in parallel.
+         *
+         * The range is split into chunks of the given size. The function is called with the begin and end index of each
+         * chunk. The method returns, when all chunks are executed. The first exception thrown by the function is
+         * re-thrown in the calling thread.
+         *
+         * @param n Number of indexes
+         * @param function Function to be called for each chunk
+         * @param chunkSize Size of the chunks (0 = automatic)
+         */
+        void parallelFor(size_t n, const RangeFunction &function, size_t chunkSize = 0);
+
+
+    protected:
+
+
+        /**
+         * The loop of the worker threads
+         * @param index Index of the thread's queue
+         */
+        void work(size_t index);
+
+
+        /**
+         * Takes a chunk from the own queue or steals a chunk from another queue
+         * @param index Index of the thread's queue
+         * @param chunk Chunk to be filled
+         * @return Flag indicating whether a chunk was taken
+         */
+        bool take(size_t index, Chunk &chunk);
+
+
+        /**
+         * Executes the chunk
+         * @param chunk Chunk to be executed
+         */
+        static void execute(const Chunk &chunk);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_THREADPOOL_H
@@ -0,0 +1,435 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_TRACER_H
+#define DUMMYPROJECT_TRACER_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <parallel/SPSCQueue.h>
+
+#if defined(__GNUC__)
+#define PROFILE_NOINLINE __attribute__((noinline, cold))
+#elif defined(_MSC_VER)
+#define PROFILE_NOINLINE __declspec(noinline)
+#else
+#define PROFILE_NOINLINE
+#endif
+
+namespace profiling {
+
+
+    /**
+     * @brief A span recorded by the tracer
+     */
+    struct SpanEvent {
+
+        const char *category = nullptr;     //!< Category (string with static storage duration)
+        const char *name = nullptr;         //!< Name (string with static storage duration)
+        uint64_t start = 0;                 //!< Start time of the span [ns] (@see Tracer::now())
+        uint64_t duration = 0;              //!< Duration of the span [ns]
+
+    };
+
+
+    /**
+     * @brief The flag enabling the tracer, constant-initialized (a static member of a template, so the header-only
+     * flag is defined once per program), so checking it does not need the initialization guard of Tracer::global()
+     */
+    template<typename T = void>
+    struct TracerFlag {
+
+        static std::atomic<bool> enabled;   //!< Flag indicating whether spans are recorded
+
+    };
+
+    template<typename T>
+    std::atomic<bool> TracerFlag<T>::enabled{false};
+
+
+    /**
+     * @brief The tracer collects spans (named time intervals) of all threads and exports them as a timeline in the
+     * Chrome trace event format, which can be opened by chrome://tracing or Perfetto.
+     *
+     * Every thread records into its own preallocated single-producer single-consumer ring, so recording a span neither
+     * locks nor allocates (the ring of a thread is allocated with its first span). When a ring is full, the spans are
+     * dropped and counted until the ring is drained by an export. The names and categories are not copied and must be
+     * string literals. Tracing is disabled by default; when disabled, a span costs one relaxed atomic load.
+     */
+    class Tracer {
+
+    public:
+
+        static constexpr size_t CAPACITY = size_t(1) << 14;         //!< Number of spans per thread ring
+
+
+    protected:
+
+        struct ThreadBuffer {
+
+            explicit ThreadBuffer(uint64_t id) : id(id) {}
+
+            parallel::SPSCQueue<SpanEvent> spans{CAPACITY};         //!< The spans of the thread
+            std::atomic<uint64_t> dropped{0};                       //!< Number of spans dropped by a full ring
+            uint64_t id;                                            //!< Thread number in the trace
+            std::string name{};                                     //!< Name of the thread (guarded by the mutex)
+
+        };
+
+        uint64_t _origin;                                           //!< Time origin of the trace [ns]
+
+        mutable std::mutex _mutex{};                                //!< Guards the thread buffers and the export
+        std::vector<std::shared_ptr<ThreadBuffer>> _buffers{};      //!< The buffers of all threads
+        uint64_t _threads = 0;                                      //!< The number of registered threads
+
+
+        /**
+         * Constructor (@see global())
+         */
+        Tracer() : _origin(now()) {}
+
+
+    public:
+
+
+        Tracer(const Tracer &) = delete;
+        Tracer &operator=(const Tracer &) = delete;
+
+
+        /**
+         * Returns the global tracer
+         * @return Tracer
+         */
+        static Tracer &global() {
+
+            static Tracer tracer{};
+            return tracer;
+
+        }
+
+
+        /**
+         * Returns the time of a monotonic clock
+         * @return Time in nanoseconds
+         */
+        static uint64_t now() {
+
+            return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        }
+
+
+        /**
+         * Enables or disables the recording of spans
+         * @param enabled Flag
+         */
+        void enable(bool enabled = true) {
+
+            TracerFlag<>::enabled.store(enabled, std::memory_order_relaxed);
+
+        }
+
+
+        /**
+         * Returns true, if spans are recorded
+         * @return Flag
+         */
+        static bool enabled() {
+
+            return TracerFlag<>::enabled.load(std::memory_order_relaxed);
+
+        }
+
+
+        /**
+         * Records a span of the calling thread
+         * @param category Category (string literal)
+         * @param name Name (string literal)
+         * @param start Start time [ns]
+         * @param duration Duration [ns]
+         */
+        void record(const char *category, const char *name, uint64_t start, uint64_t duration) {
+
+            auto &buffer = threadBuffer();
+            if(!buffer.spans.push(SpanEvent{category, name, start, duration}))
+                buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+
+        }
+
+
+        /**
+         * Sets the name of the calling thread in the trace
+         * @param name Name
+         */
+        void setThreadName(const std::string &name) {
+
+            auto &buffer = threadBuffer();
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            buffer.name = name;
+
+        }
+
+
+        /**
+         * Removes all recorded spans and the counters of the dropped spans
+         */
+        void clear() {
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            drain([](const ThreadBuffer &, const SpanEvent &) {});
+
+        }
+
+
+        /**
+         * Returns the number of spans dropped since the last export because of full rings
+         * @return Number of spans
+         */
+        uint64_t dropped() const {
+
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            uint64_t dropped = 0;
+            for(auto &b : _buffers)
+                dropped += b->dropped.load(std::memory_order_relaxed);
+
+            return dropped;
+
+        }
+
+
+        /**
+         * @brief Writes the spans recorded since the last export as Chrome trace JSON and removes them
+         *
+         * The spans are written as complete events ("ph":"X") with the time stamps in microseconds since the
+         * construction of the tracer, the named threads as metadata events. The number of dropped spans is written to
+         * "otherData".
+         *
+         * @param os Output stream
+         * @return Number of written spans
+         */
+        size_t writeChromeTrace(std::ostream &os) {
+
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            auto flags = os.flags();
+            auto precision = os.precision();
+            os << std::fixed << std::setprecision(3);
+
+            os << "{\"traceEvents\":[";
+
+            // thread names
+            bool first = true;
+            for(auto &b : _buffers) {
+
+                if(b->name.empty())
+                    continue;
+
+                os << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << b->id
+                   << ",\"args\":{\"name\":";
+                writeString(os, b->name.c_str());
+                os << "}}";
+
+                first = false;
+
+            }
+
+            // spans
+            size_t count = 0;
+            auto dropped = drain([this, &os, &first, &count](const ThreadBuffer &buffer, const SpanEvent &span) {
+
+                os << (first ? "" : ",") << "\n{\"name\":";
+                writeString(os, span.name);
+                os << ",\"cat\":";
+                writeString(os, span.category);
+                os << ",\"ph\":\"X\",\"ts\":" << (double) (int64_t) (span.start - _origin) * 1e-3
+                   << ",\"dur\":" << (double) span.duration * 1e-3 << ",\"pid\":1,\"tid\":" << buffer.id << "}";
+
+                first = false;
+                ++count;
+
+            });
+
+            os << "\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":" << dropped << "}}\n";
+
+            os.flags(flags);
+            os.precision(precision);
+
+            return count;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Returns the buffer of the calling thread, which is registered with the first call of the thread
+         * @return Buffer
+         */
+        ThreadBuffer &threadBuffer() {
+
+            static thread_local std::shared_ptr<ThreadBuffer> buffer{};
+
+            if(!buffer) {
+                std::lock_guard<std::mutex> lock(_mutex);
+                buffer = std::make_shared<ThreadBuffer>(++_threads);
+                _buffers.push_back(buffer);
+            }
+
+            return *buffer;
+
+        }
+
+
+        /**
+         * Consumes the spans of all buffers and removes the buffers of terminated threads (the mutex must be locked)
+         * @tparam F Function type
+         * @param function Function called with the buffer and each span
+         * @return Number of dropped spans since the last drain
+         */
+        template<typename F>
+        uint64_t drain(F function) {
+
+            uint64_t dropped = 0;
+            for(auto &b : _buffers) {
+
+                auto &buffer = *b;
+                buffer.spans.consume([&function, &buffer](const SpanEvent &span) {
+                    function(buffer, span);
+                });
+
+                dropped += buffer.dropped.exchange(0, std::memory_order_relaxed);
+
+            }
+
+            // the buffer of a terminated thread is only referenced by the tracer
+            _buffers.erase(std::remove_if(_buffers.begin(), _buffers.end(),
+                    [](const std::shared_ptr<ThreadBuffer> &b) { return b.use_count() == 1; }), _buffers.end());
+
+            return dropped;
+
+        }
+
+
+        /**
+         * Writes a quoted JSON string
+         * @param os Output stream
+         * @param value String
+         */
+        static void writeString(std::ostream &os, const char *value) {
+
+            os << '"';
+            for(auto c = value; c != nullptr && *c != '\0'; ++c) {
+                if(*c == '"' || *c == '\\')
+                    os << '\\' << *c;
+                else if((unsigned char) *c >= 0x20)
+                    os << *c;
+            }
+            os << '"';
+
+        }
+
+    };
+
+
+    /**
+     * @brief A scoped span, which records the time from its construction to its destruction (@see PROFILE_SPAN)
+     */
+    class Span {
+
+    protected:
+
+        const char *_category;              //!< Category
+        const char *_name;                  //!< Name
+        uint64_t _start = 0;                //!< Start time (0: not recorded)
+
+    public:
+
+
+        /**
+         * Constructor. Starts the span, if the tracer is enabled.
+         * @param category Category (string literal)
+         * @param name Name (string literal)
+         */
+        Span(const char *category, const char *name) : _category(category), _name(name) {
+
+            if(Tracer::enabled())
+                _start = Tracer::now();
+
+        }
+
+
+        /**
+         * Destructor. Records the span.
+         */
+        ~Span() {
+
+            if(_start != 0)
+                finish();
+
+        }
+
+
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+
+
+    protected:
+
+
+        /**
+         * Records the span (out of line, so a disabled span does not prevent the inlining of the traced function)
+         */
+        PROFILE_NOINLINE void finish() const {
+
+            Tracer::global().record(_category, _name, _start, Tracer::now() - _start);
+
+        }
+
+    };
+
+}
+
+
+#define PROFILE_SPAN_CONCAT_(a, b) a##b
+#define PROFILE_SPAN_CONCAT(a, b) PROFILE_SPAN_CONCAT_(a, b)
+
+/**
+ * Records a span from this line to the end of the enclosing scope
+ * @param category Category (string literal)
+ * @param name Name (string literal)
+ */
+#define PROFILE_SPAN(category, name) ::profiling::Span PROFILE_SPAN_CONCAT(_profileSpan, __LINE__)(category, name)
+
+#endif //DUMMYPROJECT_TRACER_H
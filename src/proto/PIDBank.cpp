@@ -0,0 +1,308 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include "PIDBank.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define PIDBANK_X86_SIMD
+#include <immintrin.h>
+#endif
+
+
+/**
+ * Scalar kernel, same calculation as PID_controller::step()
+ */
+static void stepScalar(const double *kP, const double *kI, const double *kD, double *xInt, double *x0,
+        const double *x, double *y, double *resetFlag, double timeStepSize, bool noDerivative, size_t n) {
+
+    for(size_t i = 0; i < n; ++i) {
+
+        // no derivation calculation
+        bool r = noDerivative || resetFlag[i] != 0.0;
+
+        // parameters and inputs
+        xInt[i] += x[i] * timeStepSize;
+        double dx = r ? 0.0 : (x[i] - x0[i]) / timeStepSize;
+
+        // calculation
+        y[i] = kP[i] * x[i] + kI[i] * xInt[i] + kD[i] * dx;
+
+        // set memory
+        x0[i] = x[i];
+
+        // unset flag
+        resetFlag[i] = 0.0;
+
+    }
+
+}
+
+
+#ifdef PIDBANK_X86_SIMD
+
+/**
+ * AVX2 kernel (four controllers per instruction), same order of operations as the scalar kernel
+ */
+__attribute__((target("avx2")))
+static void stepAVX2(const double *kP, const double *kI, const double *kD, double *xInt, double *x0,
+        const double *x, double *y, double *resetFlag, double timeStepSize, bool noDerivative, size_t n) {
+
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d dt = _mm256_set1_pd(timeStepSize);
+    const __m256d guard = noDerivative ? _mm256_castsi256_pd(_mm256_set1_epi64x(-1)) : zero;
+
+    size_t i = 0;
+    for(; i + 4 <= n; i += 4) {
+
+        __m256d xi = _mm256_loadu_pd(x + i);
+
+        // mask of the lanes without derivative calculation
+        __m256d r = _mm256_or_pd(guard, _mm256_cmp_pd(_mm256_loadu_pd(resetFlag + i), zero, _CMP_NEQ_OQ));
+
+        // xInt += x * dt
+        __m256d xInti = _mm256_add_pd(_mm256_loadu_pd(xInt + i), _mm256_mul_pd(xi, dt));
+
+        // dx = r ? 0.0 : (x - x0) / dt
+        __m256d dx = _mm256_andnot_pd(r, _mm256_div_pd(_mm256_sub_pd(xi, _mm256_loadu_pd(x0 + i)), dt));
+
+        // y = kP * x + kI * xInt + kD * dx
+        __m256d yi = _mm256_add_pd(
+                _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(kP + i), xi), _mm256_mul_pd(_mm256_loadu_pd(kI + i), xInti)),
+                _mm256_mul_pd(_mm256_loadu_pd(kD + i), dx));
+
+        _mm256_storeu_pd(xInt + i, xInti);
+        _mm256_storeu_pd(y + i, yi);
+        _mm256_storeu_pd(x0 + i, xi);
+        _mm256_storeu_pd(resetFlag + i, zero);
+
+    }
+
+    // remaining controllers
+    stepScalar(kP + i, kI + i, kD + i, xInt + i, x0 + i, x + i, y + i, resetFlag + i, timeStepSize, noDerivative,
+            n - i);
+
+}
+
+#endif
+
+
+PIDBank::PIDBank() : kernel(Kernel::SCALAR) {
+
+    // select fastest kernel
+    setKernel(Kernel::AVX2);
+
+}
+
+
+size_t PIDBank::add(double P, double I, double D) {
+
+    kP.push_back(P);
+    kI.push_back(I);
+    kD.push_back(D);
+
+    xInt.push_back(0.0);
+    x0.push_back(0.0);
+
+    x.push_back(0.0);
+    y.push_back(0.0);
+
+    resetFlag.push_back(1.0);
+
+    return size() - 1;
+
+}
+
+
+size_t PIDBank::add(const PID_controller &controller) {
+
+    auto index = add(0.0, 0.0, 0.0);
+    set(index, controller);
+
+    return index;
+
+}
+
+
+void PIDBank::get(size_t index, PID_controller &controller) const {
+
+    controller.kP = kP.at(index);
+    controller.kI = kI.at(index);
+    controller.kD = kD.at(index);
+
+    controller.xInt = xInt.at(index);
+    controller.x0 = x0.at(index);
+
+    controller.x = x.at(index);
+    controller.y = y.at(index);
+
+    controller.resetFlag = resetFlag.at(index) != 0.0;
+
+}
+
+
+void PIDBank::set(size_t index, const PID_controller &controller) {
+
+    kP.at(index) = controller.kP;
+    kI.at(index) = controller.kI;
+    kD.at(index) = controller.kD;
+
+    xInt.at(index) = controller.xInt;
+    x0.at(index) = controller.x0;
+
+    x.at(index) = controller.x;
+    y.at(index) = controller.y;
+
+    resetFlag.at(index) = controller.resetFlag ? 1.0 : 0.0;
+
+}
+
+
+void PIDBank::reserve(size_t n) {
+
+    for(auto vec : {&kP, &kI, &kD, &xInt, &x0, &x, &y, &resetFlag})
+        vec->reserve(n);
+
+}
+
+
+size_t PIDBank::size() const {
+
+    return kP.size();
+
+}
+
+
+void PIDBank::setParameters(size_t index, double P, double I, double D) {
+
+    kP.at(index) = P;
+    kI.at(index) = I;
+    kD.at(index) = D;
+
+}
+
+
+void PIDBank::reset(size_t index) {
+
+    xInt.at(index) = 0.0;
+    x0.at(index) = 0.0;
+    resetFlag.at(index) = 1.0;
+
+}
+
+
+void PIDBank::reset() {
+
+    std::fill(xInt.begin(), xInt.end(), 0.0);
+    std::fill(x0.begin(), x0.end(), 0.0);
+    std::fill(resetFlag.begin(), resetFlag.end(), 1.0);
+
+}
+
+
+void PIDBank::setInput(size_t index, double err, bool reset) {
+
+    // set error
+    x.at(index) = err;
+
+    // reset if desired
+    if(reset)
+        this->reset(index);
+
+}
+
+
+double *PIDBank::inputs() {
+
+    return x.data();
+
+}
+
+
+double PIDBank::getOutput(size_t index) const {
+
+    return y.at(index);
+
+}
+
+
+const double *PIDBank::outputs() const {
+
+    return y.data();
+
+}
+
+
+PIDBank::Kernel PIDBank::getKernel() const {
+
+    return kernel;
+
+}
+
+
+bool PIDBank::setKernel(Kernel k) {
+
+    if(!isSupported(k))
+        return false;
+
+    kernel = k;
+    return true;
+
+}
+
+
+bool PIDBank::isSupported(Kernel k) {
+
+    switch(k) {
+        case Kernel::SCALAR:
+            return true;
+        case Kernel::AVX2:
+#ifdef PIDBANK_X86_SIMD
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+    }
+
+    return false;
+
+}
+
+
+void PIDBank::step(double simTime, double timeStepSize) {
+
+    // no derivation calculation for all controllers
+    bool noDerivative = timeStepSize <= EPS_TIME_STEP_SIZE;
+
+#ifdef PIDBANK_X86_SIMD
+    if(kernel == Kernel::AVX2) {
+        stepAVX2(kP.data(), kI.data(), kD.data(), xInt.data(), x0.data(), x.data(), y.data(), resetFlag.data(),
+                timeStepSize, noDerivative, size());
+        return;
+    }
+#endif
+
+    stepScalar(kP.data(), kI.data(), kD.data(), xInt.data(), x0.data(), x.data(), y.data(), resetFlag.data(),
+            timeStepSize, noDerivative, size());
+
+}
@@ -0,0 +1,212 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_PIDBANK_H
+#define DUMMYPROJECT_PIDBANK_H
+
+#include <memory/AlignedAllocator.h>
+#include "PID_controller.h"
+
+
+/**
+ * @brief A bank of PID controllers, which are stepped all at once.
+ *
+ * The gains, inputs and states of the controllers are stored as structure of arrays, so that all controllers are
+ * stepped in one vectorized (SIMD) pass. The reset flags and the derivative guard (@see PID_controller::step()) are
+ * handled by masks instead of branches. The calculation is the same as in PID_controller::step() in the same order of
+ * operations, so the results are identical to the single controller.
+ */
+class PIDBank {
+
+public:
+
+    //!< Implementation of the step calculation
+    enum class Kernel {SCALAR, AVX2};
+
+
+protected:
+
+    // parameters
+    memory::AlignedVector<double> kP{};
+    memory::AlignedVector<double> kI{};
+    memory::AlignedVector<double> kD{};
+
+    // states
+    memory::AlignedVector<double> xInt{};
+    memory::AlignedVector<double> x0{};
+
+    // inputs and outputs
+    memory::AlignedVector<double> x{};
+    memory::AlignedVector<double> y{};
+
+    // reset flags (0.0 or 1.0)
+    memory::AlignedVector<double> resetFlag{};
+
+    // kernel
+    Kernel kernel;
+
+    constexpr static const double EPS_TIME_STEP_SIZE = 1e-9;
+
+
+public:
+
+    PIDBank();
+
+    virtual ~PIDBank() = default;
+
+
+    /**
+     * Adds a controller with the given gains in reset state
+     * @param P Proportional gain
+     * @param I Integral gain
+     * @param D Derivative gain
+     * @return Index of the controller
+     */
+    size_t add(double P, double I, double D);
+
+
+    /**
+     * Adds a copy of the given controller (gains, states, input and output)
+     * @param controller Controller
+     * @return Index of the controller
+     */
+    size_t add(const PID_controller &controller);
+
+
+    /**
+     * Copies the controller with the given index to the given controller
+     * @param index Index of the controller
+     * @param controller Controller to be written
+     */
+    void get(size_t index, PID_controller &controller) const;
+
+
+    /**
+     * Overwrites the controller with the given index by the given controller
+     * @param index Index of the controller
+     * @param controller Controller
+     */
+    void set(size_t index, const PID_controller &controller);
+
+
+    /**
+     * Reserves memory for the given number of controllers
+     * @param n Number of controllers
+     */
+    void reserve(size_t n);
+
+
+    /**
+     * Returns the number of controllers
+     * @return Number of controllers
+     */
+    size_t size() const;
+
+
+    /**
+     * Sets the gains of a controller
+     * @param index Index of the controller
+     * @param P Proportional gain
+     * @param I Integral gain
+     * @param D Derivative gain
+     */
+    void setParameters(size_t index, double P, double I, double D);
+
+
+    /**
+     * Resets the controller with the given index
+     * @param index Index of the controller
+     */
+    void reset(size_t index);
+
+
+    /**
+     * Resets all controllers
+     */
+    void reset();
+
+
+    /**
+     * Sets the input (control error) of a controller
+     * @param index Index of the controller
+     * @param err Control error
+     * @param reset Flag to reset the controller
+     */
+    void setInput(size_t index, double err, bool reset = false);
+
+
+    /**
+     * Returns the inputs of all controllers to be written directly
+     * @return Pointer to the inputs
+     */
+    double *inputs();
+
+
+    /**
+     * Returns the output of a controller
+     * @param index Index of the controller
+     * @return Output
+     */
+    double getOutput(size_t index) const;
+
+
+    /**
+     * Returns the outputs of all controllers
+     * @return Pointer to the outputs
+     */
+    const double *outputs() const;
+
+
+    /**
+     * Returns the kernel used for the step calculation
+     * @return Kernel
+     */
+    Kernel getKernel() const;
+
+
+    /**
+     * Sets the kernel used for the step calculation
+     * @param k Kernel
+     * @return Flag indicating whether the kernel is supported by the CPU (otherwise the kernel is not changed)
+     */
+    bool setKernel(Kernel k);
+
+
+    /**
+     * Returns true, if the kernel is supported by the CPU
+     * @param k Kernel
+     * @return Support flag
+     */
+    static bool isSupported(Kernel k);
+
+
+    /**
+     * Steps all controllers (@see PID_controller::step())
+     * @param simTime Simulation time
+     * @param timeStepSize Time step size
+     */
+    void step(double simTime, double timeStepSize);
+
+};
+
+#endif //DUMMYPROJECT_PIDBANK_H
@@ -23,11 +23,28 @@
 //
 
 #include <fstream>
+#include <stdexcept>
+#include <google/protobuf/arena.h>
+#include <profiling/Tracer.h>
 #include <proto/Models.pb.h>
 #include "PID_controller.h"
 
 typedef simulation::models::PID pid;
 
+//!< Size of the stack block of the arena used by save() and load()
+constexpr static const size_t ARENA_BLOCK_SIZE = 512;
+
+
+static google::protobuf::ArenaOptions stackArenaOptions(char *block, size_t size) {
+
+    google::protobuf::ArenaOptions options;
+    options.initial_block = block;
+    options.initial_block_size = size;
+
+    return options;
+
+}
+
 
 void PID_controller::create() {
 
@@ -95,36 +112,64 @@ double PID_controller::getOutput() const {
 }
 
 
-void PID_controller::save() const {
+void PID_controller::save(const std::string &path) const {
 
-    // data instance
-    pid controller;
+    PROFILE_SPAN("pid", "PID_controller::save(file)");
 
-    // set parameters
-    controller.mutable_parameters()->set_k_p(this->kP);
-    controller.mutable_parameters()->set_k_i(this->kI);
-    controller.mutable_parameters()->set_k_d(this->kD);
+    // data instance on an arena with a stack block (no heap allocation)
+    alignas(8) char block[ARENA_BLOCK_SIZE];
+    google::protobuf::Arena arena(stackArenaOptions(block, sizeof(block)));
+    auto controller = google::protobuf::Arena::CreateMessage<pid>(&arena);
 
-    // set state
-    controller.mutable_states()->set_x_0(this->x0);
-    controller.mutable_states()->set_x_int(this->xInt);
-    controller.mutable_states()->set_reset(this->resetFlag);
+    save(controller);
 
     // write
-    std::fstream fs("pid.bin", std::ios::out);
-    controller.SerializeToOstream(&fs);
+    std::fstream fs(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if(!fs || !controller->SerializeToOstream(&fs))
+        throw std::runtime_error("PID controller could not be saved to " + path + ".");
 
 }
 
 
-void PID_controller::load() {
+void PID_controller::load(const std::string &path) {
+
+    PROFILE_SPAN("pid", "PID_controller::load(file)");
 
-    // data instance
-    pid controller;
+    // data instance on an arena with a stack block (no heap allocation)
+    alignas(8) char block[ARENA_BLOCK_SIZE];
+    google::protobuf::Arena arena(stackArenaOptions(block, sizeof(block)));
+    auto controller = google::protobuf::Arena::CreateMessage<pid>(&arena);
 
     // read stream
-    std::fstream fs("pid.bin", std::ios::in);
-    controller.ParseFromIstream(&fs);
+    std::fstream fs(path, std::ios::in | std::ios::binary);
+    if(!fs || !controller->ParseFromIstream(&fs))
+        throw std::runtime_error("PID controller could not be loaded from " + path + ".");
+
+    load(*controller);
+
+}
+
+
+void PID_controller::save(pid *controller) const {
+
+    PROFILE_SPAN("pid", "PID_controller::save");
+
+    // set parameters
+    controller->mutable_parameters()->set_k_p(this->kP);
+    controller->mutable_parameters()->set_k_i(this->kI);
+    controller->mutable_parameters()->set_k_d(this->kD);
+
+    // set state
+    controller->mutable_states()->set_x_0(this->x0);
+    controller->mutable_states()->set_x_int(this->xInt);
+    controller->mutable_states()->set_reset(this->resetFlag);
+
+}
+
+
+void PID_controller::load(const pid &controller) {
+
+    PROFILE_SPAN("pid", "PID_controller::load");
 
     // set parameters
     this->kP = controller.parameters().k_p();
@@ -136,4 +181,4 @@ void PID_controller::load() {
     this->xInt = controller.states().x_int();
     this->resetFlag = controller.states().reset();
 
-}
\ No newline at end of file
+}
@@ -22,10 +22,20 @@
 // Created by Jens Klimke on 2020-07-12.
 //
 
+#ifndef DUMMYPROJECT_PID_CONTROLLER_H
+#define DUMMYPROJECT_PID_CONTROLLER_H
+
 #include <iostream>
+#include <string>
+
+class PIDBank;
+
+namespace simulation { namespace models { class PID; }}
 
 class PID_controller {
 
+    friend class PIDBank;
+
 protected:
 
     double kP;
@@ -59,8 +69,14 @@ public:
 
     double getOutput() const;
 
-    void save() const;
+    void save(const std::string &path = "pid.bin") const;
 
-    void load();
+    void load(const std::string &path = "pid.bin");
+
+    void save(simulation::models::PID *controller) const;
+
+    void load(const simulation::models::PID &controller);
 
 };
+
+#endif //DUMMYPROJECT_PID_CONTROLLER_H
@@ -0,0 +1,416 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <google/protobuf/arena.h>
+#include <profiling/Tracer.h>
+#include "AsyncRemoteServer.h"
+
+using grpc::ServerAsyncReaderWriter;
+using grpc::ServerAsyncResponseWriter;
+using grpc::ServerCompletionQueue;
+using grpc::ServerContext;
+using grpc::Status;
+using simulation::models::VehicleDefinition;
+using simulation::models::VehicleInput;
+using simulation::models::VehicleInputBatch;
+using simulation::models::VehicleState;
+using simulation::models::VehicleStateBatch;
+
+namespace remote {
+
+
+    /**
+     * A call in progress. The call is the tag of its pending operation, proceed() is called when the operation is
+     * completed. Only one operation of a call is pending at a time. The messages of a call are constructed on the
+     * arena of the call, which starts with a block inside the call object. The messages are therefore allocated with
+     * the call and released in bulk, when the call is deleted. During the shutdown, the completed calls are deleted
+     * instead of proceeding (@see AsyncRemoteServer::serve()).
+     */
+    class AsyncRemoteServer::Call {
+
+    protected:
+
+        constexpr static const size_t ARENA_BLOCK_SIZE = 1024;
+
+        AsyncRemoteServer *_owner;
+        ServerCompletionQueue *_queue;
+        ServerContext _context{};
+
+        alignas(8) char _block[ARENA_BLOCK_SIZE];
+        google::protobuf::Arena _arena;
+
+    public:
+
+        Call(AsyncRemoteServer *owner, ServerCompletionQueue *queue)
+                : _owner(owner), _queue(queue), _arena(arenaOptions(_block, sizeof(_block))) {}
+
+        virtual ~Call() = default;
+
+        virtual void proceed(bool ok) = 0;
+
+    private:
+
+        static google::protobuf::ArenaOptions arenaOptions(char *block, size_t size) {
+
+            google::protobuf::ArenaOptions options;
+            options.initial_block = block;
+            options.initial_block_size = size;
+
+            return options;
+
+        }
+
+    };
+
+
+    /**
+     * A unary call, which is handled by the shard of the unit addressed by the request
+     * @tparam Request Type of the request
+     */
+    template<typename Request>
+    class AsyncRemoteServer::UnaryCall : public Call {
+
+    public:
+
+        typedef void (Service::*RequestMethod)(ServerContext *, Request *, ServerAsyncResponseWriter<VehicleState> *,
+                                               grpc::CompletionQueue *, ServerCompletionQueue *, void *);
+
+        typedef Status (*Handler)(UnitRegistry &, const Request &, VehicleState *);
+
+    private:
+
+        RequestMethod _method;
+        Handler _handler;
+        Request *_request;
+        VehicleState *_response;
+        ServerAsyncResponseWriter<VehicleState> _responder;
+        bool _finished = false;
+
+    public:
+
+        UnaryCall(AsyncRemoteServer *owner, ServerCompletionQueue *queue, RequestMethod method, Handler handler)
+                : Call(owner, queue), _method(method), _handler(handler),
+                  _request(google::protobuf::Arena::CreateMessage<Request>(&_arena)),
+                  _response(google::protobuf::Arena::CreateMessage<VehicleState>(&_arena)),
+                  _responder(&_context) {
+
+            (_owner->_service.*_method)(&_context, _request, &_responder, _queue, _queue, this);
+
+        }
+
+        void proceed(bool ok) override {
+
+            PROFILE_SPAN("remote", "AsyncRemoteServer::UnaryCall");
+
+            if(!ok || _finished) {
+                delete this;
+                return;
+            }
+
+            // accept the next call
+            new UnaryCall(_owner, _queue, _method, _handler);
+
+            // handle request in the shard of the unit
+            auto shard = _owner->_executor.shardOf(_request->id());
+            _owner->_executor.post(shard, [this, shard] {
+                PROFILE_SPAN("remote", "AsyncRemoteServer::UnaryCall(shard)");
+                auto status = _handler(_owner->_units[shard], *_request, _response);
+                _finished = true;
+                _responder.Finish(*_response, status, this);
+            });
+
+        }
+
+    };
+
+
+    class AsyncRemoteServer::StreamRequestsCall : public Call {
+
+        enum class Stage {CONNECT, READ, WRITE, FINISH};
+
+        VehicleInputBatch *_inputs;                     //!< The batch of inputs (reused for every batch)
+        VehicleStateBatch *_states;                     //!< The batch of states (reused for every batch)
+        ServerAsyncReaderWriter<VehicleStateBatch, VehicleInputBatch> _stream;
+        Stage _stage = Stage::CONNECT;
+
+        std::vector<std::vector<int>> _indexes;         //!< The indexes of the inputs of the batch by shard
+        std::atomic<size_t> _pending{0};                //!< Number of shards not finished with the batch
+        std::atomic<bool> _failed{false};               //!< Flag indicating that a unit was not found
+
+    public:
+
+        StreamRequestsCall(AsyncRemoteServer *owner, ServerCompletionQueue *queue)
+                : Call(owner, queue),
+                  _inputs(google::protobuf::Arena::CreateMessage<VehicleInputBatch>(&_arena)),
+                  _states(google::protobuf::Arena::CreateMessage<VehicleStateBatch>(&_arena)),
+                  _stream(&_context), _indexes(owner->_executor.size()) {
+
+            _owner->_service.RequestStreamRequests(&_context, &_stream, _queue, _queue, this);
+
+        }
+
+        void proceed(bool ok) override {
+
+            PROFILE_SPAN("remote", "AsyncRemoteServer::StreamRequestsCall");
+
+            switch(_stage) {
+
+                case Stage::CONNECT:
+
+                    if(!ok) {
+                        delete this;
+                        return;
+                    }
+
+                    // accept the next call
+                    new StreamRequestsCall(_owner, _queue);
+                    read();
+                    break;
+
+                case Stage::READ:
+
+                    // the client is done
+                    if(!ok) {
+                        finish(Status::OK);
+                        return;
+                    }
+
+                    dispatch();
+                    break;
+
+                case Stage::WRITE:
+
+                    if(!ok) {
+                        finish(Status::OK);
+                        return;
+                    }
+
+                    read();
+                    break;
+
+                case Stage::FINISH:
+
+                    delete this;
+                    break;
+
+            }
+
+        }
+
+    private:
+
+        void read() {
+
+            _stage = Stage::READ;
+            _stream.Read(_inputs, this);
+
+        }
+
+        void write() {
+
+            if(_failed) {
+                finish(Status(grpc::StatusCode::NOT_FOUND, "Unit not found."));
+                return;
+            }
+
+            _stage = Stage::WRITE;
+            _stream.Write(*_states, this);
+
+        }
+
+        void finish(const Status &status) {
+
+            _stage = Stage::FINISH;
+            _stream.Finish(status, this);
+
+        }
+
+        void dispatch() {
+
+            auto &executor = _owner->_executor;
+
+            // prepare states (the states are written by the shards in place, cleared states are reused)
+            _states->clear_states();
+            for(int i = 0; i < _inputs->inputs_size(); ++i)
+                _states->add_states();
+
+            // split batch by shards
+            for(auto &ind : _indexes)
+                ind.clear();
+
+            for(int i = 0; i < _inputs->inputs_size(); ++i)
+                _indexes[executor.shardOf(_inputs->inputs(i).id())].push_back(i);
+
+            auto shards = (size_t) std::count_if(_indexes.begin(), _indexes.end(),
+                    [](const std::vector<int> &ind) { return !ind.empty(); });
+
+            if(shards == 0) {
+                write();
+                return;
+            }
+
+            // post the inputs to the shards, the last shard answers
+            _pending = shards;
+            for(size_t s = 0; s < _indexes.size(); ++s) {
+
+                if(_indexes[s].empty())
+                    continue;
+
+                executor.post(s, [this, s] {
+
+                    PROFILE_SPAN("remote", "AsyncRemoteServer::StreamRequestsCall(shard)");
+
+                    for(auto i : _indexes[s]) {
+                        if(!stepUnit(_owner->_units[s], _inputs->inputs(i), _states->mutable_states(i)).ok())
+                            _failed = true;
+                    }
+
+                    if(_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                        write();
+
+                });
+
+            }
+
+        }
+
+    };
+
+
+    AsyncRemoteServer::AsyncRemoteServer(size_t shards, size_t queues)
+            : _noOfQueues(std::max((size_t) 1, queues)), _executor(shards), _units(_executor.size()) {
+
+    }
+
+
+    AsyncRemoteServer::~AsyncRemoteServer() {
+
+        shutdown();
+
+    }
+
+
+    void AsyncRemoteServer::start(const std::string &address, int *port) {
+
+        if(_server)
+            throw std::runtime_error("Server is already started.");
+
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(address, grpc::InsecureServerCredentials(), port);
+        builder.RegisterService(&_service);
+
+        for(size_t i = 0; i < _noOfQueues; ++i)
+            _queues.emplace_back(builder.AddCompletionQueue());
+
+        _server = builder.BuildAndStart();
+        if(!_server)
+            throw std::runtime_error("Server could not be started on " + address + ".");
+
+        // one pending call of each type per queue
+        for(auto &q : _queues) {
+
+            new UnaryCall<VehicleDefinition>(this, q.get(), &Service::RequestCreateUnit, &createUnit);
+            new UnaryCall<VehicleDefinition>(this, q.get(), &Service::RequestDestroyUnit, &destroyUnit);
+            new UnaryCall<VehicleInput>(this, q.get(), &Service::RequestSendRequest, &stepUnit);
+            new StreamRequestsCall(this, q.get());
+
+        }
+
+        // start threads
+        for(auto &q : _queues)
+            _threads.emplace_back(&AsyncRemoteServer::serve, this, q.get());
+
+    }
+
+
+    void AsyncRemoteServer::wait() {
+
+        if(_server)
+            _server->Wait();
+
+    }
+
+
+    void AsyncRemoteServer::shutdown(std::chrono::milliseconds timeout) {
+
+        if(!_server)
+            return;
+
+        // stop accepting calls and issuing new reads, cancel the calls in progress after the timeout
+        _stopping = true;
+        _server->Shutdown(std::chrono::system_clock::now() + timeout);
+
+        // wait for the calls in progress, then finish the work posted to the shards
+        while(_proceeding > 0)
+            std::this_thread::yield();
+
+        _executor.sync();
+
+        // drain queues
+        for(auto &q : _queues)
+            q->Shutdown();
+
+        for(auto &t : _threads)
+            t.join();
+
+        _threads.clear();
+        _queues.clear();
+        _server.reset();
+        _stopping = false;
+
+    }
+
+
+    size_t AsyncRemoteServer::getNumberOfShards() const {
+
+        return _executor.size();
+
+    }
+
+
+    void AsyncRemoteServer::serve(ServerCompletionQueue *queue) {
+
+        void *tag = nullptr;
+        bool ok = false;
+
+        while(queue->Next(&tag, &ok)) {
+
+            _proceeding.fetch_add(1);
+
+            // no operation is issued during the shutdown, the completed calls are released
+            if(_stopping)
+                delete static_cast<Call *>(tag);
+            else
+                static_cast<Call *>(tag)->proceed(ok);
+
+            _proceeding.fetch_sub(1);
+
+        }
+
+    }
+
+}
@@ -0,0 +1,137 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_ASYNCREMOTESERVER_H
+#define DUMMYPROJECT_ASYNCREMOTESERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <grpcpp/grpcpp.h>
+#include <parallel/ShardedExecutor.h>
+#include "RemoteController.h"
+
+namespace remote {
+
+
+    /**
+     * @brief An asynchronous (completion queue based) server of the remote controller service.
+     *
+     * The units are sharded by their IDs over the worker threads of a ShardedExecutor. Every shard owns the units
+     * mapped to it, so the units are accessed without any lock. The completion queue threads only receive the calls
+     * and post the work to the shards, the shards answer the calls when the units are stepped. The inputs of a batch
+     * are split by their shards and the batch is answered when the last shard has stepped its units.
+     */
+    class AsyncRemoteServer {
+
+    public:
+
+        typedef simulation::models::RemoteController::AsyncService Service;
+
+
+    protected:
+
+        class Call;
+        template<typename Request> class UnaryCall;
+        class StreamRequestsCall;
+
+        Service _service{};                                                         //!< The async service
+        std::unique_ptr<grpc::Server> _server{};                                    //!< The server
+        std::vector<std::unique_ptr<grpc::ServerCompletionQueue>> _queues{};        //!< The completion queues
+        std::vector<std::thread> _threads{};                                        //!< The completion queue threads
+        size_t _noOfQueues;                                                         //!< The number of completion queues
+        std::atomic<bool> _stopping{false};                                         //!< Flag indicating the shutdown
+        std::atomic<size_t> _proceeding{0};                                         //!< Number of calls in progress
+
+        parallel::ShardedExecutor _executor;                                        //!< The shard workers
+        std::vector<UnitRegistry> _units;                                           //!< The units of each shard
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param shards Number of shards, i.e. unit worker threads (0 = number of hardware threads)
+         * @param queues Number of completion queues, each handled by one thread
+         */
+        explicit AsyncRemoteServer(size_t shards = 0, size_t queues = 1);
+
+
+        /**
+         * Destructor. Shuts the server down.
+         */
+        virtual ~AsyncRemoteServer();
+
+
+        AsyncRemoteServer(const AsyncRemoteServer &) = delete;
+        AsyncRemoteServer &operator=(const AsyncRemoteServer &) = delete;
+
+
+        /**
+         * Starts the server and the completion queue threads
+         * @param address Listening address
+         * @param port Selected port (e.g. when listening on port 0), may be nullptr
+         */
+        void start(const std::string &address, int *port = nullptr);
+
+
+        /**
+         * Blocks until the server is shut down
+         */
+        void wait();
+
+
+        /**
+         * Shuts the server down and joins the threads. The calls stop issuing operations, the calls still in progress
+         * after the timeout (e.g. idle streams) are cancelled. Then the work posted to the shards is finished and the
+         * completion queues are drained.
+         * @param timeout Time the calls in progress are given to complete
+         */
+        void shutdown(std::chrono::milliseconds timeout = std::chrono::milliseconds(1000));
+
+
+        /**
+         * Returns the number of shards
+         * @return Number of shards
+         */
+        size_t getNumberOfShards() const;
+
+
+    protected:
+
+
+        /**
+         * The loop of the completion queue threads
+         * @param queue The completion queue of the thread
+         */
+        void serve(grpc::ServerCompletionQueue *queue);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_ASYNCREMOTESERVER_H
@@ -0,0 +1,200 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <string>
+#include <google/protobuf/arena.h>
+#include <profiling/Tracer.h>
+#include "RemoteController.h"
+
+using grpc::ServerContext;
+using grpc::Status;
+using grpc::StatusCode;
+using simulation::models::VehicleDefinition;
+using simulation::models::VehicleInput;
+using simulation::models::VehicleInputBatch;
+using simulation::models::VehicleState;
+using simulation::models::VehicleStateBatch;
+
+namespace remote {
+
+
+    static void writeState(uint32_t id, const Unit &unit, VehicleState *state) {
+
+        auto s = unit.model.getState();
+        state->set_id(id);
+        state->set_time(unit.time);
+        state->set_acceleration(s.a);
+        state->set_velocity(s.v);
+        state->set_distance(s.s);
+
+    }
+
+
+    Status createUnit(UnitRegistry &units, const VehicleDefinition &definition, VehicleState *state) {
+
+        // create unit
+        auto unit = units.create(definition.id());
+        if(unit == nullptr)
+            return Status(StatusCode::ALREADY_EXISTS, "Unit " + std::to_string(definition.id()) + " exists already.");
+
+        if(definition.time_step_size() > 0.0)
+            unit->timeStepSize = definition.time_step_size();
+
+        // speed controller, if defined
+        if(definition.has_controller()) {
+
+            auto &gains = definition.controller();
+
+            unit->controller.create();
+            unit->controller.setParameters(gains.k_p(), gains.k_i(), gains.k_d());
+            unit->controller.reset();
+            unit->closedLoop = true;
+
+        }
+
+        // initial state
+        writeState(definition.id(), *unit, state);
+
+        return Status::OK;
+
+    }
+
+
+    Status destroyUnit(UnitRegistry &units, const VehicleDefinition &definition, VehicleState *state) {
+
+        // get unit
+        auto unit = units.find(definition.id());
+        if(unit == nullptr)
+            return Status(StatusCode::NOT_FOUND, "Unit " + std::to_string(definition.id()) + " not found.");
+
+        // last state
+        writeState(definition.id(), *unit, state);
+        units.destroy(definition.id());
+
+        return Status::OK;
+
+    }
+
+
+    Status stepUnit(UnitRegistry &units, const VehicleInput &input, VehicleState *state) {
+
+        // get unit
+        auto unit = units.find(input.id());
+        if(unit == nullptr)
+            return Status(StatusCode::NOT_FOUND, "Unit " + std::to_string(input.id()) + " not found.");
+
+        // the pedal is given or controlled to the target velocity
+        auto pedal = input.pedal();
+        if(unit->closedLoop) {
+
+            unit->controller.setInput(input.target_velocity() - unit->model.getState().v);
+            unit->controller.step(unit->time, unit->timeStepSize);
+            pedal = unit->controller.getOutput();
+
+        }
+
+        // step model
+        unit->model.modelStep(pedal, unit->timeStepSize);
+        unit->time += unit->timeStepSize;
+
+        writeState(input.id(), *unit, state);
+
+        return Status::OK;
+
+    }
+
+
+    Status RemoteControllerImpl::CreateUnit(ServerContext *context, const VehicleDefinition *request,
+                                            VehicleState *response) {
+
+        PROFILE_SPAN("remote", "RemoteController::CreateUnit");
+
+        std::lock_guard<std::mutex> lock(mu_);
+        return createUnit(units_, *request, response);
+
+    }
+
+
+    Status RemoteControllerImpl::DestroyUnit(ServerContext *context, const VehicleDefinition *request,
+                                             VehicleState *response) {
+
+        PROFILE_SPAN("remote", "RemoteController::DestroyUnit");
+
+        std::lock_guard<std::mutex> lock(mu_);
+        return destroyUnit(units_, *request, response);
+
+    }
+
+
+    Status RemoteControllerImpl::SendRequest(ServerContext *context, const VehicleInput *request,
+                                             VehicleState *response) {
+
+        PROFILE_SPAN("remote", "RemoteController::SendRequest");
+
+        std::lock_guard<std::mutex> lock(mu_);
+        return stepUnit(units_, *request, response);
+
+    }
+
+
+    Status RemoteControllerImpl::StreamRequests(ServerContext *context,
+            grpc::ServerReaderWriter<VehicleStateBatch, VehicleInputBatch> *stream) {
+
+        // messages of the stream on an arena, released in bulk with the stream
+        google::protobuf::Arena arena;
+        auto &inputs = *google::protobuf::Arena::CreateMessage<VehicleInputBatch>(&arena);
+        auto &states = *google::protobuf::Arena::CreateMessage<VehicleStateBatch>(&arena);
+
+        while(stream->Read(&inputs)) {
+
+            // one span per batch (the stream may stay open for the whole simulation)
+            PROFILE_SPAN("remote", "RemoteController::StreamRequests");
+
+            // messages are reused to keep the allocated memory
+            states.clear_states();
+
+            {
+
+                std::lock_guard<std::mutex> lock(mu_);
+
+                for(auto &input : inputs.inputs()) {
+
+                    auto status = stepUnit(units_, input, states.add_states());
+                    if(!status.ok())
+                        return status;
+
+                }
+
+            }
+
+            // send states
+            if(!stream->Write(states))
+                break;
+
+        }
+
+        return Status::OK;
+
+    }
+
+}
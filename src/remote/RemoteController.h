@@ -0,0 +1,108 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_REMOTECONTROLLER_H
+#define DUMMYPROJECT_REMOTECONTROLLER_H
+
+#include <cstdint>
+#include <mutex>
+#include <grpcpp/grpcpp.h>
+#include <remote/Models.grpc.pb.h>
+#include "UnitRegistry.h"
+
+namespace remote {
+
+
+    /**
+     * Creates a unit as defined and writes the initial state of the unit to the message. If the definition contains
+     * the gains of a controller, the unit runs in closed loop (@see stepUnit()).
+     * @param units Units
+     * @param definition Definition of the unit
+     * @param state State message to be written
+     * @return Status (ALREADY_EXISTS, if the ID is used)
+     */
+    grpc::Status createUnit(UnitRegistry &units, const simulation::models::VehicleDefinition &definition,
+                            simulation::models::VehicleState *state);
+
+
+    /**
+     * Destroys the unit and writes the last state of the unit to the message
+     * @param units Units
+     * @param definition Definition of the unit (only the ID is used)
+     * @param state State message to be written
+     * @return Status (NOT_FOUND, if the unit does not exist)
+     */
+    grpc::Status destroyUnit(UnitRegistry &units, const simulation::models::VehicleDefinition &definition,
+                             simulation::models::VehicleState *state);
+
+
+    /**
+     * Steps the unit addressed by the input and writes the new state of the unit to the message. In closed loop, the
+     * pedal is the output of the speed controller of the unit for the target velocity of the input, otherwise the
+     * pedal of the input is used.
+     * @param units Units
+     * @param input Input
+     * @param state State message to be written
+     * @return Status (NOT_FOUND, if the unit does not exist)
+     */
+    grpc::Status stepUnit(UnitRegistry &units, const simulation::models::VehicleInput &input,
+                          simulation::models::VehicleState *state);
+
+
+    /**
+     * @brief The remote controller service, which simulates a longitudinal vehicle model per unit.
+     *
+     * A unit is created by CreateUnit and stepped by every input sent by SendRequest (one input per call) or by
+     * StreamRequests (batches of inputs for many units per message) and destroyed by DestroyUnit. All units are guarded
+     * by one mutex.
+     */
+    class RemoteControllerImpl final : public simulation::models::RemoteController::Service {
+
+    public:
+
+        RemoteControllerImpl() = default;
+
+        grpc::Status CreateUnit(grpc::ServerContext *context, const simulation::models::VehicleDefinition *request,
+                                simulation::models::VehicleState *response) override;
+
+        grpc::Status DestroyUnit(grpc::ServerContext *context, const simulation::models::VehicleDefinition *request,
+                                 simulation::models::VehicleState *response) override;
+
+        grpc::Status SendRequest(grpc::ServerContext *context, const simulation::models::VehicleInput *request,
+                                 simulation::models::VehicleState *response) override;
+
+        grpc::Status StreamRequests(grpc::ServerContext *context,
+                grpc::ServerReaderWriter<simulation::models::VehicleStateBatch,
+                simulation::models::VehicleInputBatch> *stream) override;
+
+
+    private:
+
+        std::mutex mu_;
+        UnitRegistry units_;
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_REMOTECONTROLLER_H
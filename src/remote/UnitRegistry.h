@@ -0,0 +1,156 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_UNITREGISTRY_H
+#define DUMMYPROJECT_UNITREGISTRY_H
+
+#include <cstdint>
+#include <memory/FlatHashMap.h>
+#include <memory/Slab.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <proto/PID_controller.h>
+
+namespace remote {
+
+
+    //!< The time step size of a unit, if not defined by the client (1 kHz)
+    constexpr static const double DEFAULT_TIME_STEP_SIZE = 0.001;
+
+
+    /**
+     * A vehicle unit simulated by the server. In closed loop, the pedal is the output of the speed controller.
+     */
+    struct Unit {
+        models::LongitudinalModel model{};                  //!< The vehicle model
+        PID_controller controller{};                        //!< The speed controller (zero-initialized)
+        bool closedLoop = false;                            //!< Flag indicating that the controller drives the pedal
+        double timeStepSize = DEFAULT_TIME_STEP_SIZE;       //!< The time step size of the unit
+        double time = 0.0;                                  //!< The simulated time of the unit
+    };
+
+
+    /**
+     * @brief The units of a server (or of a shard of a server) by their IDs.
+     *
+     * The IDs are mapped to the slots of the units by a flat hash map, the units are stored in a slab. Creating and
+     * destroying units reuses the slots of destroyed units, so no memory is allocated per unit. The registry is not
+     * thread-safe.
+     */
+    class UnitRegistry {
+
+        memory::FlatHashMap<uint32_t, memory::Slab<Unit>::Handle> _index{};    //!< The slots of the units by ID
+        memory::Slab<Unit> _units{};                                            //!< The units
+
+
+    public:
+
+
+        /**
+         * Creates a unit
+         * @param id ID of the unit
+         * @return Pointer to the unit (nullptr, if the ID is used)
+         */
+        Unit *create(uint32_t id) {
+
+            // reserve the entry of the ID (one probe)
+            auto entry = _index.insert(id, 0);
+            if(!entry.second)
+                return nullptr;
+
+            *entry.first = _units.create();
+
+            return &_units[*entry.first];
+
+        }
+
+
+        /**
+         * Destroys the unit
+         * @param id ID of the unit
+         * @return Flag indicating whether the unit existed
+         */
+        bool destroy(uint32_t id) {
+
+            auto handle = _index.find(id);
+            if(handle == nullptr)
+                return false;
+
+            _units.destroy(*handle);
+            _index.erase(id);
+
+            return true;
+
+        }
+
+
+        /**
+         * Returns the unit
+         * @param id ID of the unit
+         * @return Pointer to the unit (nullptr, if the unit does not exist)
+         */
+        Unit *find(uint32_t id) {
+
+            auto handle = _index.find(id);
+            return handle == nullptr ? nullptr : &_units[*handle];
+
+        }
+
+
+        /**
+         * Returns the number of units
+         * @return Number of units
+         */
+        size_t size() const {
+
+            return _units.size();
+
+        }
+
+
+        /**
+         * Reserves memory for the given number of units
+         * @param n Number of units
+         */
+        void reserve(size_t n) {
+
+            _index.reserve(n);
+            _units.reserve(n);
+
+        }
+
+
+        /**
+         * Returns the memory allocated by the registry
+         * @return Memory in bytes
+         */
+        size_t memoryUsage() const {
+
+            return _index.memoryUsage() + _units.memoryUsage();
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_UNITREGISTRY_H
@@ -0,0 +1,343 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_EVENTTIMESERVER_H
+#define DUMMYPROJECT_EVENTTIMESERVER_H
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include "Model.h"
+
+namespace sim {
+
+
+    /**
+     * @brief An event kernel, which executes fixed-step and event-driven models (@see Model::setExecutionMode()).
+     *
+     * The model steps are kept as events in a priority queue, which is ordered by the step time and the index of the
+     * model. Event-driven models only enter the queue, when they were woken up (by a requested wake-up time or by a
+     * triggering input), so idle models cost nothing. The kernel is the scheduler of the registered models and is
+     * notified about wake-ups immediately. Fixed-step models are re-scheduled with their next step time after every
+     * step.
+     *
+     * In a simulation step, the due models are executed in the order of registration. Models woken up at the actual
+     * time by a model executed in the same step (e.g. by a changed output) are executed in the same step. Every model
+     * is executed at most once per step, so a model woken up again in the step, in which it was executed, is due at the
+     * same time in the next step (the next step time of the server does not advance).
+     *
+     * Inactive models are not scheduled. A model deactivated while it is scheduled drops out of the schedule after its
+     * pending step and is scheduled again, when it is activated (@see Model::activate()).
+     *
+     * Events are not removed from the queue, when a model is woken up earlier. Outdated events are skipped instead.
+     * The models are not owned by the time server and must outlive it. The wake-ups must be requested by the thread
+     * executing the time server.
+     *
+     * @tparam Time Time type of the models (@see TimeTraits)
+     */
+    template<typename Time>
+    class BasicEventTimeServer : public BasicScheduler<Time> {
+
+    protected:
+
+        typedef TimeTraits<Time> Traits;        //!< The arithmetic of the time base
+
+        //!< A step of a model
+        struct Event {
+
+            Time time;    //!< Step time
+            size_t index; //!< Index of the model
+
+            //!< Order of the queue: earliest step first, then order of registration
+            bool operator>(const Event &other) const {
+
+                return other.time < time || (time == other.time && index > other.index);
+
+            }
+
+        };
+
+        std::vector<BasicModelBase<Time> *> _models{};           //!< The registered models
+        std::unordered_map<BasicModelBase<Time> *, size_t> _indexes{}; //!< The indexes of the registered models
+        std::priority_queue<Event, std::vector<Event>, std::greater<Event>> _queue{}; //!< The scheduled steps
+        std::vector<Time> _scheduled{};          //!< The step time of the valid event of each model
+        std::vector<char> _executed{};           //!< Flags of the models executed in the actual step
+        std::vector<size_t> _due{};              //!< The indexes of the models due in the actual round
+        std::vector<size_t> _done{};             //!< The indexes of the models executed in the actual step
+        std::vector<size_t> _deferred{};         //!< The models due again in the actual step
+        Time _now = Traits::never();             //!< The actual simulation time
+
+
+    public:
+
+
+        /**
+         * Constructor
+         */
+        BasicEventTimeServer() = default;
+
+
+        /**
+         * Destructor. Detaches the time server from the models.
+         */
+        ~BasicEventTimeServer() override {
+
+            for(auto model : _models)
+                model->setScheduler(nullptr);
+
+        }
+
+
+        BasicEventTimeServer(const BasicEventTimeServer &) = delete;
+        BasicEventTimeServer &operator=(const BasicEventTimeServer &) = delete;
+
+
+        /**
+         * @brief Registers a model to the time server.
+         *
+         * The model shall be initialized before registration, since the next step time is taken at registration.
+         *
+         * @param model Model to be registered
+         */
+        void registerModel(BasicModelBase<Time> *model) {
+
+            // check model
+            if(model == nullptr)
+                throw std::invalid_argument("Model must not be null.");
+            else if(_indexes.count(model) != 0)
+                throw std::invalid_argument("Model is already registered.");
+
+            // add model
+            _indexes[model] = _models.size();
+            _models.push_back(model);
+            _scheduled.push_back(Traits::infinity());
+            _executed.push_back(0);
+
+            // attach and schedule
+            model->setScheduler(this);
+            schedule(_models.size() - 1);
+
+        }
+
+
+        /**
+         * @brief Rebuilds the schedule from the actual next step times of the models.
+         *
+         * This must be called, when the models were changed from outside of the time server in a way that the next step
+         * time has changed (e.g. by activation or re-initialization). Wake-ups are scheduled automatically.
+         */
+        void reschedule() {
+
+            _queue = decltype(_queue){};
+            std::fill(_scheduled.begin(), _scheduled.end(), Traits::infinity());
+
+            for(size_t i = 0; i < _models.size(); ++i)
+                schedule(i);
+
+        }
+
+
+        /**
+         * Schedules the model with its actual next step time, if it is earlier than the scheduled time
+         * @param model Model
+         */
+        void reschedule(BasicModelBase<Time> *model) override {
+
+            auto it = _indexes.find(model);
+            if(it == _indexes.end())
+                throw std::invalid_argument("Model is not registered.");
+
+            schedule(it->second);
+
+        }
+
+
+        /**
+         * Returns the number of registered models
+         * @return Number of models
+         */
+        size_t size() const {
+
+            return _models.size();
+
+        }
+
+
+        /**
+         * Returns the number of scheduled events (including outdated events)
+         * @return Number of events
+         */
+        size_t pending() const {
+
+            return _queue.size();
+
+        }
+
+
+        /**
+         * Returns the simulation time of the next due model step
+         * @return Next step time (infinity, if no step is scheduled)
+         */
+        Time getNextStepTime() const {
+
+            return _queue.empty() ? Traits::infinity() : _queue.top().time;
+
+        }
+
+
+        /**
+         * @brief Executes the models which are due at the given simulation time.
+         *
+         * Every due model is stepped at most once (@see Model::simStep()) and is re-scheduled with its new next step
+         * time afterwards.
+         *
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        unsigned long step(Time simTime) {
+
+            _now = simTime;
+
+            unsigned long steps = 0;
+            while(isDue(simTime)) {
+
+                // take due events
+                _due.clear();
+                while(isDue(simTime)) {
+
+                    auto event = _queue.top();
+                    _queue.pop();
+
+                    // skip outdated events
+                    if(event.time != _scheduled[event.index])
+                        continue;
+
+                    _scheduled[event.index] = Traits::infinity();
+
+                    if(_executed[event.index] != 0)
+                        _deferred.push_back(event.index);
+                    else
+                        _due.push_back(event.index);
+
+                }
+
+                // execute in registration order
+                std::sort(_due.begin(), _due.end());
+                for(auto i : _due) {
+                    _executed[i] = 1;
+                    _done.push_back(i);
+                }
+
+                steps += execute(simTime);
+
+                // re-schedule models
+                for(auto i : _due)
+                    schedule(i);
+
+            }
+
+            // models due again are executed in the next step
+            for(auto i : _deferred)
+                schedule(i);
+
+            for(auto i : _done)
+                _executed[i] = 0;
+
+            _deferred.clear();
+            _done.clear();
+
+            // drop outdated events from the top
+            while(!_queue.empty() && _queue.top().time != _scheduled[_queue.top().index])
+                _queue.pop();
+
+            return steps;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Executes the simulation step of the due models (@see _due)
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        virtual unsigned long execute(Time simTime) {
+
+            unsigned long steps = 0;
+            for(auto i : _due)
+                steps += _models[i]->simStep(simTime) ? 1 : 0;
+
+            return steps;
+
+        }
+
+
+        /**
+         * Returns true, if the next event is due at the given simulation time
+         * @param simTime Simulation time
+         * @return Due flag
+         */
+        bool isDue(Time simTime) const {
+
+            return !_queue.empty() && Traits::reached(simTime, _queue.top().time);
+
+        }
+
+
+        /**
+         * Adds an event for the next step of the model with the given index, if it is earlier than the scheduled one
+         * @param index Index of the model
+         */
+        void schedule(size_t index) {
+
+            // inactive models are scheduled again at their activation
+            if(!_models[index]->isActive())
+                return;
+
+            // steps in the past are performed at the actual time
+            auto time = std::max(_now, _models[index]->getNextStepTime());
+            if(!(time < _scheduled[index]))
+                return;
+
+            _scheduled[index] = time;
+            _queue.push(Event{time, index});
+
+        }
+
+    };
+
+
+    //!< The event kernel of the models with the floating point time base
+    typedef BasicEventTimeServer<double> EventTimeServer;
+
+    //!< The event kernel of the models with the integer time base
+    typedef BasicEventTimeServer<Ticks> TickEventTimeServer;
+
+}
+
+#endif //DUMMYPROJECT_EVENTTIMESERVER_H
@@ -0,0 +1,357 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_FORK_H
+#define DUMMYPROJECT_FORK_H
+
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+#include <parallel/ThreadPool.h>
+#include "Model.h"
+#include "TimeServer.h"
+
+namespace sim {
+
+
+    /**
+     * @brief The immutable state of a set of models at the fork time.
+     *
+     * The image holds one snapshot record per model (@see ModelBase::saveState()) in a single buffer. It is shared by all
+     * branches forked from it and released with the last branch.
+     */
+    struct ForkImage {
+
+        double simTime;                                 //!< The simulation time of the fork
+        std::vector<char> data{};                       //!< The records of the models
+        std::vector<size_t> offsets{};                  //!< The offsets of the records (size: models + 1)
+
+    };
+
+
+    /**
+     * @brief A branch of a forked simulation.
+     *
+     * The models of a branch share the state of the fork image copy-on-write: a model is only materialized (instantiated
+     * and restored from the image) when it is accessed for the first time, either to be changed (@see get()) or to be
+     * simulated (@see run()). Until then, the branch does not hold any memory for the model.
+     */
+    class Branch {
+
+    public:
+
+        typedef std::function<std::unique_ptr<ModelBase>(size_t)> Factory;
+
+
+    protected:
+
+        std::shared_ptr<const ForkImage> _image;        //!< The shared image
+        std::shared_ptr<const Factory> _factory;        //!< The factory to instantiate the models
+        std::vector<std::unique_ptr<ModelBase>> _models; //!< The materialized models (nullptr: shared)
+        double _simTime;                                //!< The actual simulation time of the branch
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param image Image to branch from
+         * @param factory Factory to instantiate the model with the given index
+         */
+        Branch(std::shared_ptr<const ForkImage> image, std::shared_ptr<const Factory> factory)
+                : _image(std::move(image)), _factory(std::move(factory)),
+                  _models(_image->offsets.size() - 1), _simTime(_image->simTime) {}
+
+
+        /**
+         * Returns the number of models in the branch
+         * @return Number of models
+         */
+        size_t size() const {
+
+            return _models.size();
+
+        }
+
+
+        /**
+         * Returns the actual simulation time of the branch
+         * @return Simulation time
+         */
+        double getSimTime() const {
+
+            return _simTime;
+
+        }
+
+
+        /**
+         * Returns true when the model still shares the state of the image
+         * @param index Index of the model
+         * @return Shared flag
+         */
+        bool isShared(size_t index) const {
+
+            return !_models.at(index);
+
+        }
+
+
+        /**
+         * Returns the model with the given index, which is materialized on the first access
+         * @param index Index of the model
+         * @return Model
+         */
+        ModelBase *get(size_t index) {
+
+            auto &model = _models.at(index);
+            if(!model)
+                model = materialize(index);
+
+            return model.get();
+
+        }
+
+
+        /**
+         * Returns the model with the given index casted to the given type, @see get()
+         * @tparam T Type of the model
+         * @param index Index of the model
+         * @return Model
+         */
+        template<typename T>
+        T *get(size_t index) {
+
+            auto model = dynamic_cast<T *>(get(index));
+            if(model == nullptr)
+                throw std::invalid_argument("Model is not of the requested type.");
+
+            return model;
+
+        }
+
+
+        /**
+         * @brief Simulates the branch until the given end time.
+         *
+         * All models are materialized and executed by a time server with the given simulation time step size, starting
+         * one step after the actual simulation time of the branch.
+         *
+         * @param endTime Simulation time to be reached
+         * @param timeStepSize Simulation time step size
+         * @return Number of performed model steps
+         */
+        unsigned long run(double endTime, double timeStepSize) {
+
+            if(timeStepSize <= 0.0)
+                throw std::invalid_argument("Time step size must be positive.");
+
+            // materialize all models
+            TimeServer server{};
+            for(size_t i = 0; i < _models.size(); ++i)
+                server.registerModel(get(i));
+
+            // simulate (time is computed from the start to avoid accumulated errors)
+            auto start = _simTime;
+            unsigned long steps = 0;
+            for(unsigned long k = 1; start + (double) k * timeStepSize < endTime + 1e-9; ++k) {
+                _simTime = start + (double) k * timeStepSize;
+                steps += server.step(_simTime);
+            }
+
+            return steps;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Instantiates the model with the given index and restores its state from the image
+         * @param index Index of the model
+         * @return Model
+         */
+        std::unique_ptr<ModelBase> materialize(size_t index) const {
+
+            auto model = (*_factory)(index);
+            if(!model)
+                throw std::runtime_error("Factory returned no model.");
+
+            auto begin = _image->offsets[index];
+            SnapshotReader reader(_image->data.data() + begin, _image->offsets[index + 1] - begin);
+            model->loadState(reader);
+
+            return model;
+
+        }
+
+    };
+
+
+    /**
+     * @brief Forks a running set of models into branches, which can be simulated independently.
+     *
+     * On the fork, the state of the models is captured once into an image, which is shared copy-on-write by all
+     * branches (@see Branch). A warm-up phase is therefore simulated once and each branch only pays for the models it
+     * actually touches. The models must implement saveState() and loadState() for their whole state (including
+     * parameters, which shall be varied in the branches). The factory must return a new instance of the same type as
+     * the model with the given index; the instance does not need to be created or initialized, since the lifecycle
+     * state is restored from the image.
+     *
+     * The forked models are not changed and may be continued or dropped after the fork.
+     */
+    class Fork {
+
+    protected:
+
+        std::shared_ptr<const ForkImage> _image;        //!< The shared image
+        std::shared_ptr<const Branch::Factory> _factory; //!< The factory to instantiate the models
+        parallel::ThreadPool *_pool;                    //!< The thread pool (nullptr: serial)
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param models Models to be forked
+         * @param simTime The actual simulation time of the models
+         * @param factory Factory to instantiate the model with the given index
+         * @param pool Thread pool to run the branches in parallel (nullptr: serial)
+         */
+        Fork(const std::vector<ModelBase *> &models, double simTime, Branch::Factory factory,
+                parallel::ThreadPool *pool = nullptr)
+                : _image(capture(models, simTime)),
+                  _factory(std::make_shared<const Branch::Factory>(std::move(factory))),
+                  _pool(pool) {
+
+            if(!*_factory)
+                throw std::invalid_argument("Factory must not be empty.");
+
+        }
+
+
+        /**
+         * Returns the image of the fork
+         * @return Image
+         */
+        const ForkImage &getImage() const {
+
+            return *_image;
+
+        }
+
+
+        /**
+         * Creates branches, which share the state of the image
+         * @param n Number of branches
+         * @return Branches
+         */
+        std::vector<Branch> branch(size_t n) const {
+
+            std::vector<Branch> branches{};
+            branches.reserve(n);
+            for(size_t i = 0; i < n; ++i)
+                branches.emplace_back(_image, _factory);
+
+            return branches;
+
+        }
+
+
+        /**
+         * Simulates the branches until the given end time, in parallel if a thread pool is set (@see Branch::run())
+         * @param branches Branches to be simulated
+         * @param endTime Simulation time to be reached
+         * @param timeStepSize Simulation time step size
+         * @return Number of performed model steps of all branches
+         */
+        unsigned long run(std::vector<Branch> &branches, double endTime, double timeStepSize) const {
+
+            std::vector<unsigned long> steps(branches.size(), 0);
+            auto function = [&branches, &steps, endTime, timeStepSize](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i)
+                    steps[i] = branches[i].run(endTime, timeStepSize);
+            };
+
+            // one branch per chunk, since branches are coarse
+            if(_pool != nullptr)
+                _pool->parallelFor(branches.size(), function, 1);
+            else if(!branches.empty())
+                function(0, branches.size());
+
+            unsigned long total = 0;
+            for(auto s : steps)
+                total += s;
+
+            return total;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Writes the state of the models into a new image
+         * @param models Models
+         * @param simTime Simulation time of the fork
+         * @return Image
+         */
+        static std::shared_ptr<const ForkImage> capture(const std::vector<ModelBase *> &models, double simTime) {
+
+            auto image = std::make_shared<ForkImage>();
+            image->simTime = simTime;
+
+            // record sizes
+            image->offsets.resize(models.size() + 1, 0);
+            for(size_t i = 0; i < models.size(); ++i) {
+
+                if(models[i] == nullptr)
+                    throw std::invalid_argument("Model must not be null.");
+
+                SnapshotWriter counter{};
+                models[i]->saveState(counter);
+                image->offsets[i + 1] = image->offsets[i] + counter.size();
+
+            }
+
+            // write records
+            image->data.resize(image->offsets.back());
+            for(size_t i = 0; i < models.size(); ++i) {
+                SnapshotWriter writer(image->data.data() + image->offsets[i]);
+                models[i]->saveState(writer);
+            }
+
+            return image;
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_FORK_H
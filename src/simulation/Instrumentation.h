@@ -0,0 +1,465 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_INSTRUMENTATION_H
+#define DUMMYPROJECT_INSTRUMENTATION_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <stats/AtomicHistogram.h>
+#include <stats/Histogram.h>
+
+namespace sim {
+
+
+    /**
+     * @brief The step statistics of a model at the time of a snapshot
+     */
+    struct StepStatistics {
+
+        std::string id{};               //!< ID of the model
+        std::string name{};             //!< Name of the model
+        uint64_t executed = 0;          //!< Number of executed steps
+        uint64_t skipped = 0;           //!< Number of simulation steps without a model step
+        stats::Histogram latency{1};    //!< Durations of the executed steps in nanoseconds
+
+    };
+
+
+    /**
+     * @brief Records the step durations and the skipped steps of one model.
+     *
+     * A model owns a probe when the simulation is compiled with SIM_INSTRUMENTATION (CMake option
+     * DUMMY_ENABLE_INSTRUMENTATION). The probe registers itself at the global Instrumentation while it exists. Recording
+     * is lock-free and does not allocate, so the probe may be read by another thread while the model is stepped.
+     */
+    class StepProbe {
+
+        friend class Instrumentation;
+
+    public:
+
+        static constexpr unsigned PRECISION = 4;                    //!< Sub-bucket bits (relative error < 6.25 %)
+        static constexpr uint64_t HIGHEST = uint64_t(1) << 36;      //!< Highest tracked duration (~69 s)
+
+    protected:
+
+        stats::AtomicHistogram _latency{PRECISION, HIGHEST};        //!< Durations of the executed steps [ns]
+        std::atomic<uint64_t> _skipped{0};                          //!< Number of skipped steps
+        std::string _id{};                                          //!< ID of the model (guarded by the registry)
+        std::string _name{};                                        //!< Name of the model (guarded by the registry)
+        uint64_t _sequence = 0;                                     //!< Registration number
+
+
+    public:
+
+
+        /**
+         * Constructor. Registers the probe.
+         */
+        inline StepProbe();
+
+
+        /**
+         * Destructor. Unregisters the probe.
+         */
+        inline ~StepProbe();
+
+
+        StepProbe(const StepProbe &) = delete;
+        StepProbe &operator=(const StepProbe &) = delete;
+
+
+        /**
+         * Returns the time of a monotonic clock
+         * @return Time in nanoseconds
+         */
+        static uint64_t now() {
+
+            return (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now().time_since_epoch()).count();
+
+        }
+
+
+        /**
+         * Records an executed step
+         * @param duration Duration of the step in nanoseconds
+         */
+        void executed(uint64_t duration) {
+
+            _latency.record(duration);
+
+        }
+
+
+        /**
+         * Records a simulation step, in which the model was not stepped
+         */
+        void skipped() {
+
+            _skipped.fetch_add(1, std::memory_order_relaxed);
+
+        }
+
+
+        /**
+         * Sets the labels of the statistics
+         * @param id ID of the model
+         * @param name Name of the model
+         */
+        inline void setLabel(const std::string &id, const std::string &name);
+
+
+        /**
+         * Returns the statistics recorded since the construction or the last reset
+         * @return Statistics
+         */
+        inline StepStatistics snapshot() const;
+
+
+        /**
+         * Removes all recorded values
+         */
+        void reset() {
+
+            _latency.reset();
+            _skipped.store(0, std::memory_order_relaxed);
+
+        }
+
+    };
+
+
+    /**
+     * @brief The registry of all step probes, which takes snapshots of the statistics of all models and writes them
+     * as JSON or in the Prometheus text format.
+     *
+     * Registering and reading is guarded by a mutex, recording is not (@see StepProbe). Without SIM_INSTRUMENTATION no
+     * probe is created and the snapshots are empty.
+     */
+    class Instrumentation {
+
+        friend class StepProbe;
+
+    protected:
+
+        mutable std::mutex _mutex{};                                //!< Guards the probes and their labels
+        std::map<uint64_t, StepProbe *> _probes{};                  //!< The probes by registration number
+        uint64_t _sequence = 0;                                     //!< The last registration number
+
+
+    public:
+
+
+        /**
+         * Returns the global registry
+         * @return Registry
+         */
+        static Instrumentation &global() {
+
+            static Instrumentation instance{};
+            return instance;
+
+        }
+
+
+        /**
+         * Returns true, if the models are compiled with instrumentation
+         * @return Flag
+         */
+        static constexpr bool enabled() {
+
+#ifdef SIM_INSTRUMENTATION
+            return true;
+#else
+            return false;
+#endif
+
+        }
+
+
+        /**
+         * Returns the number of registered probes
+         * @return Number of probes
+         */
+        size_t size() const {
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _probes.size();
+
+        }
+
+
+        /**
+         * Returns the statistics of all registered probes in the order of their registration
+         * @return Statistics
+         */
+        std::vector<StepStatistics> snapshot() const {
+
+            std::lock_guard<std::mutex> lock(_mutex);
+
+            std::vector<StepStatistics> statistics{};
+            statistics.reserve(_probes.size());
+
+            for(auto &p : _probes)
+                statistics.emplace_back(snapshot(*p.second));
+
+            return statistics;
+
+        }
+
+
+        /**
+         * Removes the recorded values of all registered probes
+         */
+        void reset() {
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            for(auto &p : _probes)
+                p.second->reset();
+
+        }
+
+
+        /**
+         * Writes the statistics as JSON (an array of models with their counters and latency percentiles in ns)
+         * @param os Output stream
+         * @param statistics Statistics
+         */
+        static void writeJSON(std::ostream &os, const std::vector<StepStatistics> &statistics) {
+
+            auto flags = os.flags();
+            auto precision = os.precision();
+
+            os << "{\"models\":[";
+
+            for(size_t i = 0; i < statistics.size(); ++i) {
+
+                auto &s = statistics[i];
+                auto &h = s.latency;
+
+                os << (i == 0 ? "" : ",") << "{\"id\":";
+                writeString(os, s.id, '"');
+                os << ",\"name\":";
+                writeString(os, s.name, '"');
+                os << ",\"executed\":" << s.executed << ",\"skipped\":" << s.skipped
+                   << ",\"latency_ns\":{\"count\":" << h.count() << ",\"min\":" << h.min() << ",\"max\":" << h.max()
+                   << ",\"mean\":" << std::fixed << std::setprecision(1) << h.mean()
+                   << ",\"p50\":" << h.percentile(50.0) << ",\"p90\":" << h.percentile(90.0)
+                   << ",\"p99\":" << h.percentile(99.0) << ",\"p999\":" << h.percentile(99.9) << "}}";
+
+            }
+
+            os << "]}\n";
+
+            os.flags(flags);
+            os.precision(precision);
+
+        }
+
+
+        /**
+         * @brief Writes the statistics in the Prometheus text exposition format
+         *
+         * The step counters are written as counter sim_model_steps_total (label result: executed or skipped), the step
+         * durations as histogram sim_model_step_duration_seconds with fixed bucket bounds from 100 ns to 100 ms, so
+         * the buckets of all models can be aggregated. The models are labelled by their ID and name.
+         *
+         * @param os Output stream
+         * @param statistics Statistics
+         */
+        static void writePrometheus(std::ostream &os, const std::vector<StepStatistics> &statistics) {
+
+            static const uint64_t bounds[] = {100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000,
+                                              500000, 1000000, 2500000, 5000000, 10000000, 25000000, 50000000,
+                                              100000000};
+
+            auto flags = os.flags();
+            auto precision = os.precision();
+            os << std::defaultfloat << std::setprecision(9);
+
+            os << "# HELP sim_model_steps_total Number of simulation steps of the model.\n"
+               << "# TYPE sim_model_steps_total counter\n";
+
+            for(auto &s : statistics) {
+                os << "sim_model_steps_total{";
+                writeLabels(os, s);
+                os << ",result=\"executed\"} " << s.executed << "\n";
+                os << "sim_model_steps_total{";
+                writeLabels(os, s);
+                os << ",result=\"skipped\"} " << s.skipped << "\n";
+            }
+
+            os << "# HELP sim_model_step_duration_seconds Duration of the executed steps of the model.\n"
+               << "# TYPE sim_model_step_duration_seconds histogram\n";
+
+            for(auto &s : statistics) {
+
+                // cumulative counts (a histogram bucket is counted when it lies completely below the bound)
+                uint64_t cumulative[sizeof(bounds) / sizeof(bounds[0])] = {};
+                s.latency.forEach([&cumulative](uint64_t, uint64_t upper, uint64_t count) {
+                    for(size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); ++i) {
+                        if(upper <= bounds[i])
+                            cumulative[i] += count;
+                    }
+                });
+
+                for(size_t i = 0; i < sizeof(bounds) / sizeof(bounds[0]); ++i) {
+                    os << "sim_model_step_duration_seconds_bucket{";
+                    writeLabels(os, s);
+                    os << ",le=\"" << (double) bounds[i] * 1e-9 << "\"} " << cumulative[i] << "\n";
+                }
+
+                os << "sim_model_step_duration_seconds_bucket{";
+                writeLabels(os, s);
+                os << ",le=\"+Inf\"} " << s.latency.count() << "\n";
+
+                os << "sim_model_step_duration_seconds_sum{";
+                writeLabels(os, s);
+                os << "} " << s.latency.mean() * (double) s.latency.count() * 1e-9 << "\n";
+
+                os << "sim_model_step_duration_seconds_count{";
+                writeLabels(os, s);
+                os << "} " << s.latency.count() << "\n";
+
+            }
+
+            os.flags(flags);
+            os.precision(precision);
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Takes the snapshot of a probe (the mutex must be locked)
+         * @param probe Probe
+         * @return Statistics
+         */
+        static StepStatistics snapshot(const StepProbe &probe) {
+
+            StepStatistics statistics{};
+            statistics.id = probe._id;
+            statistics.name = probe._name;
+            statistics.latency = probe._latency.snapshot();
+            statistics.executed = statistics.latency.count();
+            statistics.skipped = probe._skipped.load(std::memory_order_relaxed);
+
+            return statistics;
+
+        }
+
+
+        /**
+         * Writes a quoted string with the escapes of JSON and of the Prometheus label values
+         * @param os Output stream
+         * @param value String
+         * @param quote Quote character
+         */
+        static void writeString(std::ostream &os, const std::string &value, char quote) {
+
+            os << quote;
+            for(char c : value) {
+                if(c == '"' || c == '\\')
+                    os << '\\' << c;
+                else if(c == '\n')
+                    os << "\\n";
+                else if((unsigned char) c < 0x20)
+                    os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int) c << std::dec
+                       << std::setfill(' ');
+                else
+                    os << c;
+            }
+            os << quote;
+
+        }
+
+
+        /**
+         * Writes the model labels of the Prometheus format
+         * @param os Output stream
+         * @param statistics Statistics of the model
+         */
+        static void writeLabels(std::ostream &os, const StepStatistics &statistics) {
+
+            os << "id=";
+            writeString(os, statistics.id, '"');
+            os << ",name=";
+            writeString(os, statistics.name, '"');
+
+        }
+
+    };
+
+
+    StepProbe::StepProbe() {
+
+        auto &registry = Instrumentation::global();
+        std::lock_guard<std::mutex> lock(registry._mutex);
+
+        _sequence = ++registry._sequence;
+        registry._probes.emplace(_sequence, this);
+
+    }
+
+
+    StepProbe::~StepProbe() {
+
+        auto &registry = Instrumentation::global();
+        std::lock_guard<std::mutex> lock(registry._mutex);
+
+        registry._probes.erase(_sequence);
+
+    }
+
+
+    void StepProbe::setLabel(const std::string &id, const std::string &name) {
+
+        std::lock_guard<std::mutex> lock(Instrumentation::global()._mutex);
+
+        _id = id;
+        _name = name;
+
+    }
+
+
+    StepStatistics StepProbe::snapshot() const {
+
+        std::lock_guard<std::mutex> lock(Instrumentation::global()._mutex);
+        return Instrumentation::snapshot(*this);
+
+    }
+
+}
+
+#endif //DUMMYPROJECT_INSTRUMENTATION_H
@@ -25,19 +25,161 @@
 #ifndef DUMMYPROJECT_MODEL_H
 #define DUMMYPROJECT_MODEL_H
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <string>
+#include <type_traits>
+#include <google/protobuf/arena.h>
+#include <profiling/Tracer.h>
 #include <simulation.pb.h>
+#include "SnapshotStream.h"
+#include "Time.h"
+
+#ifdef SIM_INSTRUMENTATION
+#include "Instrumentation.h"
+#endif
 
 namespace sim {
 
 
+    template<typename Time>
+    class BasicModelBase;
+
+
+    /**
+     * @brief The interface of a scheduler of models (@see BasicEventTimeServer), which is notified when the next step
+     * time of a model is brought forward from outside of the scheduler (e.g. by a wake-up of an event-driven model)
+     * @tparam Time Time type (@see TimeTraits)
+     */
+    template<typename Time>
+    class BasicScheduler {
+
+    public:
+
+        /**
+         * Destructor
+         */
+        virtual ~BasicScheduler() = default;
+
+
+        /**
+         * Schedules the model with its actual next step time, if it is earlier than the scheduled time
+         * @param model Model
+         */
+        virtual void reschedule(BasicModelBase<Time> *model) = 0;
+
+    };
+
+
+    /**
+     * The type independent interface of a simulation model, which is used by the simulation infrastructure (e.g. the
+     * time server) to handle models with different data containers
+     * @tparam Time Time type (@see TimeTraits)
+     */
+    template<typename Time>
+    class BasicModelBase {
+
+    public:
+
+        /**
+         * Destructor
+         */
+        virtual ~BasicModelBase() = default;
+
+
+        /**
+         * Returns the ID of the model
+         * @return ID
+         */
+        virtual const std::string &getID() const = 0;
+
+
+        /**
+         * Returns the simulation time at which the next step of the model is due
+         * @return Next step time
+         */
+        virtual Time getNextStepTime() const = 0;
+
+
+        /**
+         * Returns true when the model is active
+         * @return Active flag
+         */
+        virtual bool isActive() const = 0;
+
+
+        /**
+         * Manages the simulation step of the model
+         * @param simTime The actual simulation time
+         * @return Flag indicating whether the step was performed
+         */
+        virtual bool simStep(Time simTime) = 0;
+
+
+        /**
+         * Returns true when the state of the model changed since the flag was reset (e.g. by the last snapshot)
+         * @return Dirty flag
+         */
+        virtual bool isDirty() const = 0;
+
+
+        /**
+         * Sets or resets the dirty flag
+         * @param dirty Dirty flag
+         */
+        virtual void setDirty(bool dirty) = 0;
+
+
+        /**
+         * Writes the state of the model to a snapshot record
+         * @param writer Snapshot writer
+         */
+        virtual void saveState(SnapshotWriter &writer) const = 0;
+
+
+        /**
+         * Restores the state of the model from a snapshot record
+         * @param reader Snapshot reader
+         */
+        virtual void loadState(SnapshotReader &reader) = 0;
+
+
+        /**
+         * Sets the scheduler, which is notified when the next step time of the model is brought forward
+         * @param scheduler Scheduler (nullptr: none)
+         */
+        virtual void setScheduler(BasicScheduler<Time> *) {}
+
+
+        /**
+         * Notifies the model about a change of a triggering input (@see Input::setTrigger())
+         */
+        virtual void notify() {}
+
+    };
+
+
+    //!< The interface of the models with the floating point time base
+    typedef BasicModelBase<double> ModelBase;
+
+    //!< The interface of the models with the integer time base
+    typedef BasicModelBase<Ticks> TickModelBase;
+
+
     /**
-     * An interface for the implementation of simulation models
+     * @brief An interface for the implementation of simulation models
+     *
+     * The models use the floating point time base in seconds by default. With the integer time base (Ticks), the step
+     * times are exact integer multiples of the step size and are compared without epsilon, so the steps do not drift
+     * over long runs. The time server of the models must use the same time base (@see BasicTimeServer).
+     *
      * @tparam proto Protobuf data type for the data container
+     * @tparam Time Time type (double or Ticks, @see TimeTraits)
      */
-    template<typename proto>
-    class Model {
+    template<typename proto, typename Time = double>
+    class Model : public BasicModelBase<Time> {
 
     public:
 
@@ -47,32 +189,96 @@ namespace sim {
         //!< Enum to define the model state
         enum class ModelState {INSTANTIATED, CREATED, INITIALIZED, RUNNING, PAUSED, DESTROYED};
 
+        //!< Execution mode (@see setExecutionMode())
+        enum class ExecutionMode {FIXED_STEP, EVENT_DRIVEN};
+
     protected:
 
         bool _isActive = false;                //!< Flag indicating whether the model is active
-        double _startExecTime{};               //!< The first sim time point to execute the model
-        double _timeStepSize{};                //!< Execution time step size
-        double _lastExecTime{};                //!< The next time to execute the model
-        double _originTime{};                  //!< The time from which the time tracking shall be done
+        Time _startExecTime{};                 //!< The first sim time point to execute the model
+        Time _timeStepSize{};                  //!< Execution time step size
+        Time _lastExecTime{};                  //!< The next time to execute the model
+        Time _originTime{};                    //!< The time from which the time tracking shall be done
         unsigned long _noOfExecutionSteps = 0; //!< Execution step counter from the last reset
+        bool _dirty = true;                    //!< Flag indicating a change of the state since the last snapshot
+        Time _wakeUpTime{};                    //!< The requested step time of an event-driven model
 
         TimeTrackingOriginMode _timeTrackingOriginMode
             = TimeTrackingOriginMode::FROM_LAST_STEP; //!< Time tracking mode
         ModelState _state = ModelState::INSTANTIATED; //!< Model state
+        ExecutionMode _executionMode = ExecutionMode::FIXED_STEP; //!< Execution mode
+        BasicScheduler<Time> *_scheduler = nullptr;   //!< The scheduler executing the model (optional)
+
+        //!< The fixed-size part of a snapshot record, which is copied bytewise
+        struct SnapshotHeader {
+            Time startExecTime;                        //!< The first sim time point to execute the model
+            Time timeStepSize;                         //!< Execution time step size
+            Time lastExecTime;                         //!< The next time to execute the model
+            Time originTime;                           //!< The time from which the time tracking shall be done
+            Time wakeUpTime;                           //!< The requested step time of an event-driven model
+            uint64_t noOfExecutionSteps;               //!< Execution step counter from the last reset
+            TimeTrackingOriginMode timeTrackingOriginMode; //!< Time tracking mode
+            ModelState state;                          //!< Model state
+            ExecutionMode executionMode;               //!< Execution mode
+            bool isActive;                             //!< Flag indicating whether the model is active
+        };
+
+        typedef TimeTraits<Time> Traits;       //!< The arithmetic of the time base
+
+        google::protobuf::Arena *_arena; //!< The arena of the data containers (nullptr: heap)
+        simulation::Model *_meta;        //!< The protobuf meta data container of the model
+        proto *_data;                    //!< The protobuf data container of the model
+
+#ifdef SIM_INSTRUMENTATION
+        StepProbe _probe{};              //!< Step durations and skipped steps of the model
+#endif
 
-        constexpr static const double EPS_TIME_STEP_SIZE = 1e-9; //!< The minimum time step size
 
-        simulation::Model _meta{}; //!< The protobuf meta data container of the model
-        proto _data{};             //!< The protobuf data container of the model
+    public:
 
 
-    public:
+        /**
+         * @brief Constructor
+         *
+         * The data containers are constructed on the given arena, which must outlive the model. The containers are
+         * released with the arena, so models can be created and dropped in bulk without any deallocation.
+         *
+         * @param arena Arena to construct the data containers on (nullptr: heap)
+         */
+        explicit Model(google::protobuf::Arena *arena = nullptr)
+                : _arena(arena),
+                  _meta(google::protobuf::Arena::CreateMessage<simulation::Model>(arena)),
+                  _data(createOnArena<proto>(arena,
+                          typename google::protobuf::Arena::is_arena_constructable<proto>::type())) {}
+
+
+        /**
+         * Destructor
+         */
+        ~Model() override {
+
+            // containers on the arena are released with the arena
+            if(_arena == nullptr) {
+                delete _meta;
+                delete _data;
+            }
+
+        }
+
+
+        Model(const Model &) = delete;
+        Model &operator=(const Model &) = delete;
 
 
         /**
-         * Constructor
+         * Returns the arena of the data containers
+         * @return Arena (nullptr: heap)
          */
-        Model() = default;
+        google::protobuf::Arena *getArena() const {
+
+            return _arena;
+
+        }
 
 
         /**
@@ -83,8 +289,13 @@ namespace sim {
         void setIDAndName(std::string &&id, std::string &&name) {
 
             // set name and ID
-            _meta.set_name(std::move(name));
-            _meta.set_id(std::move(id));
+            _meta->set_name(std::move(name));
+            _meta->set_id(std::move(id));
+            _dirty = true;
+
+#ifdef SIM_INSTRUMENTATION
+            _probe.setLabel(_meta->id(), _meta->name());
+#endif
 
         }
 
@@ -93,9 +304,9 @@ namespace sim {
          * Returns the ID of the model
          * @return ID
          */
-        const std::string &getID() const {
+        const std::string &getID() const override {
 
-            return _meta.id();
+            return _meta->id();
 
         }
 
@@ -106,7 +317,31 @@ namespace sim {
          */
         const std::string &getName() const {
 
-            return _meta.name();
+            return _meta->name();
+
+        }
+
+
+#ifdef SIM_INSTRUMENTATION
+        /**
+         * Returns the step probe of the model (only with SIM_INSTRUMENTATION)
+         * @return Probe
+         */
+        const StepProbe &getStepProbe() const {
+
+            return _probe;
+
+        }
+#endif
+
+
+        /**
+         * Returns the state of the model
+         * @return Model state
+         */
+        ModelState getModelState() const {
+
+            return _state;
 
         }
 
@@ -115,7 +350,7 @@ namespace sim {
          * @brief Implements the creation routine of the model.
          * In the implementation the model shall be created. This function is executed once after the model is instantiated
          * (by constructor) and registered to the simulation process. When multiple simulation are ran with the same model
-         * instance, the creation is not done prior to every simulation (@see initialize(double simTime))
+         * instance, the creation is not done prior to every simulation (@see initialize(Time simTime))
          *
          * Before this process the model was instantiated
          * After that process, the time step size should be set
@@ -130,10 +365,11 @@ namespace sim {
 
             // set state
             _state = ModelState::CREATED;
+            _dirty = true;
 
             // defaults
-            _startExecTime = 0.0;
-            _timeStepSize = 1.0;
+            _startExecTime = Traits::fromSeconds(0.0);
+            _timeStepSize = Traits::fromSeconds(1.0);
 
             // success
             return true;
@@ -146,9 +382,9 @@ namespace sim {
          *
          * * FROM_START:     The absolute time is tracked from the start of the model. This mode should be used,
          *                   when the exact step count is important or when real-time, pseudo-real-time or accelerated
-         *                   real-time simulations are performed. Delayed steps are caught up step by step until the
-         *                   times are synchronized. This mode is also called asynchronous mode, because the model does
-         *                   not run synchronized to the time server steps.
+         *                   real-time simulations are performed (@see PacedTimeServer). Delayed steps are caught up step
+         *                   by step until the times are synchronized. This mode is also called asynchronous mode,
+         *                   because the model does not run synchronized to the time server steps.
          * * FROM_LAST_STEP: The relative time is tracked from the last execution step. This mode should be used, when
          *                   the time steps shall be as equal as possible or the time tracking is very exact.
          *                   However, the error between actual simulation time and time step size times no of steps
@@ -166,6 +402,7 @@ namespace sim {
 
             // set mode
             _timeTrackingOriginMode = mode;
+            _dirty = true;
 
         }
 
@@ -178,7 +415,7 @@ namespace sim {
          *
          * @param startExecTime Start execution time
          */
-        virtual void setStartExecutionTime(double startExecTime) {
+        virtual void setStartExecutionTime(Time startExecTime) {
 
             // check state
             if(_state != ModelState::CREATED)
@@ -186,6 +423,7 @@ namespace sim {
 
             // start time
             this->_startExecTime = startExecTime;
+            _dirty = true;
 
         }
 
@@ -197,7 +435,7 @@ namespace sim {
          *
          * @param timeStepSize The time step size
          */
-        virtual void setTimeStepSize(double timeStepSize) {
+        virtual void setTimeStepSize(Time timeStepSize) {
 
             // check state
             if(_state != ModelState::CREATED)
@@ -208,6 +446,115 @@ namespace sim {
 
             // set active
             this->_isActive = true;
+            _dirty = true;
+
+        }
+
+
+        /**
+         * @brief Sets the execution mode of the model
+         *
+         * * FIXED_STEP:   The model is executed with the time step size (@see setTimeStepSize()).
+         * * EVENT_DRIVEN: The model is only executed when it was woken up, either by a requested wake-up time
+         *                 (@see wakeUp()) or by a change of a triggering input (@see Input::setTrigger()). The first step
+         *                 is performed at the start execution time, in which the model can request its next wake-up. The
+         *                 time step size passed to step() is the time since the last step. An event-driven model is
+         *                 active without setting a time step size.
+         *
+         * Fixed-step and event-driven models can be executed by the same time server. Wake-ups from outside of the
+         * model's own step (e.g. by other models) are picked up by a scheduler (@see BasicEventTimeServer) or by servers
+         * polling the models in every step (@see ModelGraph).
+         *
+         * @param mode Execution mode
+         */
+        virtual void setExecutionMode(ExecutionMode mode) {
+
+            // check state
+            if(_state != ModelState::CREATED)
+                throw std::runtime_error("Setup only possible before initialization (state = CREATED).");
+
+            // set mode
+            _executionMode = mode;
+
+            // event-driven models do not need a time step size
+            if(mode == ExecutionMode::EVENT_DRIVEN)
+                _isActive = true;
+
+            _dirty = true;
+
+        }
+
+
+        /**
+         * Returns the execution mode of the model
+         * @return Execution mode
+         */
+        ExecutionMode getExecutionMode() const {
+
+            return _executionMode;
+
+        }
+
+
+        /**
+         * @brief Requests a step of an event-driven model at the given simulation time.
+         *
+         * When several wake-ups are requested, the earliest one is performed. The wake-up is consumed by the step, so the
+         * model shall request the next wake-up in its step, if needed. Wake-ups in the past are performed at the actual
+         * simulation time.
+         *
+         * @param time Simulation time of the wake-up
+         */
+        void wakeUp(Time time) {
+
+            // check mode
+            if(_executionMode != ExecutionMode::EVENT_DRIVEN)
+                throw std::runtime_error("Only event-driven models can be woken up.");
+
+            // an earlier wake-up is pending
+            if(!(time < _wakeUpTime))
+                return;
+
+            _wakeUpTime = time;
+            _dirty = true;
+
+            // inform the scheduler
+            if(_scheduler != nullptr)
+                _scheduler->reschedule(this);
+
+        }
+
+
+        /**
+         * Returns the requested wake-up time of an event-driven model
+         * @return Wake-up time (infinity, if no wake-up is requested)
+         */
+        Time getWakeUpTime() const {
+
+            return _wakeUpTime;
+
+        }
+
+
+        /**
+         * Wakes up an event-driven model at the actual simulation time, when a triggering input changed. Fixed-step
+         * models are not affected.
+         */
+        void notify() override {
+
+            if(_executionMode == ExecutionMode::EVENT_DRIVEN)
+                wakeUp(Traits::never());
+
+        }
+
+
+        /**
+         * Sets the scheduler, which is notified about wake-ups
+         * @param scheduler Scheduler (nullptr: none)
+         */
+        void setScheduler(BasicScheduler<Time> *scheduler) override {
+
+            _scheduler = scheduler;
 
         }
 
@@ -223,7 +570,9 @@ namespace sim {
          *
          * @return Success flag
          */
-        virtual bool initialize(double simTime) {
+        virtual bool initialize(Time simTime) {
+
+            PROFILE_SPAN("model", "Model::initialize");
 
             // check state
             if(_state == ModelState::INSTANTIATED)
@@ -233,12 +582,16 @@ namespace sim {
 
             // set state
             _state = ModelState::INITIALIZED;
+            _dirty = true;
 
             // reset states
             this->reset();
 
             // set last execution time to minus inf
-            _lastExecTime = -1.0 * INFINITY;
+            _lastExecTime = Traits::never();
+
+            // first step of an event-driven model
+            _wakeUpTime = _startExecTime;
 
             // standard
             return true;
@@ -264,15 +617,45 @@ namespace sim {
          * @param simTime Actual simulation time
          * @return Flag indicating if the step shall be executed
          */
-        virtual bool isStepTime(double simTime) const {
+        virtual bool isStepTime(Time simTime) const {
+
+            // event-driven models run at their wake-up time
+            if(_executionMode == ExecutionMode::EVENT_DRIVEN)
+                return Traits::reached(simTime, _startExecTime) && Traits::reached(simTime, _wakeUpTime);
 
             // dependent on mode
             bool time2run = _timeTrackingOriginMode == TimeTrackingOriginMode::FROM_LAST_STEP
-                    ? simTime > _lastExecTime + _timeStepSize - EPS_TIME_STEP_SIZE
-                    : simTime > _startExecTime + _noOfExecutionSteps * _timeStepSize - EPS_TIME_STEP_SIZE;
+                    ? Traits::reached(simTime, _lastExecTime + _timeStepSize)
+                    : Traits::reached(simTime, _startExecTime + Traits::steps(_timeStepSize, _noOfExecutionSteps));
 
             // check
-            return (simTime > _startExecTime - EPS_TIME_STEP_SIZE) && time2run;
+            return Traits::reached(simTime, _startExecTime) && time2run;
+
+        }
+
+
+        /**
+         * @brief Returns the simulation time at which the next step of the model is due.
+         *
+         * The step is performed, when the simulation time exceeds the returned time (considering the minimum time step
+         * size). This is the same condition as checked in isStepTime(Time simTime). Models overriding isStepTime
+         * shall also override this method, since the time server schedules the models based on this time.
+         *
+         * @return Next step time
+         */
+        Time getNextStepTime() const override {
+
+            // event-driven models run at their wake-up time
+            if(_executionMode == ExecutionMode::EVENT_DRIVEN)
+                return std::max(_startExecTime, _wakeUpTime);
+
+            // dependent on mode
+            Time next = _timeTrackingOriginMode == TimeTrackingOriginMode::FROM_LAST_STEP
+                    ? _lastExecTime + _timeStepSize
+                    : _startExecTime + Traits::steps(_timeStepSize, _noOfExecutionSteps);
+
+            // not before start time
+            return std::max(_startExecTime, next);
 
         }
 
@@ -281,7 +664,7 @@ namespace sim {
          * Returns true when the model is active
          * @return Active flag
          */
-        virtual bool isActive() const {
+        bool isActive() const override {
 
             return _isActive;
 
@@ -298,7 +681,9 @@ namespace sim {
          *
          * @return
          */
-        virtual bool simStep(double simTime) {
+        bool simStep(Time simTime) override {
+
+            PROFILE_SPAN("model", "Model::simStep");
 
             // check state
             if(_state != ModelState::INITIALIZED && _state != ModelState::RUNNING)
@@ -309,18 +694,38 @@ namespace sim {
 
             if (isStepTime(simTime) && isActive()) {
 
+                // the wake-up is consumed, the step may request the next one
+                if(_executionMode == ExecutionMode::EVENT_DRIVEN)
+                    _wakeUpTime = Traits::infinity();
+
                 // execute simulation
                 this->_noOfExecutionSteps++;
-                this->step(simTime, simTime - this->_lastExecTime);
+
+                {
+                    PROFILE_SPAN("model", "Model::step");
+
+#ifdef SIM_INSTRUMENTATION
+                    auto start = StepProbe::now();
+                    this->step(simTime, Traits::difference(simTime, this->_lastExecTime));
+                    _probe.executed(StepProbe::now() - start);
+#else
+                    this->step(simTime, Traits::difference(simTime, this->_lastExecTime));
+#endif
+                }
 
                 // save time
                 this->_lastExecTime = simTime;
+                this->_dirty = true;
 
                 // step performed
                 return true;
 
             }
 
+#ifdef SIM_INSTRUMENTATION
+            _probe.skipped();
+#endif
+
             // step not performed
             return false;
 
@@ -335,7 +740,7 @@ namespace sim {
          * @param timeStepSize
          * @return
          */
-        virtual bool step(double simTime, double timeStepSize) = 0;
+        virtual bool step(Time simTime, Time timeStepSize) = 0;
 
 
         /**
@@ -354,6 +759,11 @@ namespace sim {
 
             // activate
             _isActive = true;
+            _dirty = true;
+
+            // inform the scheduler
+            if(_scheduler != nullptr)
+                _scheduler->reschedule(this);
 
         }
 
@@ -366,6 +776,7 @@ namespace sim {
 
             // deactivate
             _isActive = false;
+            _dirty = true;
 
         }
 
@@ -376,7 +787,9 @@ namespace sim {
          * @param simTime Simulation time at termination
          * @return Success flag
          */
-        virtual bool terminate(double simTime) {
+        virtual bool terminate(Time simTime) {
+
+            PROFILE_SPAN("model", "Model::terminate");
 
             // check state
             if(_state != ModelState::INITIALIZED && _state != ModelState::RUNNING)
@@ -384,6 +797,7 @@ namespace sim {
 
             // set state
             _state = ModelState::CREATED;
+            _dirty = true;
 
             // success
             return true;
@@ -408,6 +822,7 @@ namespace sim {
 
             // set state
             _state = ModelState::DESTROYED;
+            _dirty = true;
 
             // success
             return true;
@@ -415,6 +830,154 @@ namespace sim {
         }
 
 
+        /**
+         * Returns true when the state of the model changed since the flag was reset (e.g. by the last snapshot)
+         * @return Dirty flag
+         */
+        bool isDirty() const override {
+
+            return _dirty;
+
+        }
+
+
+        /**
+         * Sets or resets the dirty flag. Models changing their data outside of the lifecycle methods and the simulation
+         * step shall set the flag.
+         * @param dirty Dirty flag
+         */
+        void setDirty(bool dirty) override {
+
+            _dirty = dirty;
+
+        }
+
+
+        /**
+         * @brief Writes the state of the model to a snapshot record.
+         *
+         * The time tracking and the model state are written as one fixed-size header (@see SnapshotHeader), the meta data
+         * and the data container as messages (or bytewise, if the data container is not a message). Models with
+         * additional state shall override this method and loadState(), call the base method first and append their
+         * state.
+         *
+         * @param writer Snapshot writer
+         */
+        void saveState(SnapshotWriter &writer) const override {
+
+            // time tracking and model state (zeroed, so the padding is written deterministically)
+            SnapshotHeader header;
+            std::memset(&header, 0, sizeof(SnapshotHeader));
+
+            header.startExecTime = _startExecTime;
+            header.timeStepSize = _timeStepSize;
+            header.lastExecTime = _lastExecTime;
+            header.originTime = _originTime;
+            header.wakeUpTime = _wakeUpTime;
+            header.noOfExecutionSteps = _noOfExecutionSteps;
+            header.timeTrackingOriginMode = _timeTrackingOriginMode;
+            header.state = _state;
+            header.executionMode = _executionMode;
+            header.isActive = _isActive;
+
+            writer.write(header);
+
+            // containers
+            writer.writeMessage(*_meta);
+            writeData(writer, *_data, typename std::is_base_of<google::protobuf::MessageLite, proto>::type());
+
+        }
+
+
+        /**
+         * Restores the state of the model from a snapshot record, @see saveState(). The header is copied directly from
+         * the record. The meta data is the identity of the model and only parsed, if the model has no ID yet (e.g. a
+         * model created by a factory), otherwise it is skipped.
+         * @param reader Snapshot reader
+         */
+        void loadState(SnapshotReader &reader) override {
+
+            // time tracking and model state
+            SnapshotHeader header;
+            reader.read(header);
+
+            _startExecTime = header.startExecTime;
+            _timeStepSize = header.timeStepSize;
+            _lastExecTime = header.lastExecTime;
+            _originTime = header.originTime;
+            _wakeUpTime = header.wakeUpTime;
+            _noOfExecutionSteps = (unsigned long) header.noOfExecutionSteps;
+            _timeTrackingOriginMode = header.timeTrackingOriginMode;
+            _state = header.state;
+            _executionMode = header.executionMode;
+            _isActive = header.isActive;
+
+            // containers
+            if(_meta->id().empty())
+                reader.readMessage(*_meta);
+            else
+                reader.skipMessage();
+
+            readData(reader, *_data, typename std::is_base_of<google::protobuf::MessageLite, proto>::type());
+
+            _dirty = false;
+
+        }
+
+
+    private:
+
+
+        //!< Writes a message data container
+        static void writeData(SnapshotWriter &writer, const proto &data, std::true_type) {
+
+            writer.writeMessage(data);
+
+        }
+
+
+        //!< Writes any other data container bytewise
+        static void writeData(SnapshotWriter &writer, const proto &data, std::false_type) {
+
+            writer.write(data);
+
+        }
+
+
+        //!< Reads a message data container
+        static void readData(SnapshotReader &reader, proto &data, std::true_type) {
+
+            reader.readMessage(data);
+
+        }
+
+
+        //!< Reads any other data container bytewise
+        static void readData(SnapshotReader &reader, proto &data, std::false_type) {
+
+            reader.read(data);
+
+        }
+
+
+        //!< Creates a message on the arena (the message uses the arena for its fields)
+        template<typename T>
+        static T *createOnArena(google::protobuf::Arena *arena, std::true_type) {
+
+            return google::protobuf::Arena::CreateMessage<T>(arena);
+
+        }
+
+
+        //!< Creates an object of any other type on the arena
+        template<typename T>
+        static T *createOnArena(google::protobuf::Arena *arena, std::false_type) {
+
+            return google::protobuf::Arena::Create<T>(arena);
+
+        }
+
+
     };
 
 }
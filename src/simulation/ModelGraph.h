@@ -0,0 +1,359 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_MODELGRAPH_H
+#define DUMMYPROJECT_MODELGRAPH_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+#include <parallel/ThreadPool.h>
+#include "Model.h"
+#include "Port.h"
+
+namespace sim {
+
+
+    /**
+     * @brief A graph of models, which are coupled by their ports and executed in the order of the data flow.
+     *
+     * The models are ordered topologically by their connections, i.e. a model is executed after all models connected to
+     * its (not delayed) inputs. Models of the same level do not depend on each other and are executed in parallel, if a
+     * thread pool is given. The levels are separated by barriers.
+     *
+     * Algebraic loops must be broken by delayed inputs, which return the output value of the last simulation step
+     * (@see connect()). Optionally, the loops can be broken automatically (@see setLoopBreaking()). Then, the connections
+     * closing a loop, when walking the graph in the order of model registration, are delayed.
+     *
+     * The models, ports and the thread pool are not owned by the graph and must outlive it.
+     */
+    class ModelGraph {
+
+    protected:
+
+        //!< A connection between two models
+        struct Connection {
+            size_t from;        //!< Index of the model owning the output
+            size_t to;          //!< Index of the model owning the input
+            InputBase *input;   //!< The input
+        };
+
+        parallel::ThreadPool *_pool;                        //!< The thread pool (optional)
+        bool _breakLoops = false;                           //!< Flag to break algebraic loops automatically
+
+        std::vector<ModelBase *> _models{};                 //!< The registered models
+        std::unordered_map<ModelBase *, size_t> _indexes{}; //!< The indexes of the registered models
+        std::vector<Connection> _connections{};             //!< The connections
+        std::vector<InputBase *> _delayed{};                //!< The delayed inputs
+
+        bool _ordered = false;                              //!< Flag indicating whether the levels are valid
+        std::vector<std::vector<size_t>> _levels{};         //!< The models ordered by levels
+
+        double _simTime = 0.0;                              //!< The actual simulation time
+        unsigned long _steps = 0;                           //!< The number of steps performed in the actual step
+        const std::vector<size_t> *_level = nullptr;        //!< The level executed in parallel
+        std::vector<char> _done{};                          //!< The step flags of the models of the level
+        parallel::ThreadPool::RangeFunction _function;      //!< The function executing a range of the level
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param pool Thread pool to execute independent models in parallel (nullptr = serial execution)
+         */
+        explicit ModelGraph(parallel::ThreadPool *pool = nullptr) : _pool(pool) {
+
+            // create function once to avoid allocations in every step
+            _function = [this](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i)
+                    _done[i] = _models[(*_level)[i]]->simStep(_simTime) ? 1 : 0;
+            };
+
+        }
+
+
+        ModelGraph(const ModelGraph &) = delete;
+        ModelGraph &operator=(const ModelGraph &) = delete;
+
+
+        /**
+         * Destructor
+         */
+        virtual ~ModelGraph() = default;
+
+
+        /**
+         * Adds a model to the graph
+         * @param model Model to be added
+         */
+        void addModel(ModelBase *model) {
+
+            // check model
+            if(model == nullptr)
+                throw std::invalid_argument("Model must not be null.");
+            else if(_indexes.count(model) != 0)
+                throw std::invalid_argument("Model is already part of the graph.");
+
+            // add model
+            _indexes[model] = _models.size();
+            _models.push_back(model);
+
+            // order must be updated
+            _ordered = false;
+
+        }
+
+
+        /**
+         * @brief Connects the output of a model with the input of another model.
+         *
+         * Both models must be added to the graph before. A delayed input returns the value of the output of the last
+         * simulation step, which breaks algebraic loops. Connecting an input again replaces its connection.
+         *
+         * @tparam T Data type of the ports
+         * @param output Output
+         * @param input Input
+         * @param delayed Flag to delay the input by one step
+         */
+        template<typename T>
+        void connect(const Output<T> &output, Input<T> &input, bool delayed = false) {
+
+            // get models
+            auto from = _indexes.find(output.getOwner());
+            auto to = _indexes.find(input.getOwner());
+
+            // check models
+            if(from == _indexes.end() || to == _indexes.end())
+                throw std::invalid_argument("The models of the ports must be added to the graph.");
+
+            // connect
+            input.connect(output);
+            input.setDelayed(delayed);
+
+            // replace the connection of the input or add a new one
+            auto it = std::find_if(_connections.begin(), _connections.end(),
+                    [&input](const Connection &c) { return c.input == &input; });
+
+            if(it != _connections.end())
+                *it = Connection{from->second, to->second, &input};
+            else
+                _connections.push_back(Connection{from->second, to->second, &input});
+
+            // order must be updated
+            _ordered = false;
+
+        }
+
+
+        /**
+         * Enables or disables the automatic breaking of algebraic loops
+         * @param breakLoops Flag to break loops automatically
+         */
+        void setLoopBreaking(bool breakLoops) {
+
+            _breakLoops = breakLoops;
+            _ordered = false;
+
+        }
+
+
+        /**
+         * Returns the models ordered by levels. The models of a level do not depend on each other.
+         * @return Levels of model indexes
+         */
+        const std::vector<std::vector<size_t>> &getLevels() {
+
+            if(!_ordered)
+                order();
+
+            return _levels;
+
+        }
+
+
+        /**
+         * @brief Executes the simulation step of all models in the order of the data flow.
+         *
+         * After all models are executed, the delayed inputs are updated.
+         *
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        unsigned long step(double simTime) {
+
+            // update order
+            if(!_ordered)
+                order();
+
+            _simTime = simTime;
+            _steps = 0;
+
+            // execute levels
+            for(auto &level : _levels) {
+
+                if(_pool == nullptr || level.size() == 1) {
+
+                    for(auto i : level)
+                        _steps += _models[i]->simStep(simTime) ? 1 : 0;
+
+                } else {
+
+                    _level = &level;
+                    _done.assign(level.size(), 0);
+                    _pool->parallelFor(level.size(), _function);
+
+                    _steps += (unsigned long) std::count(_done.begin(), _done.end(), 1);
+
+                }
+
+            }
+
+            // update delayed inputs
+            for(auto in : _delayed)
+                in->latch();
+
+            return _steps;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Calculates the levels of the models (Kahn's algorithm)
+         */
+        void order() {
+
+            // break loops
+            if(_breakLoops)
+                breakLoops();
+
+            // count dependencies and collect successors
+            std::vector<size_t> dependencies(_models.size(), 0);
+            std::vector<std::vector<size_t>> successors(_models.size());
+            _delayed.clear();
+            for(auto &c : _connections) {
+
+                if(c.input->isDelayed()) {
+                    _delayed.push_back(c.input);
+                    continue;
+                }
+
+                dependencies[c.to]++;
+                successors[c.from].push_back(c.to);
+
+            }
+
+            // first level: models without dependencies
+            _levels.clear();
+            std::vector<size_t> level{};
+            for(size_t i = 0; i < _models.size(); ++i) {
+                if(dependencies[i] == 0)
+                    level.push_back(i);
+            }
+
+            // following levels
+            size_t noOfOrdered = 0;
+            while(!level.empty()) {
+
+                noOfOrdered += level.size();
+
+                std::vector<size_t> next{};
+                for(auto i : level) {
+                    for(auto j : successors[i]) {
+                        if(--dependencies[j] == 0)
+                            next.push_back(j);
+                    }
+                }
+
+                std::sort(next.begin(), next.end());
+
+                _levels.push_back(std::move(level));
+                level = std::move(next);
+
+            }
+
+            // check for loops
+            if(noOfOrdered != _models.size())
+                throw std::runtime_error("Algebraic loop detected. Use delayed inputs to break the loop.");
+
+            _ordered = true;
+
+        }
+
+
+        /**
+         * Delays the connections closing a loop (back edges of a depth-first search in the order of registration)
+         */
+        void breakLoops() {
+
+            // outgoing connections
+            std::vector<std::vector<size_t>> outgoing(_models.size());
+            for(size_t c = 0; c < _connections.size(); ++c) {
+                if(!_connections[c].input->isDelayed())
+                    outgoing[_connections[c].from].push_back(c);
+            }
+
+            // iterative depth-first search (0 = new, 1 = on stack, 2 = finished)
+            std::vector<char> mark(_models.size(), 0);
+            std::vector<std::pair<size_t, size_t>> stack{};
+            for(size_t root = 0; root < _models.size(); ++root) {
+
+                if(mark[root] != 0)
+                    continue;
+
+                mark[root] = 1;
+                stack.emplace_back(root, 0);
+
+                while(!stack.empty()) {
+
+                    auto &top = stack.back();
+                    if(top.second == outgoing[top.first].size()) {
+                        mark[top.first] = 2;
+                        stack.pop_back();
+                        continue;
+                    }
+
+                    auto &c = _connections[outgoing[top.first][top.second++]];
+                    if(mark[c.to] == 1)
+                        c.input->setDelayed(true);
+                    else if(mark[c.to] == 0) {
+                        mark[c.to] = 1;
+                        stack.emplace_back(c.to, 0);
+                    }
+
+                }
+
+            }
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_MODELGRAPH_H
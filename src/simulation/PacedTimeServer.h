@@ -0,0 +1,376 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_PACEDTIMESERVER_H
+#define DUMMYPROJECT_PACEDTIMESERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <stats/Histogram.h>
+#include "TimeServer.h"
+
+namespace sim {
+
+
+    /**
+     * @brief A time server, which paces the simulation against the wall clock.
+     *
+     * run() executes the model steps when their simulation time is reached in real time, scaled by the real-time factor
+     * (e.g. 10 for a ten times accelerated simulation, infinity for a simulation as fast as possible). The server waits
+     * for a step by sleeping until shortly before it is due and spinning for the rest of the time, which keeps the jitter
+     * in the range of microseconds.
+     *
+     * A step which starts later than the tolerance after its due time is an overrun. In this case the simulation time
+     * follows the wall clock: the step is executed at the actual time. Models tracking their time from the last step
+     * (@see Model::TimeTrackingOriginMode) perform one larger step, models tracking their time from the start catch up
+     * the delayed steps one per server step. The overruns are counted per server step and the delayed and caught up
+     * steps per model.
+     *
+     * @tparam Server Time server to be paced (TimeServer or ParallelTimeServer, floating point time base)
+     * @tparam Clock Wall clock the simulation is paced against (a steady clock, e.g. a manual clock in tests)
+     */
+    template<class Server = TimeServer, class Clock = std::chrono::steady_clock>
+    class PacedTimeServer : public Server {
+
+    public:
+
+        /**
+         * The function called before each server step
+         * @param simTime Simulation time of the step
+         */
+        typedef std::function<void(double simTime)> Tick;
+
+        //!< The counters of the server steps
+        struct Statistics {
+            unsigned long ticks;                    //!< Executed server steps
+            unsigned long steps;                    //!< Executed model steps
+            unsigned long overruns;                 //!< Server steps started later than the tolerance
+            std::chrono::nanoseconds maxOverrun;    //!< Maximum delay of a server step
+            std::chrono::nanoseconds totalOverrun;  //!< Sum of the delays of the overruns
+        };
+
+        //!< The counters of a model
+        struct ModelStatistics {
+            unsigned long steps;                    //!< Executed steps
+            unsigned long delayed;                  //!< Steps executed after their due time
+            unsigned long catchUps;                 //!< Steps, which were already due at the previous step
+            double maxDelay;                        //!< Maximum simulation time a step was executed after its due time
+        };
+
+
+    protected:
+
+        double _realTimeFactor = 1.0;                           //!< Simulation time per wall clock time
+        std::chrono::nanoseconds _spinTime{200000};             //!< Time spent spinning before a step
+        std::chrono::nanoseconds _tolerance{1000000};           //!< Delay of a step still counted as in time
+
+        std::atomic<bool> _stop{false};                         //!< Flag to stop the run
+        Statistics _statistics{};                               //!< The counters of the server steps
+        std::vector<ModelStatistics> _modelStatistics{};        //!< The counters of the models
+        std::vector<double> _lastTimes{};                       //!< The last step times of the models
+        std::vector<double> _scheduled{};                       //!< The due times of the models in the actual step
+        stats::Histogram _lateness{};                           //!< The start delays of the server steps in ns
+
+
+    public:
+
+        using Server::Server;
+
+
+        /**
+         * @brief Sets the real-time factor
+         *
+         * The factor is the simulation time passing per wall clock time. A factor of infinity runs the simulation as
+         * fast as possible.
+         *
+         * @param factor Real-time factor
+         */
+        void setRealTimeFactor(double factor) {
+
+            if(!(factor > 0.0))
+                throw std::invalid_argument("Real-time factor must be positive.");
+
+            _realTimeFactor = factor;
+
+        }
+
+
+        /**
+         * Sets the time spent spinning before a step (instead of sleeping)
+         * @param spinTime Spin time
+         */
+        void setSpinTime(std::chrono::nanoseconds spinTime) {
+
+            _spinTime = spinTime;
+
+        }
+
+
+        /**
+         * Sets the delay of a step start, which is not counted as overrun
+         * @param tolerance Tolerance
+         */
+        void setTolerance(std::chrono::nanoseconds tolerance) {
+
+            _tolerance = tolerance;
+
+        }
+
+
+        /**
+         * @brief Runs the simulation from the start time to the end time.
+         *
+         * The run ends, when the next model step is due after the end time or when stop() is called. The steps delayed
+         * until the end time and not caught up are dropped.
+         *
+         * @param startTime Simulation time, at which the run starts (at the actual wall clock time)
+         * @param endTime Simulation time, at which the run ends (may be infinity)
+         * @param tick Function called before each server step (e.g. to apply inputs)
+         * @return Simulation time of the last server step (the start time if no step was executed)
+         */
+        double run(double startTime, double endTime, const Tick &tick = nullptr) {
+
+            _stop = false;
+
+            bool paced = !std::isinf(_realTimeFactor);
+            auto wallStart = Clock::now();
+            double simTime = startTime;
+            bool started = false;
+
+            while(!_stop.load(std::memory_order_relaxed)) {
+
+                // next due step
+                double next = std::max(startTime, nextTime(simTime, started));
+                if(next > endTime + TimeTraits<double>::EPS)
+                    break;
+
+                double time = next;
+                if(paced) {
+
+                    auto deadline = wallStart + std::chrono::duration_cast<typename Clock::duration>(
+                            std::chrono::duration<double>((next - startTime) / _realTimeFactor));
+
+                    wait(deadline);
+
+                    // delay of the step
+                    auto lateness = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - deadline);
+                    _lateness.record((uint64_t) std::max<long long>(0, lateness.count()));
+
+                    if(lateness > _tolerance) {
+                        _statistics.overruns++;
+                        _statistics.maxOverrun = std::max(_statistics.maxOverrun, lateness);
+                        _statistics.totalOverrun += lateness;
+                    }
+
+                    // overrun or delayed step: the simulation time follows the wall clock
+                    if(lateness > _tolerance || (started && next <= simTime)) {
+                        double now = startTime + std::chrono::duration<double>(Clock::now() - wallStart).count()
+                                * _realTimeFactor;
+                        time = std::min(endTime, std::max(next, now));
+                    }
+
+                }
+
+                // catch-up steps at the end time are dropped
+                if(started && time <= simTime)
+                    break;
+
+                if(tick)
+                    tick(time);
+
+                _statistics.steps += this->step(time);
+                _statistics.ticks++;
+
+                simTime = time;
+                started = true;
+
+            }
+
+            return simTime;
+
+        }
+
+
+        /**
+         * Stops the actual run after the actual server step. Can be called by any thread.
+         */
+        void stop() {
+
+            _stop = true;
+
+        }
+
+
+        /**
+         * Returns the counters of the server steps
+         * @return Statistics
+         */
+        const Statistics &statistics() const {
+
+            return _statistics;
+
+        }
+
+
+        /**
+         * Returns the counters of a model
+         * @param index Index of the model (order of registration)
+         * @return Statistics
+         */
+        ModelStatistics modelStatistics(size_t index) const {
+
+            if(index >= this->size())
+                throw std::out_of_range("Model index out of range.");
+
+            return index < _modelStatistics.size() ? _modelStatistics[index] : ModelStatistics{};
+
+        }
+
+
+        /**
+         * Returns the histogram of the delays of the server step starts in nanoseconds (paced runs only)
+         * @return Histogram
+         */
+        const stats::Histogram &lateness() const {
+
+            return _lateness;
+
+        }
+
+
+        /**
+         * Resets the counters
+         */
+        void resetStatistics() {
+
+            _statistics = Statistics{};
+            _modelStatistics.assign(_modelStatistics.size(), ModelStatistics{});
+            _lateness.reset();
+
+        }
+
+
+    protected:
+
+
+        /**
+         * @brief Returns the time of the next server step.
+         *
+         * Steps due before the last server step are only taken into account, when they are delayed steps of active
+         * models (inactive models remain due).
+         *
+         * @param simTime Simulation time of the last server step
+         * @param started Flag indicating whether a server step was executed
+         * @return Simulation time (infinity, if no model step is due)
+         */
+        double nextTime(double simTime, bool started) const {
+
+            for(auto &e : this->_calendar) {
+
+                if(!started || e.first > simTime + TimeTraits<double>::EPS)
+                    return e.first;
+
+                for(auto i : e.second) {
+                    if(this->_models[i]->isActive())
+                        return e.first;
+                }
+
+            }
+
+            return INFINITY;
+
+        }
+
+
+        /**
+         * Waits until the deadline, sleeping until the spin time before the deadline and spinning afterwards
+         * @param deadline Deadline
+         */
+        void wait(typename Clock::time_point deadline) const {
+
+            if(deadline - Clock::now() > _spinTime)
+                std::this_thread::sleep_until(deadline - _spinTime);
+
+            while(Clock::now() < deadline)
+                std::this_thread::yield();
+
+        }
+
+
+        unsigned long execute(double simTime) override {
+
+            auto &models = this->_models;
+            auto &due = this->_due;
+
+            if(_modelStatistics.size() < models.size()) {
+                _modelStatistics.resize(models.size(), ModelStatistics{});
+                _lastTimes.resize(models.size(), -INFINITY);
+            }
+
+            // due times before the step
+            _scheduled.clear();
+            for(auto i : due)
+                _scheduled.push_back(models[i]->getNextStepTime());
+
+            auto steps = Server::execute(simTime);
+
+            // the next step time of an executed model has changed
+            for(size_t k = 0; k < due.size(); ++k) {
+
+                auto i = due[k];
+                auto scheduled = _scheduled[k];
+                if(models[i]->getNextStepTime() == scheduled)
+                    continue;
+
+                auto &s = _modelStatistics[i];
+                s.steps++;
+
+                // executed after the due time
+                double delay = simTime - scheduled;
+                if(delay > TimeTraits<double>::EPS) {
+                    s.delayed++;
+                    s.maxDelay = std::max(s.maxDelay, delay);
+                }
+
+                // already due at the previous step
+                if(scheduled < _lastTimes[i] + TimeTraits<double>::EPS)
+                    s.catchUps++;
+
+                _lastTimes[i] = simTime;
+
+            }
+
+            return steps;
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_PACEDTIMESERVER_H
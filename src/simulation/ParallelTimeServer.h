@@ -0,0 +1,122 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_PARALLELTIMESERVER_H
+#define DUMMYPROJECT_PARALLELTIMESERVER_H
+
+#include <atomic>
+#include <parallel/ThreadPool.h>
+#include "TimeServer.h"
+
+namespace sim {
+
+
+    /**
+     * @brief A time server, which executes the due models of a simulation step in parallel.
+     *
+     * The steps of the due models are distributed over a work-stealing thread pool. The simulation step returns, when all
+     * due models are executed (barrier), so the next simulation step starts with all models synchronized. Since every
+     * model is stepped by exactly one thread, the results do not depend on the number of threads as long as the models
+     * do not share data with each other.
+     *
+     * The thread pool is not owned by the time server and must outlive it.
+     *
+     * @tparam Time Time type of the models (@see TimeTraits)
+     */
+    template<typename Time>
+    class BasicParallelTimeServer : public BasicTimeServer<Time> {
+
+    protected:
+
+        parallel::ThreadPool *_pool;                    //!< The thread pool to execute the models
+        size_t _chunkSize;                              //!< Number of models executed as one chunk
+        parallel::ThreadPool::RangeFunction _function;  //!< The function executing a range of due models
+
+        Time _simTime{};                                //!< The simulation time of the actual step
+        std::atomic<unsigned long> _steps{0};           //!< The number of performed steps in the actual step
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param pool Thread pool to execute the models
+         * @param chunkSize Number of models executed as one chunk (0 = automatic)
+         */
+        explicit BasicParallelTimeServer(parallel::ThreadPool *pool, size_t chunkSize = 0)
+            : _pool(pool), _chunkSize(chunkSize) {
+
+            // check pool
+            if(pool == nullptr)
+                throw std::invalid_argument("Thread pool must not be null.");
+
+            // create function once to avoid allocations in every step
+            _function = [this](size_t begin, size_t end) {
+
+                unsigned long steps = 0;
+                for(size_t i = begin; i < end; ++i)
+                    steps += this->_models[this->_due[i]]->simStep(_simTime) ? 1 : 0;
+
+                _steps += steps;
+
+            };
+
+        }
+
+
+        BasicParallelTimeServer(const BasicParallelTimeServer &) = delete;
+        BasicParallelTimeServer &operator=(const BasicParallelTimeServer &) = delete;
+
+
+    protected:
+
+
+        /**
+         * Executes the simulation step of the due models in parallel
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        unsigned long execute(Time simTime) override {
+
+            _simTime = simTime;
+            _steps = 0;
+
+            _pool->parallelFor(this->_due.size(), _function, _chunkSize);
+
+            return _steps;
+
+        }
+
+    };
+
+
+    //!< The parallel time server of the models with the floating point time base
+    typedef BasicParallelTimeServer<double> ParallelTimeServer;
+
+    //!< The parallel time server of the models with the integer time base
+    typedef BasicParallelTimeServer<Ticks> ParallelTickTimeServer;
+
+}
+
+#endif //DUMMYPROJECT_PARALLELTIMESERVER_H
@@ -0,0 +1,295 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_PORT_H
+#define DUMMYPROJECT_PORT_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+#include "Model.h"
+
+namespace sim {
+
+
+    /**
+     * The type independent base of the ports of a model
+     */
+    class PortBase {
+
+    protected:
+
+        ModelBase *_owner; //!< The model the port belongs to
+
+    public:
+
+        /**
+         * Constructor
+         * @param owner The model the port belongs to
+         */
+        explicit PortBase(ModelBase *owner) : _owner(owner) {}
+
+        /**
+         * Destructor
+         */
+        virtual ~PortBase() = default;
+
+        PortBase(const PortBase &) = delete;
+        PortBase &operator=(const PortBase &) = delete;
+
+        /**
+         * Returns the model the port belongs to
+         * @return Owner
+         */
+        ModelBase *getOwner() const {
+
+            return _owner;
+
+        }
+
+    };
+
+
+    /**
+     * An output port of a model. The model writes the output in its step. The models of triggering inputs connected to
+     * the output are notified, when the value changes (@see Input::setTrigger()), which requires T to be equality
+     * comparable.
+     * @tparam T Data type of the port
+     */
+    template<typename T>
+    class Output : public PortBase {
+
+    protected:
+
+        T _value{};                                    //!< The actual value
+        mutable std::vector<ModelBase *> _listeners{}; //!< The models notified about changes of the value
+
+    public:
+
+        using PortBase::PortBase;
+
+        /**
+         * Sets the value of the output
+         * @param value Value
+         */
+        void set(const T &value) {
+
+            bool changed = !_listeners.empty() && !(_value == value);
+            _value = value;
+
+            // notify listeners
+            if(changed) {
+                for(auto model : _listeners)
+                    model->notify();
+            }
+
+        }
+
+        /**
+         * Adds a model to be notified about changes of the value
+         * @param model Model
+         */
+        void subscribe(ModelBase *model) const {
+
+            _listeners.push_back(model);
+
+        }
+
+        /**
+         * Removes a model from the notifications about changes of the value
+         * @param model Model
+         */
+        void unsubscribe(ModelBase *model) const {
+
+            auto it = std::find(_listeners.begin(), _listeners.end(), model);
+            if(it != _listeners.end())
+                _listeners.erase(it);
+
+        }
+
+        /**
+         * Returns the value of the output
+         * @return Value
+         */
+        const T &get() const {
+
+            return _value;
+
+        }
+
+    };
+
+
+    /**
+     * The type independent base of the input ports of a model
+     */
+    class InputBase : public PortBase {
+
+    protected:
+
+        bool _delayed = false; //!< Flag indicating whether the value is delayed by one step
+        bool _trigger = false; //!< Flag indicating whether a change of the value wakes up the owner
+
+    public:
+
+        using PortBase::PortBase;
+
+        /**
+         * Returns true, if the input is delayed by one step
+         * @return Delay flag
+         */
+        bool isDelayed() const {
+
+            return _delayed;
+
+        }
+
+        /**
+         * Sets the input to be delayed by one step
+         * @param delayed Delay flag
+         */
+        void setDelayed(bool delayed) {
+
+            _delayed = delayed;
+
+        }
+
+        /**
+         * Returns true, if a change of the connected output wakes up the owner of the input
+         * @return Trigger flag
+         */
+        bool isTrigger() const {
+
+            return _trigger;
+
+        }
+
+        /**
+         * Stores the actual value of the connected output, which is returned by a delayed input in the next step
+         */
+        virtual void latch() = 0;
+
+    };
+
+
+    /**
+     * An input port of a model. The input is connected to an output of another model. When the input is delayed, the
+     * value of the output of the last step is returned.
+     * @tparam T Data type of the port
+     */
+    template<typename T>
+    class Input : public InputBase {
+
+    protected:
+
+        const Output<T> *_source = nullptr; //!< The connected output
+        T _latched{};                       //!< The latched value of the output
+
+    public:
+
+        using InputBase::InputBase;
+
+        /**
+         * Connects the input to the given output
+         * @param source Output
+         */
+        void connect(const Output<T> &source) {
+
+            // move the subscription
+            if(_trigger && _source != nullptr)
+                _source->unsubscribe(_owner);
+
+            if(_trigger)
+                source.subscribe(_owner);
+
+            _source = &source;
+
+        }
+
+        /**
+         * @brief Sets the input to wake up its owner, when the value of the connected output changes.
+         *
+         * An event-driven owner is executed at the simulation time of the change (@see Model::notify()), which
+         * replaces polling the input in a fixed step. Fixed-step owners are not affected.
+         *
+         * @param trigger Trigger flag
+         */
+        void setTrigger(bool trigger) {
+
+            if(trigger == _trigger)
+                return;
+
+            if(_source != nullptr && trigger)
+                _source->subscribe(_owner);
+            else if(_source != nullptr)
+                _source->unsubscribe(_owner);
+
+            _trigger = trigger;
+
+        }
+
+        /**
+         * Returns the connected output
+         * @return Output
+         */
+        const Output<T> *getSource() const {
+
+            return _source;
+
+        }
+
+        /**
+         * Sets the initial value returned by a delayed input before the first step
+         * @param value Initial value
+         */
+        void setInitialValue(const T &value) {
+
+            _latched = value;
+
+        }
+
+        /**
+         * Returns the value of the input
+         * @return Value
+         */
+        const T &get() const {
+
+            if(_source == nullptr)
+                throw std::runtime_error("Input is not connected.");
+
+            return _delayed ? _latched : _source->get();
+
+        }
+
+        void latch() override {
+
+            if(_source != nullptr)
+                _latched = _source->get();
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_PORT_H
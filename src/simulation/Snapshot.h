@@ -0,0 +1,273 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SNAPSHOT_H
+#define DUMMYPROJECT_SNAPSHOT_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <memory/MappedFile.h>
+#include <parallel/ThreadPool.h>
+#include "Model.h"
+
+namespace sim {
+
+
+    /**
+     * @brief Checkpoints and restores the state of the registered models in a memory-mapped file.
+     *
+     * The file consists of a header and one length-prefixed record per model (@see ModelBase::saveState()), aligned to
+     * 8 bytes. A full snapshot contains all models, an incremental snapshot only the models changed since the last
+     * snapshot (dirty models). A simulation is restored by loading the last full snapshot and the following incremental
+     * snapshots in order. The sizes of the records are computed first, so the records are written directly into the
+     * mapped file and restored directly from the mapped pages. With a thread pool, the records are written and read in
+     * parallel.
+     *
+     * The models must be registered in the same order when saving and restoring. The models and the thread pool are not
+     * owned by the snapshot and must outlive it.
+     */
+    class Snapshot {
+
+    public:
+
+        constexpr static const uint32_t VERSION = 2;    //!< The version of the file format
+
+
+    protected:
+
+        //!< The header of a snapshot file
+        struct Header {
+            char magic[4];                              //!< File identifier ("DSNP")
+            uint32_t version;                           //!< Version of the file format
+            uint64_t models;                            //!< Number of registered models
+            uint64_t records;                           //!< Number of records in the file
+        };
+
+        //!< The header of a record
+        struct RecordHeader {
+            uint64_t index;                             //!< Registration index of the model
+            uint64_t size;                              //!< Size of the record (without header and padding)
+        };
+
+        std::vector<ModelBase *> _models{};             //!< The registered models
+        parallel::ThreadPool *_pool;                    //!< The thread pool (nullptr: serial)
+
+        std::vector<size_t> _selected{};                //!< The models of the actual snapshot
+        std::vector<size_t> _offsets{};                 //!< The offsets of the records in the file
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param pool Thread pool to write and read the records in parallel (nullptr: serial)
+         */
+        explicit Snapshot(parallel::ThreadPool *pool = nullptr) : _pool(pool) {}
+
+
+        /**
+         * Registers a model
+         * @param model Model to be registered
+         */
+        void registerModel(ModelBase *model) {
+
+            if(model == nullptr)
+                throw std::invalid_argument("Model must not be null.");
+
+            _models.push_back(model);
+
+        }
+
+
+        /**
+         * Returns the number of registered models
+         * @return Number of models
+         */
+        size_t size() const {
+
+            return _models.size();
+
+        }
+
+
+        /**
+         * Writes a snapshot of the models to the file and resets the dirty flags of the written models
+         * @param path Path of the file
+         * @param incremental Flag to write only the dirty models
+         * @return Number of written records
+         */
+        size_t save(const std::string &path, bool incremental = false) {
+
+            // select models
+            _selected.clear();
+            for(size_t i = 0; i < _models.size(); ++i) {
+                if(!incremental || _models[i]->isDirty())
+                    _selected.push_back(i);
+            }
+
+            // record sizes
+            _offsets.resize(_selected.size() + 1);
+            forRange(_selected.size(), [this](size_t begin, size_t end) {
+                for(size_t k = begin; k < end; ++k) {
+                    SnapshotWriter counter{};
+                    _models[_selected[k]]->saveState(counter);
+                    _offsets[k + 1] = counter.size();
+                }
+            });
+
+            // record offsets
+            _offsets[0] = sizeof(Header);
+            for(size_t k = 0; k < _selected.size(); ++k)
+                _offsets[k + 1] = _offsets[k] + sizeof(RecordHeader) + align(_offsets[k + 1]);
+
+            // create file
+            memory::MappedFile file(path, _offsets.back());
+            auto data = file.data();
+
+            Header header{{'D', 'S', 'N', 'P'}, VERSION, _models.size(), _selected.size()};
+            std::memcpy(data, &header, sizeof(Header));
+
+            // write records
+            forRange(_selected.size(), [this, data](size_t begin, size_t end) {
+                for(size_t k = begin; k < end; ++k) {
+
+                    auto model = _models[_selected[k]];
+                    auto record = data + _offsets[k];
+                    auto size = _offsets[k + 1] - _offsets[k] - sizeof(RecordHeader);
+
+                    // zero padding
+                    std::memset(record + sizeof(RecordHeader), 0, size);
+
+                    SnapshotWriter writer(record + sizeof(RecordHeader));
+                    model->saveState(writer);
+
+                    RecordHeader rh{_selected[k], writer.size()};
+                    std::memcpy(record, &rh, sizeof(RecordHeader));
+
+                    model->setDirty(false);
+
+                }
+            });
+
+            return _selected.size();
+
+        }
+
+
+        /**
+         * Restores the models from a snapshot file (full or incremental)
+         * @param path Path of the file
+         * @return Number of restored records
+         */
+        size_t load(const std::string &path) {
+
+            memory::MappedFile file(path);
+            auto data = file.data();
+
+            // check header
+            Header header{};
+            if(file.size() < sizeof(Header))
+                throw std::runtime_error("Snapshot file " + path + " is truncated.");
+
+            std::memcpy(&header, data, sizeof(Header));
+
+            if(std::memcmp(header.magic, "DSNP", 4) != 0 || header.version != VERSION)
+                throw std::runtime_error("File " + path + " is not a snapshot of version " + std::to_string(VERSION) + ".");
+
+            if(header.models != _models.size())
+                throw std::runtime_error("Snapshot file " + path + " does not match the registered models.");
+
+            // index records
+            _offsets.resize(header.records);
+            size_t offset = sizeof(Header);
+            for(size_t k = 0; k < header.records; ++k) {
+
+                RecordHeader rh{};
+                if(offset + sizeof(RecordHeader) > file.size())
+                    throw std::runtime_error("Snapshot file " + path + " is truncated.");
+
+                std::memcpy(&rh, data + offset, sizeof(RecordHeader));
+                if(rh.index >= _models.size() || offset + sizeof(RecordHeader) + rh.size > file.size())
+                    throw std::runtime_error("Snapshot file " + path + " is corrupted.");
+
+                _offsets[k] = offset;
+                offset += sizeof(RecordHeader) + align(rh.size);
+
+            }
+
+            // read records
+            forRange(_offsets.size(), [this, data](size_t begin, size_t end) {
+                for(size_t k = begin; k < end; ++k) {
+
+                    RecordHeader rh{};
+                    std::memcpy(&rh, data + _offsets[k], sizeof(RecordHeader));
+
+                    SnapshotReader reader(data + _offsets[k] + sizeof(RecordHeader), rh.size);
+                    _models[rh.index]->loadState(reader);
+
+                }
+            });
+
+            return _offsets.size();
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Aligns the size to 8 bytes
+         * @param size Size
+         * @return Aligned size
+         */
+        static size_t align(size_t size) {
+
+            return (size + 7) & ~(size_t) 7;
+
+        }
+
+
+        /**
+         * Executes the function for the range [0, n) in parallel, if a thread pool is set
+         * @param n Number of indexes
+         * @param function Function to be called for each chunk
+         */
+        void forRange(size_t n, const parallel::ThreadPool::RangeFunction &function) {
+
+            if(_pool != nullptr)
+                _pool->parallelFor(n, function);
+            else if(n > 0)
+                function(0, n);
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_SNAPSHOT_H
@@ -0,0 +1,233 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SNAPSHOTSTREAM_H
+#define DUMMYPROJECT_SNAPSHOTSTREAM_H
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <google/protobuf/message_lite.h>
+
+namespace sim {
+
+
+    /**
+     * @brief Writes the state of a model into a snapshot record.
+     *
+     * Plain values are copied bytewise, messages are written with a length prefix. Without a buffer, the writer only
+     * counts the bytes, which is used to compute the size of a record before it is written.
+     */
+    class SnapshotWriter {
+
+        char *_buffer;                              //!< The buffer to write to (nullptr: count only)
+        size_t _size = 0;                           //!< The number of written bytes
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param buffer Buffer to write to (nullptr: count only). The buffer must be large enough.
+         */
+        explicit SnapshotWriter(char *buffer = nullptr) : _buffer(buffer) {}
+
+
+        /**
+         * Writes the bytes
+         * @param data Pointer to the bytes
+         * @param n Number of bytes
+         */
+        void write(const void *data, size_t n) {
+
+            if(_buffer != nullptr)
+                std::memcpy(_buffer + _size, data, n);
+
+            _size += n;
+
+        }
+
+
+        /**
+         * Writes a plain value
+         * @tparam T Type of the value (trivially copyable)
+         * @param value Value
+         */
+        template<typename T>
+        void write(const T &value) {
+
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be written.");
+            write(&value, sizeof(T));
+
+        }
+
+
+        /**
+         * Writes a message with a length prefix
+         * @param message Message
+         */
+        void writeMessage(const google::protobuf::MessageLite &message) {
+
+            auto n = (uint64_t) message.ByteSizeLong();
+            write(n);
+
+            if(_buffer != nullptr)
+                message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t *>(_buffer + _size));
+
+            _size += n;
+
+        }
+
+
+        /**
+         * Returns the number of written bytes
+         * @return Number of bytes
+         */
+        size_t size() const {
+
+            return _size;
+
+        }
+
+    };
+
+
+    /**
+     * Reads the state of a model from a snapshot record, @see SnapshotWriter
+     */
+    class SnapshotReader {
+
+        const char *_data;                          //!< The record
+        size_t _size;                               //!< The size of the record
+        size_t _position = 0;                       //!< The read position
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param data Pointer to the record
+         * @param size Size of the record
+         */
+        SnapshotReader(const char *data, size_t size) : _data(data), _size(size) {}
+
+
+        /**
+         * Reads the bytes
+         * @param data Pointer to the memory to be filled
+         * @param n Number of bytes
+         */
+        void read(void *data, size_t n) {
+
+            check(n);
+            std::memcpy(data, _data + _position, n);
+            _position += n;
+
+        }
+
+
+        /**
+         * Reads a plain value
+         * @tparam T Type of the value (trivially copyable)
+         * @param value Value to be filled
+         */
+        template<typename T>
+        void read(T &value) {
+
+            static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read.");
+            read(&value, sizeof(T));
+
+        }
+
+
+        /**
+         * Reads a message with a length prefix
+         * @param message Message to be filled
+         */
+        void readMessage(google::protobuf::MessageLite &message) {
+
+            uint64_t n = 0;
+            read(n);
+            check(n);
+
+            // an empty message needs no parsing
+            if(n == 0) {
+                message.Clear();
+                return;
+            }
+
+            if(!message.ParseFromArray(_data + _position, (int) n))
+                throw std::runtime_error("Snapshot message could not be parsed.");
+
+            _position += n;
+
+        }
+
+
+        /**
+         * Skips a message with a length prefix without parsing it
+         */
+        void skipMessage() {
+
+            uint64_t n = 0;
+            read(n);
+            check(n);
+
+            _position += n;
+
+        }
+
+
+        /**
+         * Returns the number of bytes not read yet
+         * @return Number of bytes
+         */
+        size_t remaining() const {
+
+            return _size - _position;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Throws, if less than n bytes remain
+         * @param n Number of bytes
+         */
+        void check(size_t n) const {
+
+            if(n > _size - _position)
+                throw std::runtime_error("Snapshot record is truncated.");
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_SNAPSHOTSTREAM_H
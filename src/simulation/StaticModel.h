@@ -0,0 +1,399 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_STATICMODEL_H
+#define DUMMYPROJECT_STATICMODEL_H
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include "Time.h"
+
+namespace sim {
+
+
+    /**
+     * @brief A simulation model with static polymorphism (CRTP), @see Model
+     *
+     * The model has the same lifecycle and time tracking as Model, but the methods are not virtual: the derived model
+     * implements reset() and step() (and may hide isStepTime() or isActive()), which are called on the derived type.
+     * This way the simulation step of a small model is inlined completely. The data container is held by value.
+     *
+     * Static models cannot be registered to a time server, they are stepped directly or in a StaticModelSet.
+     *
+     * @tparam Derived The derived model
+     * @tparam proto Data type of the data container
+     * @tparam Time Time type (double or Ticks, @see TimeTraits)
+     */
+    template<typename Derived, typename proto, typename Time = double>
+    class StaticModel {
+
+    public:
+
+        typedef Time TimeType;
+
+        //!< Time tracking origin (@see Model::setTimeTrackingOriginMode())
+        enum class TimeTrackingOriginMode {FROM_START, FROM_LAST_STEP};
+
+        //!< Enum to define the model state
+        enum class ModelState {INSTANTIATED, CREATED, INITIALIZED, RUNNING, PAUSED, DESTROYED};
+
+    protected:
+
+        typedef TimeTraits<Time> Traits;       //!< The arithmetic of the time base
+
+        bool _isActive = false;                //!< Flag indicating whether the model is active
+        Time _startExecTime{};                 //!< The first sim time point to execute the model
+        Time _timeStepSize{};                  //!< Execution time step size
+        Time _lastExecTime{};                  //!< The next time to execute the model
+        unsigned long _noOfExecutionSteps = 0; //!< Execution step counter from the last reset
+
+        TimeTrackingOriginMode _timeTrackingOriginMode
+            = TimeTrackingOriginMode::FROM_LAST_STEP; //!< Time tracking mode
+        ModelState _state = ModelState::INSTANTIATED; //!< Model state
+
+        std::string _id{};                     //!< The ID of the model
+        std::string _name{};                   //!< The name of the model
+        proto _data{};                         //!< The data container of the model
+
+
+    public:
+
+
+        /**
+         * Sets the ID and the name of the model
+         * @param id ID of the model instance
+         * @param name Name of the model instance
+         */
+        void setIDAndName(std::string &&id, std::string &&name) {
+
+            _id = std::move(id);
+            _name = std::move(name);
+
+        }
+
+
+        /**
+         * Returns the ID of the model
+         * @return ID
+         */
+        const std::string &getID() const {
+
+            return _id;
+
+        }
+
+
+        /**
+         * Returns the name of the model
+         * @return Name
+         */
+        const std::string &getName() const {
+
+            return _name;
+
+        }
+
+
+        /**
+         * Returns the state of the model
+         * @return Model state
+         */
+        ModelState getModelState() const {
+
+            return _state;
+
+        }
+
+
+        /**
+         * Returns the data container
+         * @return Data container
+         */
+        const proto &getData() const {
+
+            return _data;
+
+        }
+
+
+        /**
+         * Creates the model, @see Model::create()
+         * @return Success flag
+         */
+        bool create() {
+
+            // check state
+            if(_state != ModelState::INSTANTIATED)
+                throw std::runtime_error("Model was created already.");
+
+            // set state
+            _state = ModelState::CREATED;
+
+            // defaults
+            _startExecTime = Traits::fromSeconds(0.0);
+            _timeStepSize = Traits::fromSeconds(1.0);
+
+            // success
+            return true;
+
+        }
+
+
+        /**
+         * Sets the time tracking origin mode, @see Model::setTimeTrackingOriginMode()
+         * @param mode The time tracking origin mode
+         */
+        void setTimeTrackingOriginMode(TimeTrackingOriginMode mode) {
+
+            // check state
+            if(_state != ModelState::CREATED)
+                throw std::runtime_error("Setup only possible before initialization (state = CREATED).");
+
+            _timeTrackingOriginMode = mode;
+
+        }
+
+
+        /**
+         * Sets the start execution time, @see Model::setStartExecutionTime()
+         * @param startExecTime Start execution time
+         */
+        void setStartExecutionTime(Time startExecTime) {
+
+            // check state
+            if(_state != ModelState::CREATED)
+                throw std::runtime_error("Setup only possible before initialization (state = CREATED).");
+
+            _startExecTime = startExecTime;
+
+        }
+
+
+        /**
+         * Sets the time step size of the model and activates it, @see Model::setTimeStepSize()
+         * @param timeStepSize The time step size
+         */
+        void setTimeStepSize(Time timeStepSize) {
+
+            // check state
+            if(_state != ModelState::CREATED)
+                throw std::runtime_error("The model must be created first.");
+
+            _timeStepSize = timeStepSize;
+            _isActive = true;
+
+        }
+
+
+        /**
+         * Initializes the model and resets it (Derived::reset()), @see Model::initialize()
+         * @param simTime The simulation time at which the model is initialized
+         * @return Success flag
+         */
+        bool initialize(Time simTime) {
+
+            // check state
+            if(_state == ModelState::INSTANTIATED)
+                throw std::runtime_error("Model must be created before initialization.");
+            else if(_state != ModelState::CREATED)
+                throw std::runtime_error("Model must be terminated before initialization.");
+
+            // set state
+            _state = ModelState::INITIALIZED;
+
+            // reset states
+            derived().reset();
+
+            // set last execution time to minus inf
+            _lastExecTime = Traits::never();
+
+            return true;
+
+        }
+
+
+        /**
+         * Checks if the next step shall be performed at the given simulation time, @see Model::isStepTime()
+         * @param simTime Actual simulation time
+         * @return Flag indicating if the step shall be executed
+         */
+        bool isStepTime(Time simTime) const {
+
+            // dependent on mode
+            bool time2run = _timeTrackingOriginMode == TimeTrackingOriginMode::FROM_LAST_STEP
+                    ? Traits::reached(simTime, _lastExecTime + _timeStepSize)
+                    : Traits::reached(simTime, _startExecTime + Traits::steps(_timeStepSize, _noOfExecutionSteps));
+
+            // check
+            return Traits::reached(simTime, _startExecTime) && time2run;
+
+        }
+
+
+        /**
+         * Returns the simulation time at which the next step of the model is due, @see Model::getNextStepTime()
+         * @return Next step time
+         */
+        Time getNextStepTime() const {
+
+            // dependent on mode
+            Time next = _timeTrackingOriginMode == TimeTrackingOriginMode::FROM_LAST_STEP
+                    ? _lastExecTime + _timeStepSize
+                    : _startExecTime + Traits::steps(_timeStepSize, _noOfExecutionSteps);
+
+            // not before start time
+            return std::max(_startExecTime, next);
+
+        }
+
+
+        /**
+         * Returns true when the model is active
+         * @return Active flag
+         */
+        bool isActive() const {
+
+            return _isActive;
+
+        }
+
+
+        /**
+         * Executes the step of the model (Derived::step()), if it is due, @see Model::simStep()
+         * @param simTime The actual simulation time
+         * @return Flag indicating whether the step was performed
+         */
+        bool simStep(Time simTime) {
+
+            // check state
+            if(_state != ModelState::INITIALIZED && _state != ModelState::RUNNING)
+                throw std::runtime_error("Model must be initialized before execution.");
+
+            // set state
+            _state = ModelState::RUNNING;
+
+            if(derived().isStepTime(simTime) && derived().isActive()) {
+
+                // execute simulation
+                _noOfExecutionSteps++;
+                derived().step(simTime, Traits::difference(simTime, _lastExecTime));
+
+                // save time
+                _lastExecTime = simTime;
+
+                // step performed
+                return true;
+
+            }
+
+            // step not performed
+            return false;
+
+        }
+
+
+        /**
+         * Activates the model and resets it, @see Model::activate()
+         */
+        void activate() {
+
+            derived().reset();
+            _noOfExecutionSteps = 0;
+            _isActive = true;
+
+        }
+
+
+        /**
+         * Deactivates the model
+         */
+        void deactivate() {
+
+            _isActive = false;
+
+        }
+
+
+        /**
+         * Terminates the model for the actual simulation, @see Model::terminate()
+         * @param simTime Simulation time at termination
+         * @return Success flag
+         */
+        bool terminate(Time simTime) {
+
+            // check state
+            if(_state != ModelState::INITIALIZED && _state != ModelState::RUNNING)
+                throw std::runtime_error("Model cannot be terminated, when not initialized.");
+
+            _state = ModelState::CREATED;
+            return true;
+
+        }
+
+
+        /**
+         * Destroys the model, @see Model::destroy()
+         * @return Success flag
+         */
+        bool destroy() {
+
+            // check state
+            if(_state != ModelState::CREATED)
+                throw std::runtime_error("Model can only be destroyed when terminated or created.");
+
+            _state = ModelState::DESTROYED;
+            return true;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Returns the derived model
+         * @return Derived model
+         */
+        Derived &derived() {
+
+            return static_cast<Derived &>(*this);
+
+        }
+
+
+        /**
+         * Returns the derived model
+         * @return Derived model
+         */
+        const Derived &derived() const {
+
+            return static_cast<const Derived &>(*this);
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_STATICMODEL_H
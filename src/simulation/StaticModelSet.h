@@ -0,0 +1,200 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_STATICMODELSET_H
+#define DUMMYPROJECT_STATICMODELSET_H
+
+#include <algorithm>
+#include <tuple>
+#include <utility>
+#include "StaticModel.h"
+
+namespace sim {
+
+
+    /**
+     * @brief A fixed set of static models (@see StaticModel) of different types, which are stepped without virtual calls.
+     *
+     * The models are held by value in a tuple and are stepped in the order of the template arguments. Since the types
+     * are known at compile time, the loop over the models is unrolled and the steps of the models are inlined. The
+     * models must use the same time type.
+     *
+     * @tparam Models The model types
+     */
+    template<typename... Models>
+    class StaticModelSet {
+
+        static_assert(sizeof...(Models) > 0, "The set must contain at least one model.");
+
+    public:
+
+        typedef typename std::tuple_element<0, std::tuple<Models...>>::type::TimeType Time;
+
+
+    protected:
+
+        std::tuple<Models...> _models{};        //!< The models
+
+
+    public:
+
+
+        /**
+         * Returns the number of models
+         * @return Number of models
+         */
+        static constexpr size_t size() {
+
+            return sizeof...(Models);
+
+        }
+
+
+        /**
+         * Returns the model at the given position
+         * @tparam I Position
+         * @return Model
+         */
+        template<size_t I>
+        typename std::tuple_element<I, std::tuple<Models...>>::type &get() {
+
+            return std::get<I>(_models);
+
+        }
+
+
+        /**
+         * Returns the model of the given type (the type must be unique in the set)
+         * @tparam T Model type
+         * @return Model
+         */
+        template<typename T>
+        T &get() {
+
+            return std::get<T>(_models);
+
+        }
+
+
+        /**
+         * Calls the function with each model in order
+         * @tparam F Function type (a generic function, which accepts all model types)
+         * @param function Function
+         */
+        template<typename F>
+        void forEach(F &&function) {
+
+            forEach(function, std::index_sequence_for<Models...>{});
+
+        }
+
+
+        /**
+         * Creates all models (@see StaticModel::create())
+         */
+        void create() {
+
+            forEach([](auto &model) { model.create(); });
+
+        }
+
+
+        /**
+         * Initializes all models (@see StaticModel::initialize())
+         * @param simTime The simulation time at which the models are initialized
+         */
+        void initialize(Time simTime) {
+
+            forEach([simTime](auto &model) { model.initialize(simTime); });
+
+        }
+
+
+        /**
+         * Executes the due steps of all models in order (@see StaticModel::simStep())
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        unsigned long simStep(Time simTime) {
+
+            unsigned long steps = 0;
+            forEach([simTime, &steps](auto &model) { steps += model.simStep(simTime) ? 1 : 0; });
+
+            return steps;
+
+        }
+
+
+        /**
+         * Returns the simulation time of the next due model step
+         * @return Next step time
+         */
+        Time getNextStepTime() {
+
+            auto next = TimeTraits<Time>::infinity();
+            forEach([&next](auto &model) { next = std::min(next, model.getNextStepTime()); });
+
+            return next;
+
+        }
+
+
+        /**
+         * Terminates all models (@see StaticModel::terminate())
+         * @param simTime Simulation time at termination
+         */
+        void terminate(Time simTime) {
+
+            forEach([simTime](auto &model) { model.terminate(simTime); });
+
+        }
+
+
+        /**
+         * Destroys all models (@see StaticModel::destroy())
+         */
+        void destroy() {
+
+            forEach([](auto &model) { model.destroy(); });
+
+        }
+
+
+    protected:
+
+
+        //!< Calls the function with the models at the given positions in order
+        template<typename F, size_t... I>
+        void forEach(F &function, std::index_sequence<I...>) {
+
+            // the initializer list guarantees the order
+            int order[] = {0, (function(std::get<I>(_models)), 0)...};
+            (void) order;
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_STATICMODELSET_H
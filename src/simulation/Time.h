@@ -0,0 +1,114 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_TIME_H
+#define DUMMYPROJECT_TIME_H
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace sim {
+
+
+    //!< The integer time base: nanoseconds since the start of the simulation (exact for 292 years)
+    typedef std::chrono::nanoseconds Ticks;
+
+
+    /**
+     * @brief The arithmetic of a time base of the simulation (the time type of the models and the time server).
+     *
+     * Two time bases are supported:
+     *
+     * * double: The time in seconds. The comparisons consider an epsilon and the steps tracked from the last step
+     *           accumulate the rounding error.
+     * * Ticks:  The time in integer nanoseconds. The comparisons are exact integer compares, so the step times do not
+     *           drift over arbitrarily long runs. The step sizes must be multiples of a nanosecond.
+     *
+     * @tparam Time Time type
+     */
+    template<typename Time>
+    struct TimeTraits;
+
+
+    //!< The floating point time base in seconds
+    template<>
+    struct TimeTraits<double> {
+
+        constexpr static const double EPS = 1e-9; //!< The minimum time step size
+
+        //!< Returns the time before all times
+        static double never() { return -INFINITY; }
+
+        //!< Returns the time after all times
+        static double infinity() { return INFINITY; }
+
+        //!< Returns true, if the time reached the due time
+        static bool reached(double time, double due) { return time > due - EPS; }
+
+        //!< Returns the time of n steps
+        static double steps(double stepSize, unsigned long n) { return n * stepSize; }
+
+        //!< Returns the difference of two times (infinity, if the origin is never())
+        static double difference(double time, double origin) { return time - origin; }
+
+        //!< Converts seconds into the time base
+        static double fromSeconds(double seconds) { return seconds; }
+
+        //!< Converts the time base into seconds
+        static double toSeconds(double time) { return time; }
+
+    };
+
+
+    //!< The integer time base in nanoseconds
+    template<>
+    struct TimeTraits<Ticks> {
+
+        //!< Returns the time before all times
+        static Ticks never() { return Ticks::min(); }
+
+        //!< Returns the time after all times
+        static Ticks infinity() { return Ticks::max(); }
+
+        //!< Returns true, if the time reached the due time
+        static bool reached(Ticks time, Ticks due) { return time >= due; }
+
+        //!< Returns the time of n steps
+        static Ticks steps(Ticks stepSize, unsigned long n) { return Ticks(stepSize.count() * (int64_t) n); }
+
+        //!< Returns the difference of two times (infinity, if the origin is never())
+        static Ticks difference(Ticks time, Ticks origin) { return origin == never() ? infinity() : time - origin; }
+
+        //!< Converts seconds into the time base (rounded to nanoseconds)
+        static Ticks fromSeconds(double seconds) { return Ticks((int64_t) std::llround(seconds * 1e9)); }
+
+        //!< Converts the time base into seconds
+        static double toSeconds(Ticks time) { return (double) time.count() * 1e-9; }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_TIME_H
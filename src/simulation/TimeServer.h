@@ -0,0 +1,310 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_TIMESERVER_H
+#define DUMMYPROJECT_TIMESERVER_H
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <vector>
+#include "Model.h"
+
+namespace sim {
+
+
+    /**
+     * @brief A time server, which executes the registered models when their steps are due.
+     *
+     * Instead of polling every model in every simulation step (@see Model::simStep()), the models are kept in a
+     * calendar of buckets, which are keyed on the next step time of the models (@see ModelBase::getNextStepTime()).
+     * Models running at the same rate share a bucket, which is re-scheduled as a whole after execution. In a simulation
+     * step only the models of the due buckets are touched.
+     * The due models are executed in the order of registration, which is the same order as when polling the models.
+     * Inactive models remain due and are therefore checked in every step, so that an activation is picked up instantly.
+     *
+     * The models are not owned by the time server and must outlive it.
+     *
+     * @tparam Time Time type of the models (@see TimeTraits)
+     */
+    template<typename Time>
+    class BasicTimeServer {
+
+    protected:
+
+        typedef std::vector<size_t> Bucket;
+        typedef TimeTraits<Time> Traits;        //!< The arithmetic of the time base
+
+        std::vector<BasicModelBase<Time> *> _models{}; //!< The registered models
+        std::map<Time, Bucket> _calendar{};     //!< The indexes of the models sorted by their next step time
+        std::vector<Bucket> _spareBuckets{};    //!< Buckets to be reused to avoid allocations
+        std::vector<size_t> _due{};             //!< The indexes of the models due in the actual step
+        std::vector<size_t> _merged{};          //!< Buffer to merge the due buckets
+        std::vector<Bucket> _popped{};          //!< The buckets due in the actual step
+
+
+    public:
+
+
+        /**
+         * Constructor
+         */
+        BasicTimeServer() = default;
+
+
+        /**
+         * Destructor
+         */
+        virtual ~BasicTimeServer() = default;
+
+
+        /**
+         * @brief Registers a model to the time server.
+         *
+         * The model shall be initialized before registration, since the next step time is taken at registration.
+         *
+         * @param model Model to be registered
+         */
+        void registerModel(BasicModelBase<Time> *model) {
+
+            // check model
+            if(model == nullptr)
+                throw std::invalid_argument("Model must not be null.");
+
+            // add model and schedule
+            _models.push_back(model);
+            schedule(_models.size() - 1);
+
+        }
+
+
+        /**
+         * @brief Rebuilds the schedule from the actual next step times of the models.
+         *
+         * This must be called, when the models were changed from outside of the time server in a way that the next step
+         * time has changed (e.g. by activation or re-initialization).
+         */
+        void reschedule() {
+
+            // recycle buckets
+            for(auto &e : _calendar)
+                recycle(e.second);
+
+            // schedule all models
+            _calendar.clear();
+            for(size_t i = 0; i < _models.size(); ++i)
+                schedule(i);
+
+        }
+
+
+        /**
+         * Returns the number of registered models
+         * @return Number of models
+         */
+        size_t size() const {
+
+            return _models.size();
+
+        }
+
+
+        /**
+         * Returns the simulation time of the next due model step
+         * @return Next step time (infinity, if no model is registered)
+         */
+        Time getNextStepTime() const {
+
+            return _calendar.empty() ? Traits::infinity() : _calendar.begin()->first;
+
+        }
+
+
+        /**
+         * @brief Executes the models which are due at the given simulation time.
+         *
+         * Every due model is stepped at most once (@see Model::simStep()) and is re-scheduled with its new next step
+         * time afterwards.
+         *
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        unsigned long step(Time simTime) {
+
+            // take due buckets
+            _popped.clear();
+            while(!_calendar.empty() && Traits::reached(simTime, _calendar.begin()->first)) {
+                _popped.push_back(std::move(_calendar.begin()->second));
+                _calendar.erase(_calendar.begin());
+            }
+
+            // buckets are sorted by index, merge to keep registration order
+            _due.clear();
+            if(_popped.size() == 1)
+                _due.swap(_popped.front());
+            else {
+                for(auto &bucket : _popped) {
+                    _merged.clear();
+                    std::merge(_due.begin(), _due.end(), bucket.begin(), bucket.end(), std::back_inserter(_merged));
+                    _due.swap(_merged);
+                }
+            }
+
+            // execute models
+            auto steps = execute(simTime);
+
+            // re-schedule models
+            if(_popped.size() == 1)
+                _due.swap(_popped.front());
+
+            for(auto &bucket : _popped)
+                reschedule(bucket);
+
+            return steps;
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Executes the simulation step of the due models (@see _due)
+         * @param simTime The actual simulation time
+         * @return Number of performed model steps
+         */
+        virtual unsigned long execute(Time simTime) {
+
+            unsigned long steps = 0;
+            for(auto i : _due)
+                steps += _models[i]->simStep(simTime) ? 1 : 0;
+
+            return steps;
+
+        }
+
+
+        /**
+         * @brief Schedules the models of the given executed bucket.
+         *
+         * When the models of the bucket run at the same rate (which is the usual case), the bucket is moved as a whole.
+         *
+         * @param bucket Bucket to be re-scheduled
+         */
+        void reschedule(Bucket &bucket) {
+
+            if(bucket.empty())
+                return;
+
+            // check if all models have the same next step time
+            auto time = _models[bucket.front()]->getNextStepTime();
+            bool same = true;
+            for(size_t i = 1; i < bucket.size() && same; ++i)
+                same = _models[bucket[i]]->getNextStepTime() == time;
+
+            // schedule models one by one
+            if(!same) {
+
+                for(auto i : bucket)
+                    schedule(i);
+
+                recycle(bucket);
+                return;
+
+            }
+
+            // move bucket or merge with existing bucket
+            auto it = _calendar.find(time);
+            if(it == _calendar.end())
+                _calendar.emplace(time, std::move(bucket));
+            else {
+
+                _merged.clear();
+                std::merge(it->second.begin(), it->second.end(), bucket.begin(), bucket.end(),
+                        std::back_inserter(_merged));
+                it->second.swap(_merged);
+
+                recycle(bucket);
+
+            }
+
+        }
+
+
+        /**
+         * Adds the model with the given index to the bucket of its next step time
+         * @param index Index of the model
+         */
+        void schedule(size_t index) {
+
+            // get bucket
+            auto time = _models[index]->getNextStepTime();
+            auto it = _calendar.find(time);
+
+            // create bucket
+            if(it == _calendar.end()) {
+
+                it = _calendar.emplace(time, Bucket{}).first;
+
+                // reuse memory
+                if(!_spareBuckets.empty()) {
+                    it->second.swap(_spareBuckets.back());
+                    _spareBuckets.pop_back();
+                }
+
+            }
+
+            // add model (sorted by index)
+            auto &bucket = it->second;
+            if(bucket.empty() || bucket.back() < index)
+                bucket.push_back(index);
+            else
+                bucket.insert(std::upper_bound(bucket.begin(), bucket.end(), index), index);
+
+        }
+
+
+        /**
+         * Stores the memory of the bucket for later use
+         * @param bucket Bucket to be recycled
+         */
+        void recycle(Bucket &bucket) {
+
+            bucket.clear();
+            _spareBuckets.push_back(std::move(bucket));
+
+        }
+
+    };
+
+
+    //!< The time server of the models with the floating point time base
+    typedef BasicTimeServer<double> TimeServer;
+
+    //!< The time server of the models with the integer time base
+    typedef BasicTimeServer<Ticks> TickTimeServer;
+
+}
+
+#endif //DUMMYPROJECT_TIMESERVER_H
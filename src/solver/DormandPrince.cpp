@@ -0,0 +1,252 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include "DormandPrince.h"
+
+namespace solver {
+
+
+    // Butcher tableau
+    static const double C2 = 1.0 / 5.0, C3 = 3.0 / 10.0, C4 = 4.0 / 5.0, C5 = 8.0 / 9.0;
+
+    static const double A21 = 1.0 / 5.0;
+    static const double A31 = 3.0 / 40.0, A32 = 9.0 / 40.0;
+    static const double A41 = 44.0 / 45.0, A42 = -56.0 / 15.0, A43 = 32.0 / 9.0;
+    static const double A51 = 19372.0 / 6561.0, A52 = -25360.0 / 2187.0, A53 = 64448.0 / 6561.0,
+            A54 = -212.0 / 729.0;
+    static const double A61 = 9017.0 / 3168.0, A62 = -355.0 / 33.0, A63 = 46732.0 / 5247.0, A64 = 49.0 / 176.0,
+            A65 = -5103.0 / 18656.0;
+    static const double A71 = 35.0 / 384.0, A73 = 500.0 / 1113.0, A74 = 125.0 / 192.0, A75 = -2187.0 / 6784.0,
+            A76 = 11.0 / 84.0;
+
+    // difference of the fifth and fourth order weights
+    static const double E1 = 71.0 / 57600.0, E3 = -71.0 / 16695.0, E4 = 71.0 / 1920.0, E5 = -17253.0 / 339200.0,
+            E6 = 22.0 / 525.0, E7 = -1.0 / 40.0;
+
+    // step size control
+    static const double SAFETY = 0.9, MIN_FACTOR = 0.2, MAX_FACTOR = 5.0;
+
+
+    DormandPrince::DormandPrince(double relTol, double absTol) : _relTol(0.0), _absTol(0.0) {
+
+        setTolerances(relTol, absTol);
+
+    }
+
+
+    void DormandPrince::setTolerances(double relTol, double absTol) {
+
+        if(!(relTol >= 0.0 && absTol >= 0.0 && relTol + absTol > 0.0))
+            throw std::invalid_argument("Tolerances must be non-negative and not both zero.");
+
+        _relTol = relTol;
+        _absTol = absTol;
+
+    }
+
+
+    void DormandPrince::setStepLimits(double minStep, double maxStep) {
+
+        if(!(minStep > 0.0 && maxStep >= 0.0) || (maxStep > 0.0 && maxStep < minStep))
+            throw std::invalid_argument("Step limits must be positive and ordered.");
+
+        _minStep = minStep;
+        _maxStep = maxStep;
+
+        if(_maxStep > 0.0)
+            _h = std::min(_h, _maxStep);
+
+    }
+
+
+    double DormandPrince::stepSize() const {
+
+        return _h;
+
+    }
+
+
+    unsigned long DormandPrince::rejected() const {
+
+        return _rejected;
+
+    }
+
+
+    void DormandPrince::reset() {
+
+        Solver::reset();
+
+        _rejected = 0;
+        _h = 0.0;
+
+    }
+
+
+    double DormandPrince::norm(const double *v, const double *x, const double *y, size_t n) const {
+
+        double sum = 0.0;
+        for(size_t i = 0; i < n; ++i) {
+            double scale = _absTol + _relTol * std::max(std::abs(x[i]), std::abs(y[i]));
+            sum += (v[i] / scale) * (v[i] / scale);
+        }
+
+        return std::sqrt(sum / (double) n);
+
+    }
+
+
+    double DormandPrince::initialStep(const System &system, double t, const double *x, double span) {
+
+        auto n = system.size();
+        auto &f0 = _k[0];
+        auto &f1 = _k[1];
+
+        // first guess from the magnitudes of state and derivatives
+        double d0 = norm(x, x, x, n);
+        double d1 = norm(f0.data(), x, x, n);
+        double h0 = d0 < 1e-5 || d1 < 1e-5 ? 1e-6 : 0.01 * d0 / d1;
+        h0 = std::min(h0, span);
+
+        // explicit Euler step to estimate the second derivative
+        for(size_t i = 0; i < n; ++i)
+            _y[i] = x[i] + h0 * f0[i];
+
+        evaluate(system, t + h0, _y.data(), f1.data());
+
+        for(size_t i = 0; i < n; ++i)
+            _next[i] = (f1[i] - f0[i]) / h0;
+
+        double d2 = norm(_next.data(), x, x, n);
+        double dm = std::max(d1, d2);
+        double h1 = dm <= 1e-15 ? std::max(1e-6, h0 * 1e-3) : std::pow(0.01 / dm, 1.0 / 5.0);
+
+        return std::min(100.0 * h0, h1);
+
+    }
+
+
+    void DormandPrince::integrate(const System &system, double t, double h, double *x) {
+
+        auto n = system.size();
+        for(auto &k : _k)
+            k.resize(n);
+
+        _y.resize(n);
+        _next.resize(n);
+
+        double end = t + h;
+
+        // first stage (the system may have changed since the last call, e.g. by a new input)
+        evaluate(system, t, x, _k[0].data());
+
+        if(_h <= 0.0)
+            _h = initialStep(system, t, x, h);
+
+        if(_maxStep > 0.0)
+            _h = std::min(_h, _maxStep);
+
+        while(t < end) {
+
+            // do not step beyond the end (the proposed step size is kept for the next call)
+            double step = _h;
+            bool last = t + step >= end;
+            if(last)
+                step = end - t;
+
+            auto &k1 = _k[0], &k2 = _k[1], &k3 = _k[2], &k4 = _k[3], &k5 = _k[4], &k6 = _k[5], &k7 = _k[6];
+
+            // stages
+            for(size_t i = 0; i < n; ++i)
+                _y[i] = x[i] + step * A21 * k1[i];
+
+            evaluate(system, t + C2 * step, _y.data(), k2.data());
+
+            for(size_t i = 0; i < n; ++i)
+                _y[i] = x[i] + step * (A31 * k1[i] + A32 * k2[i]);
+
+            evaluate(system, t + C3 * step, _y.data(), k3.data());
+
+            for(size_t i = 0; i < n; ++i)
+                _y[i] = x[i] + step * (A41 * k1[i] + A42 * k2[i] + A43 * k3[i]);
+
+            evaluate(system, t + C4 * step, _y.data(), k4.data());
+
+            for(size_t i = 0; i < n; ++i)
+                _y[i] = x[i] + step * (A51 * k1[i] + A52 * k2[i] + A53 * k3[i] + A54 * k4[i]);
+
+            evaluate(system, t + C5 * step, _y.data(), k5.data());
+
+            for(size_t i = 0; i < n; ++i)
+                _y[i] = x[i] + step * (A61 * k1[i] + A62 * k2[i] + A63 * k3[i] + A64 * k4[i] + A65 * k5[i]);
+
+            evaluate(system, t + step, _y.data(), k6.data());
+
+            for(size_t i = 0; i < n; ++i)
+                _next[i] = x[i] + step * (A71 * k1[i] + A73 * k3[i] + A74 * k4[i] + A75 * k5[i] + A76 * k6[i]);
+
+            evaluate(system, t + step, _next.data(), k7.data());
+
+            // local error estimate (stored in the stage state)
+            for(size_t i = 0; i < n; ++i)
+                _y[i] = step * (E1 * k1[i] + E3 * k3[i] + E4 * k4[i] + E5 * k5[i] + E6 * k6[i] + E7 * k7[i]);
+
+            double error = norm(_y.data(), x, _next.data(), n);
+
+            // new step size
+            double factor = error == 0.0 ? MAX_FACTOR : SAFETY * std::pow(error, -1.0 / 5.0);
+            factor = std::isfinite(factor) ? std::min(MAX_FACTOR, std::max(MIN_FACTOR, factor)) : MIN_FACTOR;
+
+            if(error <= 1.0) {
+
+                // accept step
+                std::copy(_next.begin(), _next.end(), x);
+                std::swap(k1, k7);
+                t = last ? end : t + step;
+                ++_steps;
+
+                // a step clipped to the end does not shrink the step size for the next call
+                _h = step < _h ? std::max(_h, step * factor) : step * factor;
+
+            } else {
+
+                // reject step
+                _h = step * std::min(1.0, factor);
+                ++_rejected;
+
+                if(_h < _minStep)
+                    throw std::runtime_error("Step size fell below the minimum step size.");
+
+            }
+
+            if(_maxStep > 0.0)
+                _h = std::min(_h, _maxStep);
+
+        }
+
+    }
+
+}
@@ -0,0 +1,133 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_DORMANDPRINCE_H
+#define DUMMYPROJECT_DORMANDPRINCE_H
+
+#include <vector>
+#include "Solver.h"
+
+namespace solver {
+
+
+    /**
+     * @brief Adaptive Dormand-Prince 5(4) method with step size control.
+     *
+     * Each call to integrate() covers the requested time span with as many internal steps as needed to keep the local
+     * error estimate within the tolerances (error per step: |e_i| <= absTol + relTol * |x_i|). The step size is kept
+     * between the calls, so a model stepped with a constant time step only pays for the step size search once. The last
+     * stage of an accepted step is reused as first stage of the next step within the same call (first same as last),
+     * which makes six evaluations per accepted step.
+     */
+    class DormandPrince : public Solver {
+
+    protected:
+
+        double _relTol;               //!< Relative tolerance
+        double _absTol;               //!< Absolute tolerance
+        double _minStep = 1e-12;      //!< Minimum step size
+        double _maxStep = 0.0;        //!< Maximum step size (zero: unlimited)
+        double _h = 0.0;              //!< Current step size (zero: to be estimated)
+
+        unsigned long _rejected = 0;  //!< Number of rejected steps
+
+        std::vector<double> _k[7];    //!< Stage derivatives
+        std::vector<double> _y{};     //!< Stage state
+        std::vector<double> _next{};  //!< Solution of the step (fifth order)
+
+
+    public:
+
+        /**
+         * Constructor
+         * @param relTol Relative tolerance
+         * @param absTol Absolute tolerance
+         */
+        explicit DormandPrince(double relTol = 1e-6, double absTol = 1e-6);
+
+
+        /**
+         * Sets the tolerances of the local error
+         * @param relTol Relative tolerance
+         * @param absTol Absolute tolerance
+         */
+        void setTolerances(double relTol, double absTol);
+
+
+        /**
+         * Sets the limits of the step size
+         * @param minStep Minimum step size, the integration fails if the error requires a smaller step
+         * @param maxStep Maximum step size (zero: unlimited)
+         */
+        void setStepLimits(double minStep, double maxStep);
+
+
+        /**
+         * Returns the step size to be tried next
+         * @return Step size (zero, if not estimated yet)
+         */
+        double stepSize() const;
+
+
+        /**
+         * Returns the number of rejected steps since the last reset
+         * @return Number of rejected steps
+         */
+        unsigned long rejected() const;
+
+
+        void integrate(const System &system, double t, double h, double *x) override;
+
+
+        void reset() override;
+
+
+    protected:
+
+        /**
+         * Estimates the initial step size (Hairer, Norsett, Wanner: Solving ODE I, II.4)
+         * @param system System
+         * @param t Time
+         * @param x State vector
+         * @param span Time span to be integrated
+         * @return Step size
+         */
+        double initialStep(const System &system, double t, const double *x, double span);
+
+
+        /**
+         * Calculates the weighted root mean square norm of a vector
+         * @param v Vector
+         * @param x Reference state for the relative tolerance
+         * @param y Second reference state for the relative tolerance
+         * @param n Dimension
+         * @return Norm
+         */
+        double norm(const double *v, const double *x, const double *y, size_t n) const;
+
+    };
+
+}
+
+
+#endif //DUMMYPROJECT_DORMANDPRINCE_H
@@ -0,0 +1,64 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include "RungeKutta4.h"
+
+namespace solver {
+
+
+    void RungeKutta4::integrate(const System &system, double t, double h, double *x) {
+
+        auto n = system.size();
+        _k1.resize(n);
+        _k2.resize(n);
+        _k3.resize(n);
+        _k4.resize(n);
+        _y.resize(n);
+
+        // stages
+        evaluate(system, t, x, _k1.data());
+
+        for(size_t i = 0; i < n; ++i)
+            _y[i] = x[i] + 0.5 * h * _k1[i];
+
+        evaluate(system, t + 0.5 * h, _y.data(), _k2.data());
+
+        for(size_t i = 0; i < n; ++i)
+            _y[i] = x[i] + 0.5 * h * _k2[i];
+
+        evaluate(system, t + 0.5 * h, _y.data(), _k3.data());
+
+        for(size_t i = 0; i < n; ++i)
+            _y[i] = x[i] + h * _k3[i];
+
+        evaluate(system, t + h, _y.data(), _k4.data());
+
+        // weighted sum of the stages
+        for(size_t i = 0; i < n; ++i)
+            x[i] += h / 6.0 * (_k1[i] + 2.0 * _k2[i] + 2.0 * _k3[i] + _k4[i]);
+
+        ++_steps;
+
+    }
+
+}
@@ -0,0 +1,53 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_RUNGEKUTTA4_H
+#define DUMMYPROJECT_RUNGEKUTTA4_H
+
+#include <vector>
+#include "Solver.h"
+
+namespace solver {
+
+
+    /**
+     * @brief Classical Runge-Kutta method: four evaluations per step, fourth order.
+     */
+    class RungeKutta4 : public Solver {
+
+    protected:
+
+        std::vector<double> _k1{}, _k2{}, _k3{}, _k4{}; //!< Stage derivatives
+        std::vector<double> _y{};                       //!< Stage state
+
+
+    public:
+
+        void integrate(const System &system, double t, double h, double *x) override;
+
+    };
+
+}
+
+
+#endif //DUMMYPROJECT_RUNGEKUTTA4_H
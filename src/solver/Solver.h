@@ -0,0 +1,151 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SOLVER_H
+#define DUMMYPROJECT_SOLVER_H
+
+#include <cstddef>
+
+namespace solver {
+
+
+    /**
+     * @brief A system of first order ordinary differential equations x' = f(t, x).
+     *
+     * The dynamics of a model implement this interface to be integrated by any of the solvers.
+     */
+    class System {
+
+    public:
+
+        /**
+         * Destructor
+         */
+        virtual ~System() = default;
+
+
+        /**
+         * Returns the dimension of the state vector
+         * @return Dimension
+         */
+        virtual size_t size() const = 0;
+
+
+        /**
+         * Calculates the derivatives of the state vector
+         * @param t Time
+         * @param x State vector
+         * @param dxdt Derivatives of the state vector (output)
+         */
+        virtual void derivatives(double t, const double *x, double *dxdt) const = 0;
+
+    };
+
+
+    /**
+     * @brief Interface of a numerical integration method for a System.
+     *
+     * A solver is stateful (scratch memory, step size control and statistics), so one instance must not be shared
+     * between threads. The scratch memory grows to the largest system integrated and is reused afterwards.
+     */
+    class Solver {
+
+    protected:
+
+        unsigned long _steps = 0;       //!< Number of (accepted) integration steps
+        unsigned long _evaluations = 0; //!< Number of evaluations of the derivatives
+
+
+    public:
+
+        /**
+         * Destructor
+         */
+        virtual ~Solver() = default;
+
+
+        /**
+         * Integrates the system from t to t + h
+         * @param system System to be integrated
+         * @param t Start time
+         * @param h Time span to be integrated
+         * @param x State vector at t (input) and at t + h (output)
+         */
+        virtual void integrate(const System &system, double t, double h, double *x) = 0;
+
+
+        /**
+         * Returns the number of integration steps since the last reset
+         * @return Number of steps
+         */
+        unsigned long steps() const {
+
+            return _steps;
+
+        }
+
+
+        /**
+         * Returns the number of evaluations of the derivatives since the last reset
+         * @return Number of evaluations
+         */
+        unsigned long evaluations() const {
+
+            return _evaluations;
+
+        }
+
+
+        /**
+         * Resets the statistics and the internal state of the solver
+         */
+        virtual void reset() {
+
+            _steps = 0;
+            _evaluations = 0;
+
+        }
+
+
+    protected:
+
+        /**
+         * Evaluates the derivatives of the system and counts the evaluation
+         * @param system System
+         * @param t Time
+         * @param x State vector
+         * @param dxdt Derivatives (output)
+         */
+        void evaluate(const System &system, double t, const double *x, double *dxdt) {
+
+            system.derivatives(t, x, dxdt);
+            ++_evaluations;
+
+        }
+
+    };
+
+}
+
+
+#endif //DUMMYPROJECT_SOLVER_H
@@ -0,0 +1,175 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_ATOMICHISTOGRAM_H
+#define DUMMYPROJECT_ATOMICHISTOGRAM_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include "Histogram.h"
+
+namespace stats {
+
+
+    /**
+     * @brief A lock-free histogram with the bucket layout of Histogram, which can be recorded by several threads and
+     * read by another thread at the same time.
+     *
+     * Recording a value is a few relaxed atomic operations without allocation. The range of the buckets is limited to
+     * the highest trackable value, larger values are counted in the bucket of the highest value (the maximum keeps the
+     * exact value, the percentiles are limited to the upper bound of that bucket). The values are read by a snapshot, which is a Histogram. A snapshot taken while values are recorded
+     * is consistent per bucket, but may miss the sum, minimum or maximum of the latest values.
+     */
+    class AtomicHistogram {
+
+    protected:
+
+        unsigned _precision;                            //!< Number of bits of the sub-buckets
+        uint64_t _highest;                              //!< The highest trackable value
+        size_t _size;                                   //!< Number of buckets
+        std::unique_ptr<std::atomic<uint64_t>[]> _counts; //!< The counts of the buckets
+        std::atomic<uint64_t> _min{};                   //!< Minimum value
+        std::atomic<uint64_t> _max{};                   //!< Maximum value
+        std::atomic<uint64_t> _sum{};                   //!< Sum of the values
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param precision Number of bits of the sub-buckets (1..10)
+         * @param highest The highest trackable value (at least 2^precision)
+         */
+        explicit AtomicHistogram(unsigned precision = 5, uint64_t highest = std::numeric_limits<uint64_t>::max())
+                : _precision(precision), _highest(highest) {
+
+            if(precision < 1 || precision > 10)
+                throw std::invalid_argument("Precision must be between 1 and 10 bits.");
+
+            if(highest < (uint64_t(1) << precision))
+                throw std::invalid_argument("The highest value must be at least 2^precision.");
+
+            _size = Histogram::bucket(highest, precision) + 1;
+            _counts.reset(new std::atomic<uint64_t>[_size]);
+
+            reset();
+
+        }
+
+
+        AtomicHistogram(const AtomicHistogram &) = delete;
+        AtomicHistogram &operator=(const AtomicHistogram &) = delete;
+
+
+        /**
+         * Records a value
+         * @param value Value
+         */
+        void record(uint64_t value) {
+
+            _counts[Histogram::bucket(std::min(value, _highest), _precision)].fetch_add(1, std::memory_order_relaxed);
+            _sum.fetch_add(value, std::memory_order_relaxed);
+
+            // the extremes are only written when they change
+            auto min = _min.load(std::memory_order_relaxed);
+            while(value < min && !_min.compare_exchange_weak(min, value, std::memory_order_relaxed)) {}
+
+            auto max = _max.load(std::memory_order_relaxed);
+            while(value > max && !_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {}
+
+        }
+
+
+        /**
+         * Removes all values (values recorded at the same time may be lost or partially kept)
+         */
+        void reset() {
+
+            for(size_t i = 0; i < _size; ++i)
+                _counts[i].store(0, std::memory_order_relaxed);
+
+            _min.store(std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed);
+            _max.store(0, std::memory_order_relaxed);
+            _sum.store(0, std::memory_order_relaxed);
+
+        }
+
+
+        /**
+         * Returns the number of recorded values (sums up the buckets)
+         * @return Number of values
+         */
+        uint64_t count() const {
+
+            uint64_t count = 0;
+            for(size_t i = 0; i < _size; ++i)
+                count += _counts[i].load(std::memory_order_relaxed);
+
+            return count;
+
+        }
+
+
+        /**
+         * Returns the precision of the histogram
+         * @return Number of bits of the sub-buckets
+         */
+        unsigned precision() const {
+
+            return _precision;
+
+        }
+
+
+        /**
+         * Returns a copy of the recorded values
+         * @return Histogram with the same precision
+         */
+        Histogram snapshot() const {
+
+            Histogram histogram(_precision);
+            for(size_t i = 0; i < _size; ++i) {
+                histogram._counts[i] = _counts[i].load(std::memory_order_relaxed);
+                histogram._count += histogram._counts[i];
+            }
+
+            if(histogram._count != 0) {
+                histogram._min = _min.load(std::memory_order_relaxed);
+                histogram._max = _max.load(std::memory_order_relaxed);
+                histogram._sum = (double) _sum.load(std::memory_order_relaxed);
+            }
+
+            return histogram;
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_ATOMICHISTOGRAM_H
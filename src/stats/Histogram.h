@@ -0,0 +1,287 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_HISTOGRAM_H
+#define DUMMYPROJECT_HISTOGRAM_H
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace stats {
+
+
+    /**
+     * @brief A histogram of non-negative integer values (e.g. latencies in nanoseconds) with log-linear buckets.
+     *
+     * The values are counted in buckets, which are spaced linearly within each power of two: a power of two is divided
+     * into 2^precision sub-buckets, so the relative error of a reported value is below 2^-precision. Small values
+     * (below 2^precision) are counted exactly. Recording a value is a few integer operations without allocation, so
+     * the histogram can be updated in a simulation loop. The histogram is not thread-safe; histograms of several threads
+     * can be merged.
+     */
+    class Histogram {
+
+        friend class AtomicHistogram;
+
+    protected:
+
+        unsigned _precision;                    //!< Number of bits of the sub-buckets
+        std::vector<uint64_t> _counts;          //!< The counts of the buckets
+        uint64_t _count = 0;                    //!< Number of recorded values
+        uint64_t _min = std::numeric_limits<uint64_t>::max();  //!< Minimum value
+        uint64_t _max = 0;                      //!< Maximum value
+        double _sum = 0.0;                      //!< Sum of the values
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param precision Number of bits of the sub-buckets (1..10)
+         */
+        explicit Histogram(unsigned precision = 5) : _precision(precision) {
+
+            if(precision < 1 || precision > 10)
+                throw std::invalid_argument("Precision must be between 1 and 10 bits.");
+
+            _counts.resize(bucket(std::numeric_limits<uint64_t>::max()) + 1, 0);
+
+        }
+
+
+        /**
+         * Records a value
+         * @param value Value
+         */
+        void record(uint64_t value) {
+
+            _counts[bucket(value)]++;
+            _count++;
+            _min = std::min(_min, value);
+            _max = std::max(_max, value);
+            _sum += (double) value;
+
+        }
+
+
+        /**
+         * Adds the values of another histogram with the same precision
+         * @param other Histogram
+         */
+        void merge(const Histogram &other) {
+
+            if(other._precision != _precision)
+                throw std::invalid_argument("Histograms must have the same precision.");
+
+            for(size_t i = 0; i < _counts.size(); ++i)
+                _counts[i] += other._counts[i];
+
+            _count += other._count;
+            _min = std::min(_min, other._min);
+            _max = std::max(_max, other._max);
+            _sum += other._sum;
+
+        }
+
+
+        /**
+         * Removes all values
+         */
+        void reset() {
+
+            std::fill(_counts.begin(), _counts.end(), 0);
+            _count = 0;
+            _min = std::numeric_limits<uint64_t>::max();
+            _max = 0;
+            _sum = 0.0;
+
+        }
+
+
+        /**
+         * Returns the number of recorded values
+         * @return Number of values
+         */
+        uint64_t count() const {
+
+            return _count;
+
+        }
+
+
+        /**
+         * Returns the minimum value
+         * @return Minimum (0, if empty)
+         */
+        uint64_t min() const {
+
+            return _count == 0 ? 0 : _min;
+
+        }
+
+
+        /**
+         * Returns the maximum value
+         * @return Maximum
+         */
+        uint64_t max() const {
+
+            return _max;
+
+        }
+
+
+        /**
+         * Returns the mean value
+         * @return Mean (0, if empty)
+         */
+        double mean() const {
+
+            return _count == 0 ? 0.0 : _sum / (double) _count;
+
+        }
+
+
+        /**
+         * Returns the value below or at which the given percentage of the values lie
+         * @param percentile Percentile (0..100)
+         * @return Value (upper bound of the bucket, limited to the maximum)
+         */
+        uint64_t percentile(double percentile) const {
+
+            if(_count == 0)
+                return 0;
+
+            // rank of the value
+            auto rank = (uint64_t) (percentile / 100.0 * (double) _count + 0.5);
+            rank = std::max<uint64_t>(1, std::min(rank, _count));
+
+            uint64_t sum = 0;
+            for(size_t i = 0; i < _counts.size(); ++i) {
+                sum += _counts[i];
+                if(sum >= rank)
+                    return std::max(_min, std::min(_max, upper(i)));
+            }
+
+            return _max;
+
+        }
+
+
+        /**
+         * Calls the function for each non-empty bucket in ascending order
+         * @tparam F Function type
+         * @param function Function with the arguments lower bound, upper bound (both included) and count
+         */
+        template<typename F>
+        void forEach(F function) const {
+
+            for(size_t i = 0; i < _counts.size(); ++i) {
+                if(_counts[i] != 0)
+                    function(lower(i), upper(i), _counts[i]);
+            }
+
+        }
+
+
+    protected:
+
+
+        /**
+         * Returns the index of the bucket of a value
+         * @param value Value
+         * @return Index
+         */
+        size_t bucket(uint64_t value) const {
+
+            return bucket(value, _precision);
+
+        }
+
+
+        /**
+         * Returns the index of the bucket of a value for the given precision
+         * @param value Value
+         * @param precision Number of bits of the sub-buckets
+         * @return Index
+         */
+        static size_t bucket(uint64_t value, unsigned precision) {
+
+            // exact for small values
+            if(value < (uint64_t(1) << precision))
+                return (size_t) value;
+
+            // position of the leading bit and the following precision bits
+            auto exponent = 63u - (unsigned) __builtin_clzll(value);
+            auto shift = exponent - precision;
+            auto sub = (value >> shift) - (uint64_t(1) << precision);
+
+            return (size_t) ((shift + 1) << precision) + (size_t) sub;
+
+        }
+
+
+        /**
+         * Returns the smallest value of a bucket
+         * @param index Index of the bucket
+         * @return Value
+         */
+        uint64_t lower(size_t index) const {
+
+            auto subBuckets = size_t(1) << _precision;
+            if(index < subBuckets)
+                return index;
+
+            auto shift = (index >> _precision) - 1;
+            auto sub = index & (subBuckets - 1);
+
+            return (uint64_t(subBuckets) + sub) << shift;
+
+        }
+
+
+        /**
+         * Returns the largest value of a bucket
+         * @param index Index of the bucket
+         * @return Value
+         */
+        uint64_t upper(size_t index) const {
+
+            auto subBuckets = size_t(1) << _precision;
+            if(index < subBuckets)
+                return index;
+
+            auto shift = (index >> _precision) - 1;
+            return lower(index) + ((uint64_t(1) << shift) - 1);
+
+        }
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_HISTOGRAM_H
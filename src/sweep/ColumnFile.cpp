@@ -0,0 +1,165 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <stdexcept>
+#include "ColumnFile.h"
+
+namespace sweep {
+
+
+    ColumnWriter::ColumnWriter(const std::string &path, const std::vector<std::string> &names)
+            : _stream(path, std::ios::out | std::ios::binary | std::ios::trunc), _path(path), _columns(names.size()) {
+
+        if(!_stream)
+            throw std::runtime_error("Column file " + path + " could not be created.");
+
+        // header
+        uint32_t version = VERSION;
+        auto columns = (uint32_t) names.size();
+        _stream.write("DCOL", 4);
+        _stream.write(reinterpret_cast<const char *>(&version), sizeof(version));
+        _stream.write(reinterpret_cast<const char *>(&columns), sizeof(columns));
+
+        for(auto &name : names) {
+            auto length = (uint32_t) name.size();
+            _stream.write(reinterpret_cast<const char *>(&length), sizeof(length));
+            _stream.write(name.data(), length);
+        }
+
+        if(!_stream)
+            throw std::runtime_error("Column file " + path + " could not be written.");
+
+    }
+
+
+    void ColumnWriter::write(const std::vector<const double *> &columns, size_t rows) {
+
+        if(columns.size() != _columns)
+            throw std::invalid_argument("Number of columns does not match the header.");
+
+        auto n = (uint64_t) rows;
+        _stream.write(reinterpret_cast<const char *>(&n), sizeof(n));
+
+        for(auto c : columns)
+            _stream.write(reinterpret_cast<const char *>(c), (std::streamsize) (rows * sizeof(double)));
+
+        if(!_stream)
+            throw std::runtime_error("Column file " + _path + " could not be written.");
+
+        _rows += rows;
+
+    }
+
+
+    void ColumnWriter::flush() {
+
+        _stream.flush();
+
+    }
+
+
+    size_t ColumnWriter::rows() const {
+
+        return _rows;
+
+    }
+
+
+    ColumnReader::ColumnReader(const std::string &path) {
+
+        std::ifstream stream(path, std::ios::in | std::ios::binary);
+        if(!stream)
+            throw std::runtime_error("Column file " + path + " could not be opened.");
+
+        // header
+        char magic[4];
+        uint32_t version = 0, columns = 0;
+        stream.read(magic, 4);
+        stream.read(reinterpret_cast<char *>(&version), sizeof(version));
+        stream.read(reinterpret_cast<char *>(&columns), sizeof(columns));
+
+        if(!stream || std::string(magic, 4) != "DCOL" || version != ColumnWriter::VERSION)
+            throw std::runtime_error("File " + path + " is not a column file of version "
+                    + std::to_string(ColumnWriter::VERSION) + ".");
+
+        for(uint32_t i = 0; i < columns; ++i) {
+
+            uint32_t length = 0;
+            stream.read(reinterpret_cast<char *>(&length), sizeof(length));
+
+            std::string name(length, '\0');
+            stream.read(&name[0], length);
+
+            if(!stream)
+                throw std::runtime_error("Column file " + path + " is truncated.");
+
+            _names.push_back(std::move(name));
+
+        }
+
+        // blocks
+        _columns.resize(columns);
+
+        uint64_t rows = 0;
+        while(stream.read(reinterpret_cast<char *>(&rows), sizeof(rows))) {
+
+            for(auto &c : _columns) {
+                auto offset = c.size();
+                c.resize(offset + rows);
+                stream.read(reinterpret_cast<char *>(c.data() + offset), (std::streamsize) (rows * sizeof(double)));
+            }
+
+            if(!stream)
+                throw std::runtime_error("Column file " + path + " is truncated.");
+
+        }
+
+    }
+
+
+    const std::vector<std::string> &ColumnReader::names() const {
+
+        return _names;
+
+    }
+
+
+    size_t ColumnReader::rows() const {
+
+        return _columns.empty() ? 0 : _columns.front().size();
+
+    }
+
+
+    const std::vector<double> &ColumnReader::column(const std::string &name) const {
+
+        for(size_t i = 0; i < _names.size(); ++i) {
+            if(_names[i] == name)
+                return _columns[i];
+        }
+
+        throw std::out_of_range("Column " + name + " does not exist.");
+
+    }
+
+}
@@ -0,0 +1,140 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_COLUMNFILE_H
+#define DUMMYPROJECT_COLUMNFILE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace sweep {
+
+
+    /**
+     * @brief Writes a table of double columns to a binary columnar file.
+     *
+     * The file consists of a header with the column names and of blocks, which are appended as the rows are available.
+     * A block holds the number of rows followed by the values of each column in a contiguous array, so a column can be
+     * read without touching the others:
+     *
+     * * Header: "DCOL", uint32 version, uint32 number of columns, per column uint32 length and name
+     * * Block:  uint64 number of rows, per column the values as doubles
+     */
+    class ColumnWriter {
+
+    public:
+
+        constexpr static const uint32_t VERSION = 1;    //!< The version of the file format
+
+
+    protected:
+
+        std::ofstream _stream;                          //!< The output stream
+        std::string _path;                              //!< The path of the file
+        size_t _columns;                                //!< The number of columns
+        size_t _rows = 0;                               //!< The number of written rows
+
+
+    public:
+
+
+        /**
+         * Constructor. Creates the file and writes the header.
+         * @param path Path of the file
+         * @param names Names of the columns
+         */
+        ColumnWriter(const std::string &path, const std::vector<std::string> &names);
+
+
+        /**
+         * Appends a block of rows
+         * @param columns Pointers to the values of each column (one pointer per column)
+         * @param rows Number of rows
+         */
+        void write(const std::vector<const double *> &columns, size_t rows);
+
+
+        /**
+         * Flushes the written blocks to the file
+         */
+        void flush();
+
+
+        /**
+         * Returns the number of written rows
+         * @return Number of rows
+         */
+        size_t rows() const;
+
+    };
+
+
+    /**
+     * Reads a columnar file completely, @see ColumnWriter
+     */
+    class ColumnReader {
+
+    protected:
+
+        std::vector<std::string> _names{};              //!< The names of the columns
+        std::vector<std::vector<double>> _columns{};    //!< The values of the columns
+
+
+    public:
+
+
+        /**
+         * Constructor. Reads the file.
+         * @param path Path of the file
+         */
+        explicit ColumnReader(const std::string &path);
+
+
+        /**
+         * Returns the names of the columns
+         * @return Names
+         */
+        const std::vector<std::string> &names() const;
+
+
+        /**
+         * Returns the number of rows
+         * @return Number of rows
+         */
+        size_t rows() const;
+
+
+        /**
+         * Returns the values of the column with the given name
+         * @param name Name of the column
+         * @return Values
+         */
+        const std::vector<double> &column(const std::string &name) const;
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_COLUMNFILE_H
@@ -0,0 +1,129 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+#include "Runner.h"
+
+namespace sweep {
+
+
+    Runner::Runner(const Definition &definition, parallel::ThreadPool *pool, size_t batchSize)
+            : _definition(definition), _pool(pool), _batchSize(batchSize) {
+
+        if(batchSize == 0)
+            throw std::invalid_argument("Batch size must be positive.");
+
+    }
+
+
+    size_t Runner::run(const Sink &sink) {
+
+        std::mutex mutex{};
+        auto n = _definition.size();
+
+        auto function = [this, &sink, &mutex](size_t begin, size_t end) {
+
+            std::vector<Scenario> scenarios{};
+            std::vector<Metrics> metrics{};
+
+            // the pool may hand out several batches at once
+            for(size_t first = begin; first < end; first += _batchSize) {
+
+                auto count = std::min(_batchSize, end - first);
+
+                scenarios.resize(count);
+                metrics.resize(count);
+                for(size_t j = 0; j < count; ++j)
+                    scenarios[j] = _definition.at(first + j);
+
+                simulate(scenarios.data(), count, _definition, metrics.data());
+
+                std::lock_guard<std::mutex> lock(mutex);
+                sink(first, scenarios.data(), metrics.data(), count);
+
+            }
+
+        };
+
+        if(_pool != nullptr)
+            _pool->parallelFor(n, function, _batchSize);
+        else if(n > 0)
+            function(0, n);
+
+        return n;
+
+    }
+
+
+    size_t Runner::run(const std::string &path) {
+
+        ColumnWriter writer(path, columns());
+        std::vector<std::vector<double>> values(columns().size());
+
+        auto n = run([&writer, &values](size_t first, const Scenario *scenarios, const Metrics *metrics, size_t n) {
+
+            for(auto &v : values)
+                v.resize(n);
+
+            for(size_t j = 0; j < n; ++j) {
+
+                auto &s = scenarios[j];
+                auto &m = metrics[j];
+
+                values[0][j] = (double) (first + j);
+                values[1][j] = s.kP;
+                values[2][j] = s.kI;
+                values[3][j] = s.kD;
+                values[4][j] = s.mass;
+                values[5][j] = s.maxTorque;
+                values[6][j] = s.targetSpeed;
+                values[7][j] = m.settlingTime;
+                values[8][j] = m.overshoot;
+                values[9][j] = m.steadyStateError;
+
+            }
+
+            std::vector<const double *> pointers{};
+            for(auto &v : values)
+                pointers.push_back(v.data());
+
+            writer.write(pointers, n);
+
+        });
+
+        writer.flush();
+        return n;
+
+    }
+
+
+    std::vector<std::string> Runner::columns() {
+
+        return {"run", "kP", "kI", "kD", "mass", "maxTorque", "targetSpeed",
+                "settlingTime", "overshoot", "steadyStateError"};
+
+    }
+
+}
@@ -0,0 +1,103 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_RUNNER_H
+#define DUMMYPROJECT_RUNNER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+#include <parallel/ThreadPool.h>
+#include "ColumnFile.h"
+#include "Sweep.h"
+
+namespace sweep {
+
+
+    /**
+     * @brief Executes all runs of a sweep definition in batches.
+     *
+     * The runs are split into batches of consecutive run indexes, which are simulated in lockstep (@see simulate()) and
+     * distributed over the threads of the pool. The results are passed to the sink batch by batch as soon as a batch is
+     * finished, so the batches arrive in any order. The sink is called by one thread at a time.
+     */
+    class Runner {
+
+    public:
+
+        /**
+         * The sink of the results of a batch
+         * @param first Index of the first run of the batch
+         * @param scenarios Scenarios of the runs
+         * @param metrics Metrics of the runs
+         * @param n Number of runs in the batch
+         */
+        typedef std::function<void(size_t first, const Scenario *scenarios, const Metrics *metrics, size_t n)> Sink;
+
+
+    protected:
+
+        Definition _definition;                     //!< The sweep definition
+        parallel::ThreadPool *_pool;                //!< The thread pool (nullptr: serial)
+        size_t _batchSize;                          //!< The number of runs simulated in lockstep
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param definition Sweep definition
+         * @param pool Thread pool to run the batches in parallel (nullptr: serial)
+         * @param batchSize Number of runs simulated in lockstep
+         */
+        explicit Runner(const Definition &definition, parallel::ThreadPool *pool = nullptr, size_t batchSize = 256);
+
+
+        /**
+         * Executes all runs
+         * @param sink Sink of the results
+         * @return Number of executed runs
+         */
+        size_t run(const Sink &sink);
+
+
+        /**
+         * Executes all runs and writes the scenarios and metrics to a columnar file (@see ColumnWriter, columns())
+         * @param path Path of the file
+         * @return Number of executed runs
+         */
+        size_t run(const std::string &path);
+
+
+        /**
+         * Returns the names of the columns of the output file
+         * @return Names
+         */
+        static std::vector<std::string> columns();
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_RUNNER_H
@@ -0,0 +1,278 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <cmath>
+#include <stdexcept>
+#include <LongitudinalModel/LongitudinalFleet.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <proto/PIDBank.h>
+#include <proto/PID_controller.h>
+#include "Sweep.h"
+
+namespace sweep {
+
+
+    /**
+     * Tracks the metrics of a run step by step
+     */
+    class MetricsTracker {
+
+        double _target = 0.0;               //!< Target speed
+        double _band = 0.0;                 //!< Absolute settling band
+        double _maxSpeed = 0.0;             //!< Maximum speed
+        double _lastOutside = 0.0;          //!< Last time at which the speed was outside of the band
+        bool _settled = false;              //!< Flag indicating whether the speed is in the band
+
+
+    public:
+
+        MetricsTracker() = default;
+
+        MetricsTracker(double target, double band) : _target(target), _band(band * std::fabs(target)) {}
+
+
+        /**
+         * Adds the speed of a step
+         * @param time Time at the end of the step
+         * @param speed Speed
+         */
+        void add(double time, double speed) {
+
+            _maxSpeed = std::max(_maxSpeed, speed);
+
+            _settled = std::fabs(speed - _target) <= _band;
+            if(!_settled)
+                _lastOutside = time;
+
+        }
+
+
+        /**
+         * Returns the metrics of the run
+         * @param speed Speed at the end of the run
+         * @return Metrics
+         */
+        Metrics get(double speed) const {
+
+            double overshoot = _target > 0.0 ? std::max(0.0, _maxSpeed - _target) / _target : 0.0;
+            return Metrics{_settled ? _lastOutside : NAN, overshoot, std::fabs(_target - speed)};
+
+        }
+
+    };
+
+
+    /**
+     * Returns the number of steps of a run
+     * @param definition Sweep definition
+     * @return Number of steps
+     */
+    static unsigned long numberOfSteps(const Definition &definition) {
+
+        if(definition.timeStepSize <= 0.0)
+            throw std::invalid_argument("Time step size must be positive.");
+
+        return (unsigned long) std::llround(definition.duration / definition.timeStepSize);
+
+    }
+
+
+    double Range::at(size_t index) const {
+
+        if(steps <= 1)
+            return begin;
+
+        return begin + (end - begin) * (double) index / (double) (steps - 1);
+
+    }
+
+
+    Range Range::parse(const std::string &text) {
+
+        Range range{};
+
+        try {
+
+            auto first = text.find(':');
+            if(first == std::string::npos) {
+
+                // single value
+                size_t pos = 0;
+                range.begin = std::stod(text, &pos);
+                range.end = range.begin;
+
+                if(pos != text.size())
+                    throw std::invalid_argument(text);
+
+                return range;
+
+            }
+
+            auto second = text.find(':', first + 1);
+            if(second == std::string::npos)
+                throw std::invalid_argument(text);
+
+            range.begin = std::stod(text.substr(0, first));
+            range.end = std::stod(text.substr(first + 1, second - first - 1));
+
+            auto steps = std::stol(text.substr(second + 1));
+            if(steps < 1)
+                throw std::invalid_argument(text);
+
+            range.steps = (size_t) steps;
+
+        } catch(const std::logic_error &) {
+            throw std::invalid_argument("Range \"" + text + "\" must be given as begin:end:steps or as a value.");
+        }
+
+        return range;
+
+    }
+
+
+    size_t Definition::size() const {
+
+        return kP.steps * kI.steps * kD.steps * mass.steps * maxTorque.steps * targetSpeed.steps;
+
+    }
+
+
+    Scenario Definition::at(size_t index) const {
+
+        if(index >= size())
+            throw std::out_of_range("Run index out of range.");
+
+        // mixed radix, the first range changes fastest
+        Scenario s{};
+        s.kP = kP.at(index % kP.steps);
+        index /= kP.steps;
+        s.kI = kI.at(index % kI.steps);
+        index /= kI.steps;
+        s.kD = kD.at(index % kD.steps);
+        index /= kD.steps;
+        s.mass = mass.at(index % mass.steps);
+        index /= mass.steps;
+        s.maxTorque = maxTorque.at(index % maxTorque.steps);
+        index /= maxTorque.steps;
+        s.targetSpeed = targetSpeed.at(index);
+
+        return s;
+
+    }
+
+
+    Metrics simulate(const Scenario &scenario, const Definition &definition) {
+
+        auto steps = numberOfSteps(definition);
+        auto dt = definition.timeStepSize;
+
+        // controller
+        PID_controller controller{};
+        controller.create();
+        controller.setParameters(scenario.kP, scenario.kI, scenario.kD);
+        controller.reset();
+
+        // vehicle
+        models::Parameters parameters{};
+        parameters.mass = scenario.mass;
+        parameters.maxTorque = scenario.maxTorque;
+
+        models::LongitudinalModel vehicle{};
+        vehicle.setParameters(parameters);
+
+        // closed loop
+        MetricsTracker tracker(scenario.targetSpeed, definition.settlingBand);
+        for(unsigned long i = 0; i < steps; ++i) {
+
+            double t = dt * (double) i;
+
+            controller.setInput(scenario.targetSpeed - vehicle.getState().v);
+            controller.step(t, dt);
+            vehicle.modelStep(controller.getOutput(), dt);
+
+            tracker.add(t + dt, vehicle.getState().v);
+
+        }
+
+        return tracker.get(vehicle.getState().v);
+
+    }
+
+
+    void simulate(const Scenario *scenarios, size_t n, const Definition &definition, Metrics *metrics) {
+
+        auto steps = numberOfSteps(definition);
+        auto dt = definition.timeStepSize;
+
+        PIDBank controllers{};
+        models::LongitudinalFleet vehicles{};
+        std::vector<MetricsTracker> trackers(n);
+
+        controllers.reserve(n);
+        vehicles.reserve(n);
+
+        for(size_t j = 0; j < n; ++j) {
+
+            auto &s = scenarios[j];
+
+            models::Parameters parameters{};
+            parameters.mass = s.mass;
+            parameters.maxTorque = s.maxTorque;
+
+            controllers.add(s.kP, s.kI, s.kD);
+            vehicles.add(parameters);
+            trackers[j] = MetricsTracker(s.targetSpeed, definition.settlingBand);
+
+        }
+
+        // closed loop
+        auto errors = controllers.inputs();
+        auto pedals = vehicles.inputs();
+        auto outputs = controllers.outputs();
+        auto speeds = vehicles.velocities();
+
+        for(unsigned long i = 0; i < steps; ++i) {
+
+            double t = dt * (double) i;
+
+            for(size_t j = 0; j < n; ++j)
+                errors[j] = scenarios[j].targetSpeed - speeds[j];
+
+            controllers.step(t, dt);
+
+            for(size_t j = 0; j < n; ++j)
+                pedals[j] = outputs[j];
+
+            vehicles.step(dt);
+
+            for(size_t j = 0; j < n; ++j)
+                trackers[j].add(t + dt, speeds[j]);
+
+        }
+
+        for(size_t j = 0; j < n; ++j)
+            metrics[j] = trackers[j].get(speeds[j]);
+
+    }
+
+}
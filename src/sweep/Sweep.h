@@ -0,0 +1,156 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_SWEEP_H
+#define DUMMYPROJECT_SWEEP_H
+
+#include <string>
+#include <vector>
+
+namespace sweep {
+
+
+    /**
+     * A range of equidistant values of a swept parameter
+     */
+    struct Range {
+
+        double begin = 0.0;                 //!< First value
+        double end = 0.0;                   //!< Last value (included)
+        size_t steps = 1;                   //!< Number of values
+
+
+        /**
+         * Returns the value with the given index
+         * @param index Index of the value
+         * @return Value
+         */
+        double at(size_t index) const;
+
+
+        /**
+         * @brief Parses a range.
+         *
+         * The range is given as "begin:end:steps" or as a single value.
+         *
+         * @param text Text to be parsed
+         * @return Range
+         */
+        static Range parse(const std::string &text);
+
+    };
+
+
+    /**
+     * The parameters of a single run of the closed loop (PID controller and longitudinal model)
+     */
+    struct Scenario {
+
+        double kP;                          //!< Proportional gain
+        double kI;                          //!< Integral gain
+        double kD;                          //!< Derivative gain
+        double mass;                        //!< Vehicle mass
+        double maxTorque;                   //!< Maximum torque of the vehicle
+        double targetSpeed;                 //!< Target speed of the controller
+
+    };
+
+
+    /**
+     * The summary metrics of a run
+     */
+    struct Metrics {
+
+        double settlingTime;                //!< Time after which the speed stays in the band (NaN: not settled)
+        double overshoot;                   //!< Maximum speed above the target relative to the target speed
+        double steadyStateError;            //!< Absolute speed error at the end of the run
+
+    };
+
+
+    /**
+     * @brief The definition of a parameter sweep.
+     *
+     * The runs are the cartesian product of the ranges. The scenario of a run is computed from its index, so the runs
+     * don't have to be enumerated beforehand.
+     */
+    struct Definition {
+
+        Range kP{0.01, 0.01, 1};            //!< Proportional gain
+        Range kI{0.001, 0.001, 1};          //!< Integral gain
+        Range kD{0.0, 0.0, 1};              //!< Derivative gain
+        Range mass{1300.0, 1300.0, 1};      //!< Vehicle mass
+        Range maxTorque{5000.0, 5000.0, 1}; //!< Maximum torque of the vehicle
+        Range targetSpeed{20.0, 20.0, 1};   //!< Target speed of the controller
+
+        double duration = 60.0;             //!< Simulated time of a run
+        double timeStepSize = 0.01;         //!< Time step size of the closed loop
+        double settlingBand = 0.02;         //!< Settling band relative to the target speed
+
+
+        /**
+         * Returns the number of runs
+         * @return Number of runs
+         */
+        size_t size() const;
+
+
+        /**
+         * Returns the scenario of the run with the given index
+         * @param index Index of the run
+         * @return Scenario
+         */
+        Scenario at(size_t index) const;
+
+    };
+
+
+    /**
+     * @brief Simulates the closed loop of a single scenario.
+     *
+     * In each step, the controller gets the speed error of the last vehicle step and its output is the pedal value of
+     * the vehicle.
+     *
+     * @param scenario Scenario
+     * @param definition Sweep definition (duration, time step size and settling band)
+     * @return Metrics
+     */
+    Metrics simulate(const Scenario &scenario, const Definition &definition);
+
+
+    /**
+     * @brief Simulates the closed loops of the scenarios in lockstep.
+     *
+     * The controllers are stepped in a PIDBank and the vehicles in a LongitudinalFleet, so all runs of the batch are
+     * calculated by vectorized kernels. The results are identical to simulate().
+     *
+     * @param scenarios Scenarios
+     * @param n Number of scenarios
+     * @param definition Sweep definition (duration, time step size and settling band)
+     * @param metrics Metrics to be written (n elements)
+     */
+    void simulate(const Scenario *scenarios, size_t n, const Definition &definition, Metrics *metrics);
+
+}
+
+#endif //DUMMYPROJECT_SWEEP_H
@@ -0,0 +1,147 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <cmath>
+#include <cstring>
+#include <proto/Models.pb.h>
+#include "CommandInbox.h"
+
+namespace telemetry {
+
+
+    CommandInbox::CommandInbox(size_t units, std::string topicPrefix)
+            : _prefix(std::move(topicPrefix)), _size(units), _mailboxes(new std::atomic<uint64_t>[units]),
+              _epoch(Clock::now()) {
+
+        for(size_t i = 0; i < units; ++i)
+            _mailboxes[i].store(EMPTY, std::memory_order_relaxed);
+
+    }
+
+
+    size_t CommandInbox::size() const {
+
+        return _size;
+
+    }
+
+
+    std::string CommandInbox::topic(size_t unit) const {
+
+        return _prefix + "/" + std::to_string(unit) + "/input";
+
+    }
+
+
+    void CommandInbox::subscribe(Transport &transport) {
+
+        transport.subscribe(_prefix + "/+/input", [this](const char *topic, const char *payload, size_t size) {
+            receive(topic, payload, size);
+        });
+
+    }
+
+
+    bool CommandInbox::receive(const char *topic, const char *payload, size_t size, Clock::time_point arrival) {
+
+        size_t unit = 0;
+        if(!parse(_prefix, topic, unit)) {
+            _malformed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // a message with scalar fields only is decoded without allocation
+        simulation::models::VehicleInput input{};
+        if(!input.ParseFromArray(payload, (int) size) || !std::isfinite(input.pedal())) {
+            _malformed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        return post(unit, input.pedal(), arrival);
+
+    }
+
+
+    bool CommandInbox::post(size_t unit, double pedal, Clock::time_point arrival) {
+
+        if(unit >= _size) {
+            _unknown.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // the pedal is stored in single precision
+        auto value = (float) pedal;
+        if(!std::isfinite(value)) {
+            _malformed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        // pack the pedal and the timestamp
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+
+        auto word = ((uint64_t) bits << 32) | timestamp(arrival);
+        if(_mailboxes[unit].exchange(word, std::memory_order_release) != EMPTY)
+            _superseded.fetch_add(1, std::memory_order_relaxed);
+
+        _received.fetch_add(1, std::memory_order_relaxed);
+        return true;
+
+    }
+
+
+    CommandInbox::Statistics CommandInbox::statistics() const {
+
+        return Statistics{_received.load(), _applied.load(), _superseded.load(), _malformed.load(), _unknown.load()};
+
+    }
+
+
+    bool CommandInbox::parse(const std::string &prefix, const char *topic, size_t &unit) {
+
+        // prefix and separator
+        if(std::strncmp(topic, prefix.c_str(), prefix.size()) != 0 || topic[prefix.size()] != '/')
+            return false;
+
+        // unit (decimal, at most 9 digits)
+        auto p = topic + prefix.size() + 1;
+        size_t value = 0, digits = 0;
+        for(; *p >= '0' && *p <= '9' && digits < 10; ++p, ++digits)
+            value = value * 10 + (size_t) (*p - '0');
+
+        if(digits == 0 || digits > 9 || std::strcmp(p, "/input") != 0)
+            return false;
+
+        unit = value;
+        return true;
+
+    }
+
+
+    uint32_t CommandInbox::timestamp(Clock::time_point time) const {
+
+        return (uint32_t) std::chrono::duration_cast<std::chrono::microseconds>(time - _epoch).count();
+
+    }
+
+}
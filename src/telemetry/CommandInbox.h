@@ -0,0 +1,223 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_COMMANDINBOX_H
+#define DUMMYPROJECT_COMMANDINBOX_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include "Transport.h"
+
+namespace telemetry {
+
+
+    /**
+     * @brief Receives the pedal commands of vehicles (VehicleInput messages on the topics "<prefix>/<unit>/input") and
+     * hands them to the simulation.
+     *
+     * Each unit has a mailbox holding the latest command, which is a single 64-bit word (the pedal as float and the
+     * arrival time in microseconds), so posting and taking a command is one atomic operation without locks. The pedal is
+     * therefore delivered in single precision: it is rounded to the nearest float (a relative error below 6e-8, which is
+     * far below the resolution of a pedal), values beyond the range of a float are rejected. A command
+     * replaces a command of the same unit, which was not taken yet (it is superseded). The simulation thread takes the
+     * commands with drain() at the start of each tick.
+     *
+     * The messages are decoded into a message on the stack, so the receive path does not allocate memory.
+     */
+    class CommandInbox {
+
+    public:
+
+        typedef std::chrono::steady_clock Clock;
+
+        //!< The counters of the inbox
+        struct Statistics {
+            uint64_t received;                      //!< Commands posted to the mailboxes
+            uint64_t applied;                       //!< Commands taken by drain()
+            uint64_t superseded;                    //!< Commands replaced before they were taken
+            uint64_t malformed;                     //!< Messages with an invalid topic or payload
+            uint64_t unknown;                       //!< Messages for units not in the inbox
+        };
+
+
+    protected:
+
+        //!< The value of an empty mailbox (the pedal bits of a NaN, which is never posted)
+        static constexpr uint64_t EMPTY = ~uint64_t(0);
+
+        std::string _prefix;                        //!< The topic prefix
+        size_t _size;                               //!< The number of units
+        std::unique_ptr<std::atomic<uint64_t>[]> _mailboxes; //!< The mailboxes of the units
+        Clock::time_point _epoch;                   //!< The reference of the arrival times
+
+        // counters
+        std::atomic<uint64_t> _received{0};         //!< @see Statistics
+        std::atomic<uint64_t> _applied{0};          //!< @see Statistics
+        std::atomic<uint64_t> _superseded{0};       //!< @see Statistics
+        std::atomic<uint64_t> _malformed{0};        //!< @see Statistics
+        std::atomic<uint64_t> _unknown{0};          //!< @see Statistics
+
+
+    public:
+
+
+        /**
+         * Constructor
+         * @param units Number of units
+         * @param topicPrefix Prefix of the topics
+         */
+        explicit CommandInbox(size_t units, std::string topicPrefix = "vehicles");
+
+
+        CommandInbox(const CommandInbox &) = delete;
+        CommandInbox &operator=(const CommandInbox &) = delete;
+
+
+        /**
+         * Returns the number of units
+         * @return Number of units
+         */
+        size_t size() const;
+
+
+        /**
+         * Returns the command topic of a unit
+         * @param unit Unit
+         * @return Topic
+         */
+        std::string topic(size_t unit) const;
+
+
+        /**
+         * Subscribes to the command topics of all units. The inbox must outlive the subscription.
+         * @param transport Transport
+         */
+        void subscribe(Transport &transport);
+
+
+        /**
+         * Decodes a received message and posts the command to the mailbox of the unit (@see post()). Can be called by
+         * any thread.
+         * @param topic Topic (null-terminated)
+         * @param payload Serialized VehicleInput (the ID in the message is ignored, the unit is taken from the topic)
+         * @param size Size of the payload
+         * @param arrival Arrival time of the message
+         * @return Flag indicating whether the command was posted
+         */
+        bool receive(const char *topic, const char *payload, size_t size, Clock::time_point arrival = Clock::now());
+
+
+        /**
+         * Posts a command to the mailbox of the unit. The pedal is rounded to single precision. Can be called by any
+         * thread.
+         * @param unit Unit
+         * @param pedal Pedal value (must be finite in single precision)
+         * @param arrival Arrival time of the command
+         * @return Flag indicating whether the command was posted
+         */
+        bool post(size_t unit, double pedal, Clock::time_point arrival = Clock::now());
+
+
+        /**
+         * @brief Takes the commands from the mailboxes and passes them to the function.
+         *
+         * The function is called with the unit, the pedal value (rounded to single precision by post()) and the time
+         * since the arrival of the command (std::chrono::microseconds). Must be called by one thread at a time.
+         *
+         * @tparam F Function type
+         * @param apply Function
+         * @param now Time the commands are applied
+         * @return Number of taken commands
+         */
+        template<typename F>
+        size_t drain(F apply, Clock::time_point now = Clock::now()) {
+
+            auto time = timestamp(now);
+
+            size_t n = 0;
+            for(size_t i = 0; i < _size; ++i) {
+
+                // most mailboxes are empty, only take the others
+                auto &mailbox = _mailboxes[i];
+                if(mailbox.load(std::memory_order_relaxed) == EMPTY)
+                    continue;
+
+                auto value = mailbox.exchange(EMPTY, std::memory_order_acquire);
+                if(value == EMPTY)
+                    continue;
+
+                auto arrival = (uint32_t) value;
+                auto bits = (uint32_t) (value >> 32);
+
+                float pedal;
+                static_assert(sizeof(pedal) == sizeof(bits), "float must be 32 bit");
+                std::memcpy(&pedal, &bits, sizeof(pedal));
+
+                // the difference of the timestamps is correct for latencies up to 2^32 microseconds
+                apply(i, (double) pedal, std::chrono::microseconds((uint32_t) (time - arrival)));
+                ++n;
+
+            }
+
+            _applied.fetch_add(n, std::memory_order_relaxed);
+            return n;
+
+        }
+
+
+        /**
+         * Returns the counters
+         * @return Statistics
+         */
+        Statistics statistics() const;
+
+
+        /**
+         * Parses the unit from a command topic ("<prefix>/<unit>/input")
+         * @param prefix Topic prefix
+         * @param topic Topic (null-terminated)
+         * @param unit Unit (output)
+         * @return Flag indicating whether the topic is a command topic
+         */
+        static bool parse(const std::string &prefix, const char *topic, size_t &unit);
+
+
+    protected:
+
+
+        /**
+         * Returns the 32-bit timestamp of a time in microseconds since the epoch of the inbox (wraps after 71 minutes)
+         * @param time Time
+         * @return Timestamp
+         */
+        uint32_t timestamp(Clock::time_point time) const;
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_COMMANDINBOX_H
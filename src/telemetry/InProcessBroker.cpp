@@ -0,0 +1,143 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include "InProcessBroker.h"
+
+namespace telemetry {
+
+
+    InProcessBroker::InProcessBroker(std::chrono::microseconds latency) : _latency(latency) {
+
+        _thread = std::thread(&InProcessBroker::work, this);
+
+    }
+
+
+    InProcessBroker::~InProcessBroker() {
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+            _paused = false;
+        }
+
+        _condition.notify_all();
+        _thread.join();
+
+    }
+
+
+    void InProcessBroker::subscribe(const std::string &filter, Handler handler) {
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _subscriptions.push_back(Subscription{filter, std::move(handler)});
+
+    }
+
+
+    void InProcessBroker::publish(const std::string &topic, std::string &&payload, Completion completion) {
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _messages.push_back(Message{topic, std::move(payload), std::move(completion),
+                    std::chrono::steady_clock::now() + _latency});
+        }
+
+        _condition.notify_all();
+
+    }
+
+
+    void InProcessBroker::pause() {
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _paused = true;
+
+    }
+
+
+    void InProcessBroker::resume() {
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _paused = false;
+        }
+
+        _condition.notify_all();
+
+    }
+
+
+    uint64_t InProcessBroker::delivered() {
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _delivered;
+
+    }
+
+
+    void InProcessBroker::work() {
+
+        std::vector<Handler> handlers{};
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        while(true) {
+
+            _condition.wait(lock, [this] { return _stop || (!_paused && !_messages.empty()); });
+
+            if(_messages.empty())
+                return;
+
+            // wait for the latency
+            auto due = _messages.front().due;
+            if(!_stop && std::chrono::steady_clock::now() < due) {
+                _condition.wait_until(lock, due);
+                continue;
+            }
+
+            auto message = std::move(_messages.front());
+            _messages.pop_front();
+
+            // deliver without lock (handlers may publish)
+            handlers.clear();
+            for(auto &s : _subscriptions) {
+                if(matches(s.filter, message.topic.c_str()))
+                    handlers.push_back(s.handler);
+            }
+
+            lock.unlock();
+
+            for(auto &h : handlers)
+                h(message.topic.c_str(), message.payload.data(), message.payload.size());
+
+            if(message.completion)
+                message.completion(true);
+
+            lock.lock();
+            _delivered++;
+
+        }
+
+    }
+
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_INPROCESSBROKER_H
+#define DUMMYPROJECT_INPROCESSBROKER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Transport.h"
+
+namespace telemetry {
+
+
+    /**
+     * @brief A message broker in the process, which can be used instead of an MQTT broker for tests and benchmarks.
+     *
+     * The published messages are delivered to the subscribers and completed by a delivery thread in the order of
+     * publishing, optionally after a latency to emulate the network. The delivery can be paused to emulate a stalled
+     * connection.
+     */
+    class InProcessBroker : public Transport {
+
+    protected:
+
+        //!< A published message
+        struct Message {
+            std::string topic;                              //!< Topic
+            std::string payload;                            //!< Payload
+            Completion completion;                          //!< Completion of the publisher
+            std::chrono::steady_clock::time_point due;      //!< Time of the delivery
+        };
+
+        //!< A subscription
+        struct Subscription {
+            std::string filter;                             //!< Topic filter
+            Handler handler;                                //!< Handler
+        };
+
+        std::chrono::microseconds _latency;                 //!< The latency of the delivery
+
+        std::mutex _mutex{};                                //!< Mutex of the messages and subscriptions
+        std::condition_variable _condition{};               //!< Condition to wake up the delivery thread
+        std::deque<Message> _messages{};                    //!< The messages not delivered yet
+        std::vector<Subscription> _subscriptions{};         //!< The subscriptions
+        bool _paused = false;                               //!< Flag indicating that the delivery is paused
+        bool _stop = false;                                 //!< Flag to stop the delivery thread
+        uint64_t _delivered = 0;                            //!< Number of delivered messages
+
+        std::thread _thread{};                              //!< The delivery thread
+
+
+    public:
+
+
+        /**
+         * Constructor. Starts the delivery thread.
+         * @param latency Latency of the delivery
+         */
+        explicit InProcessBroker(std::chrono::microseconds latency = std::chrono::microseconds(0));
+
+
+        /**
+         * Destructor. Delivers the remaining messages and stops the delivery thread.
+         */
+        ~InProcessBroker() override;
+
+
+        InProcessBroker(const InProcessBroker &) = delete;
+        InProcessBroker &operator=(const InProcessBroker &) = delete;
+
+
+        /**
+         * Subscribes to the topics matching the filter. The handler is called by the delivery thread.
+         * @param filter Topic filter
+         * @param handler Handler
+         */
+        void subscribe(const std::string &filter, Handler handler) override;
+
+
+        void publish(const std::string &topic, std::string &&payload, Completion completion) override;
+
+
+        /**
+         * Pauses the delivery, the messages are queued
+         */
+        void pause();
+
+
+        /**
+         * Resumes the delivery
+         */
+        void resume();
+
+
+        /**
+         * Returns the number of delivered messages
+         * @return Number of messages
+         */
+        uint64_t delivered();
+
+
+    protected:
+
+
+        /**
+         * The loop of the delivery thread
+         */
+        void work();
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_INPROCESSBROKER_H
@@ -0,0 +1,204 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <future>
+#include <stdexcept>
+#include <MQTTAsync.h>
+#include "PahoTransport.h"
+
+namespace telemetry {
+
+
+    //!< Result of a connection or subscription (error message, empty on success)
+    typedef std::promise<std::string> Result;
+
+
+    static void onSuccess(void *context, MQTTAsync_successData *) {
+
+        static_cast<Result *>(context)->set_value("");
+
+    }
+
+
+    static void onFailure(void *context, MQTTAsync_failureData *response) {
+
+        std::string message = response != nullptr && response->message != nullptr ? response->message : "unknown error";
+        static_cast<Result *>(context)->set_value(message);
+
+    }
+
+
+    static int onMessage(void *context, char *topic, int, MQTTAsync_message *message) {
+
+        static_cast<PahoTransport *>(context)->dispatch(topic, static_cast<const char *>(message->payload),
+                (size_t) message->payloadlen);
+
+        MQTTAsync_freeMessage(&message);
+        MQTTAsync_free(topic);
+
+        return 1;
+
+    }
+
+
+    static void onDelivered(void *context, MQTTAsync_successData *) {
+
+        auto completion = static_cast<Transport::Completion *>(context);
+        (*completion)(true);
+        delete completion;
+
+    }
+
+
+    static void onFailed(void *context, MQTTAsync_failureData *) {
+
+        auto completion = static_cast<Transport::Completion *>(context);
+        (*completion)(false);
+        delete completion;
+
+    }
+
+
+    PahoTransport::PahoTransport(const std::string &address, const std::string &clientId, int qos, int maxBuffered)
+            : _qos(qos) {
+
+        MQTTAsync client = nullptr;
+        MQTTAsync_createOptions createOptions = MQTTAsync_createOptions_initializer;
+        createOptions.sendWhileDisconnected = 0;
+        createOptions.maxBufferedMessages = maxBuffered;
+
+        if(MQTTAsync_createWithOptions(&client, address.c_str(), clientId.c_str(), MQTTCLIENT_PERSISTENCE_NONE, nullptr,
+                &createOptions) != MQTTASYNC_SUCCESS)
+            throw std::runtime_error("MQTT client for " + address + " could not be created.");
+
+        _client = client;
+
+        // the callbacks must be set before connecting
+        MQTTAsync_setCallbacks(client, this, nullptr, onMessage, nullptr);
+
+        // connect and wait
+        Result result{};
+        auto future = result.get_future();
+
+        MQTTAsync_connectOptions options = MQTTAsync_connectOptions_initializer;
+        options.keepAliveInterval = 20;
+        options.cleansession = 1;
+        options.onSuccess = onSuccess;
+        options.onFailure = onFailure;
+        options.context = &result;
+
+        std::string error{};
+        if(MQTTAsync_connect(client, &options) != MQTTASYNC_SUCCESS)
+            error = "connect failed";
+        else
+            error = future.get();
+
+        if(!error.empty()) {
+            MQTTAsync_destroy(&client);
+            throw std::runtime_error("Could not connect to MQTT broker " + address + ": " + error);
+        }
+
+    }
+
+
+    PahoTransport::~PahoTransport() {
+
+        auto client = static_cast<MQTTAsync>(_client);
+
+        MQTTAsync_disconnectOptions options = MQTTAsync_disconnectOptions_initializer;
+        options.timeout = 1000;
+        MQTTAsync_disconnect(client, &options);
+
+        MQTTAsync_destroy(&client);
+
+    }
+
+
+    void PahoTransport::publish(const std::string &topic, std::string &&payload, Completion completion) {
+
+        // the completion is owned by the client until a callback is called
+        auto context = new Completion(std::move(completion));
+
+        MQTTAsync_responseOptions options = MQTTAsync_responseOptions_initializer;
+        options.onSuccess = onDelivered;
+        options.onFailure = onFailed;
+        options.context = context;
+
+        // the payload is copied by the client
+        MQTTAsync_message message = MQTTAsync_message_initializer;
+        message.payload = const_cast<char *>(payload.data());
+        message.payloadlen = (int) payload.size();
+        message.qos = _qos;
+        message.retained = 0;
+
+        if(MQTTAsync_sendMessage(static_cast<MQTTAsync>(_client), topic.c_str(), &message, &options)
+                != MQTTASYNC_SUCCESS) {
+            (*context)(false);
+            delete context;
+        }
+
+    }
+
+
+    void PahoTransport::subscribe(const std::string &filter, Handler handler) {
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _subscriptions.push_back(Subscription{filter, std::move(handler)});
+        }
+
+        // subscribe and wait
+        Result result{};
+        auto future = result.get_future();
+
+        MQTTAsync_responseOptions options = MQTTAsync_responseOptions_initializer;
+        options.onSuccess = onSuccess;
+        options.onFailure = onFailure;
+        options.context = &result;
+
+        std::string error{};
+        if(MQTTAsync_subscribe(static_cast<MQTTAsync>(_client), filter.c_str(), _qos, &options) != MQTTASYNC_SUCCESS)
+            error = "subscribe failed";
+        else
+            error = future.get();
+
+        if(!error.empty()) {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _subscriptions.pop_back();
+            throw std::runtime_error("Could not subscribe to " + filter + ": " + error);
+        }
+
+    }
+
+
+    void PahoTransport::dispatch(const char *topic, const char *payload, size_t size) {
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        for(auto &s : _subscriptions) {
+            if(matches(s.filter, topic))
+                s.handler(topic, payload, size);
+        }
+
+    }
+
+}
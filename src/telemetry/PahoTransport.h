@@ -0,0 +1,109 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_PAHOTRANSPORT_H
+#define DUMMYPROJECT_PAHOTRANSPORT_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Transport.h"
+
+namespace telemetry {
+
+
+    /**
+     * @brief A transport publishing to an MQTT broker with the asynchronous Paho C client.
+     *
+     * The messages are pipelined: publish() hands the message to the client and returns immediately, the completion is
+     * called by the client thread when the broker acknowledged the message (QoS 1 and 2) or when it was written to the
+     * socket (QoS 0).
+     *
+     * The received messages are dispatched by the client thread to the handlers of the matching subscriptions. The
+     * payload is passed to the handlers in the buffer of the client.
+     */
+    class PahoTransport : public Transport {
+
+    protected:
+
+        //!< A subscription
+        struct Subscription {
+            std::string filter;                     //!< Topic filter
+            Handler handler;                        //!< Handler
+        };
+
+        void *_client = nullptr;                    //!< The client handle
+        int _qos;                                   //!< The quality of service
+
+        std::mutex _mutex{};                        //!< Mutex of the subscriptions
+        std::vector<Subscription> _subscriptions{}; //!< The subscriptions
+
+
+    public:
+
+
+        /**
+         * Constructor. Connects to the broker and waits for the connection.
+         * @param address Address of the broker (e.g. "tcp://localhost:1883")
+         * @param clientId ID of the client
+         * @param qos Quality of service (0, 1, 2)
+         * @param maxBuffered Maximum number of messages buffered by the client
+         */
+        PahoTransport(const std::string &address, const std::string &clientId, int qos = 1, int maxBuffered = 1024);
+
+
+        /**
+         * Destructor. Disconnects from the broker.
+         */
+        ~PahoTransport() override;
+
+
+        PahoTransport(const PahoTransport &) = delete;
+        PahoTransport &operator=(const PahoTransport &) = delete;
+
+
+        void publish(const std::string &topic, std::string &&payload, Completion completion) override;
+
+
+        /**
+         * Subscribes to the topics matching the filter and waits for the acknowledgement of the broker. The handler is
+         * called by the client thread and must not subscribe.
+         * @param filter Topic filter
+         * @param handler Handler
+         */
+        void subscribe(const std::string &filter, Handler handler) override;
+
+
+        /**
+         * Dispatches a received message to the handlers of the matching subscriptions
+         * @param topic Topic
+         * @param payload Payload
+         * @param size Size of the payload
+         */
+        void dispatch(const char *topic, const char *payload, size_t size);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_PAHOTRANSPORT_H
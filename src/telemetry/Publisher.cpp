@@ -0,0 +1,293 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <stdexcept>
+#include "Publisher.h"
+
+namespace telemetry {
+
+
+    Publisher::Publisher(Transport &transport) : Publisher(transport, Options{}) {}
+
+
+    Publisher::Publisher(Transport &transport, const Options &options) : _transport(transport), _options(options) {
+
+        if(options.maxBatch == 0 || options.maxInFlight == 0)
+            throw std::invalid_argument("Batch size and number of messages in flight must be positive.");
+
+        if(options.maxPending < options.maxBatch)
+            throw std::invalid_argument("Maximum number of buffered states must not be less than the batch size.");
+
+        _thread = std::thread(&Publisher::work, this);
+
+    }
+
+
+    Publisher::~Publisher() {
+
+        close();
+
+    }
+
+
+    void Publisher::flush() {
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        if(_stop)
+            return;
+
+        _flushing++;
+        _condition.notify_all();
+
+        // wait until everything is published and completed
+        _condition.wait(lock, [this] {
+            return _queued.load() == 0 && _buffered.load() == 0 && _inFlight == 0;
+        });
+
+        _flushing--;
+
+    }
+
+
+    void Publisher::close() {
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_stop)
+                return;
+
+            _stop = true;
+        }
+
+        _condition.notify_all();
+        _thread.join();
+
+    }
+
+
+    Publisher::Statistics Publisher::statistics() const {
+
+        return Statistics{_pushed.load(), _dropped.load(), _conflated.load(), _published.load(), _messages.load(),
+                _failed.load()};
+
+    }
+
+
+    void Publisher::work() {
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        while(true) {
+
+            bool stop = _stop;
+            bool force = stop || _flushing > 0;
+            lock.unlock();
+
+            // collect and publish without lock (the completion may be called synchronously)
+            auto now = Clock::now();
+            collect();
+            auto next = publish(now, force);
+
+            lock.lock();
+
+            bool idle = _queued.load() == 0 && _buffered.load() == 0 && _inFlight == 0;
+            if(idle)
+                _condition.notify_all();
+
+            if(stop && idle)
+                return;
+
+            // wait for the next due batch, a completion or new states (pushes don't notify)
+            now = Clock::now();
+            bool pending = _queued.load() > 0
+                    || (_buffered.load() > 0 && _inFlight < _options.maxInFlight && (force || next <= now));
+
+            if(!pending)
+                _condition.wait_until(lock, std::min(next, now + _options.linger));
+
+        }
+
+    }
+
+
+    size_t Publisher::collect() {
+
+        auto now = Clock::now();
+
+        size_t n = 0;
+        Sample sample{};
+        while(_queue.pop(sample)) {
+
+            // buffered before unqueued, so flush() never sees the state in neither counter
+            add(sample, now);
+            _queued.fetch_sub(1, std::memory_order_release);
+            n++;
+
+        }
+
+        return n;
+
+    }
+
+
+    void Publisher::add(const Sample &sample, Clock::time_point now) {
+
+        // topic
+        uint32_t key = _options.partitions == 0 ? sample.id : (uint32_t) (sample.id % _options.partitions);
+        auto index = _topicIndex.find(key);
+        if(index == nullptr) {
+            index = _topicIndex.insert(key, _topics.size()).first;
+            _topics.push_back(Topic{_options.topicPrefix + "/" + std::to_string(key), {}, now});
+        }
+
+        auto &topic = _topics[*index];
+        if(topic.samples.empty()) {
+            topic.oldest = now;
+            _active.push_back(*index);
+        }
+
+        topic.samples.push_back(sample);
+        _buffered.fetch_add(1, std::memory_order_relaxed);
+
+        if(topic.samples.size() < _options.maxPending)
+            return;
+
+        // downsample to the latest state of each vehicle
+        auto &samples = topic.samples;
+        _latest.clear();
+        for(size_t i = 0; i < samples.size(); ++i) {
+            auto inserted = _latest.insert(samples[i].id, i);
+            if(!inserted.second)
+                *inserted.first = i;
+        }
+
+        size_t kept = 0;
+        for(size_t i = 0; i < samples.size(); ++i) {
+            if(*_latest.find(samples[i].id) == i)
+                samples[kept++] = samples[i];
+        }
+
+        auto conflated = samples.size() - kept;
+        samples.resize(kept);
+
+        // drop the oldest states, if there are too many vehicles
+        size_t dropped = 0;
+        if(samples.size() >= _options.maxPending) {
+            dropped = samples.size() - _options.maxPending / 2;
+            samples.erase(samples.begin(), samples.begin() + (long) dropped);
+        }
+
+        _conflated.fetch_add(conflated, std::memory_order_relaxed);
+        _dropped.fetch_add(dropped, std::memory_order_relaxed);
+        _buffered.fetch_sub(conflated + dropped, std::memory_order_relaxed);
+
+    }
+
+
+    Publisher::Clock::time_point Publisher::publish(Clock::time_point now, bool force) {
+
+        auto next = Clock::time_point::max();
+
+        size_t kept = 0;
+        for(size_t k = 0; k < _active.size(); ++k) {
+
+            auto &topic = _topics[_active[k]];
+
+            // publish full batches and due batches
+            while(!topic.samples.empty()) {
+
+                bool due = force || topic.samples.size() >= _options.maxBatch || now >= topic.oldest + _options.linger;
+                if(!due)
+                    break;
+
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if(_inFlight >= _options.maxInFlight)
+                        break;
+
+                    _inFlight++;
+                }
+
+                publishBatch(topic);
+
+            }
+
+            if(topic.samples.empty())
+                continue;
+
+            next = std::min(next, topic.oldest + _options.linger);
+            _active[kept++] = _active[k];
+
+        }
+
+        _active.resize(kept);
+        return next;
+
+    }
+
+
+    void Publisher::publishBatch(Topic &topic) {
+
+        auto n = std::min(topic.samples.size(), _options.maxBatch);
+
+        // serialize
+        _batch.Clear();
+        for(size_t i = 0; i < n; ++i) {
+
+            auto &s = topic.samples[i];
+            auto state = _batch.add_states();
+
+            state->set_id(s.id);
+            state->set_time(s.time);
+            state->set_distance(s.state.s);
+            state->set_velocity(s.state.v);
+            state->set_acceleration(s.state.a);
+
+        }
+
+        std::string payload{};
+        _batch.SerializeToString(&payload);
+
+        topic.samples.erase(topic.samples.begin(), topic.samples.begin() + (long) n);
+        _buffered.fetch_sub(n, std::memory_order_relaxed);
+
+        _transport.publish(topic.name, std::move(payload), [this, n](bool success) {
+
+            if(success) {
+                _published.fetch_add(n, std::memory_order_relaxed);
+                _messages.fetch_add(1, std::memory_order_relaxed);
+            } else
+                _failed.fetch_add(1, std::memory_order_relaxed);
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _inFlight--;
+            }
+
+            _condition.notify_all();
+
+        });
+
+    }
+
+}
@@ -0,0 +1,247 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_PUBLISHER_H
+#define DUMMYPROJECT_PUBLISHER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <memory/FlatHashMap.h>
+#include <parallel/MPSCQueue.h>
+#include <proto/Models.pb.h>
+#include "Transport.h"
+
+namespace telemetry {
+
+
+    /**
+     * @brief Publishes the states of vehicles in batches to a transport (e.g. an MQTT broker).
+     *
+     * Simulation threads push the states into a lock-free queue and never block. An I/O thread collects the states per
+     * topic and publishes them as VehicleStateBatch messages, when a batch is full or its oldest state waited for the
+     * linger time. At most maxInFlight messages are published and not completed at the same time.
+     *
+     * When the transport is slower than the simulation, the states back up in two stages:
+     *
+     * * A topic with maxPending buffered states is downsampled to the latest state of each vehicle (conflation), older
+     *   states are dropped if that is not enough.
+     * * When queueCapacity states are queued and not yet collected by the I/O thread, new states are dropped by push().
+     */
+    class Publisher {
+
+    public:
+
+        //!< The options of the publisher
+        struct Options {
+            std::string topicPrefix = "vehicles";   //!< Prefix of the topics ("<prefix>/<partition>")
+            size_t partitions = 0;                  //!< Number of topics the vehicles are spread over (0: one per vehicle)
+            size_t queueCapacity = 1 << 16;         //!< Maximum number of queued states
+            size_t maxBatch = 256;                  //!< Maximum number of states per message
+            size_t maxPending = 4096;               //!< Maximum number of buffered states per topic
+            size_t maxInFlight = 16;                //!< Maximum number of messages in flight
+            std::chrono::microseconds linger{5000}; //!< Maximum time a state waits for its batch to be filled
+        };
+
+        //!< The counters of the publisher
+        struct Statistics {
+            uint64_t pushed;                        //!< States accepted by push()
+            uint64_t dropped;                       //!< States dropped (queue full or topic overflow)
+            uint64_t conflated;                     //!< States replaced by a newer state of the same vehicle
+            uint64_t published;                     //!< States in completed messages
+            uint64_t messages;                      //!< Completed messages
+            uint64_t failed;                        //!< Failed messages
+        };
+
+
+    protected:
+
+        typedef std::chrono::steady_clock Clock;
+
+        //!< A pushed state
+        struct Sample {
+            uint32_t id;                            //!< ID of the vehicle
+            double time;                            //!< Simulation time
+            models::State state;                    //!< State of the vehicle
+        };
+
+        //!< The buffered states of a topic
+        struct Topic {
+            std::string name;                       //!< Topic
+            std::vector<Sample> samples;            //!< Buffered states
+            Clock::time_point oldest;               //!< Time the oldest buffered state was collected
+        };
+
+        Transport &_transport;                      //!< The transport
+        Options _options;                           //!< The options
+
+        // simulation threads
+        parallel::MPSCQueue<Sample> _queue{};       //!< The queue of pushed states
+        std::atomic<size_t> _queued{0};             //!< The number of queued states
+
+        // I/O thread
+        std::vector<Topic> _topics{};               //!< The topics
+        memory::FlatHashMap<uint32_t, size_t> _topicIndex{};  //!< The index of the topic of a key
+        std::vector<size_t> _active{};              //!< The topics with buffered states
+        memory::FlatHashMap<uint32_t, size_t> _latest{};      //!< Buffer for conflation
+        simulation::models::VehicleStateBatch _batch{};       //!< Buffer for serialization
+        std::atomic<size_t> _buffered{0};           //!< The number of buffered states
+
+        // synchronization
+        std::mutex _mutex{};                        //!< Mutex of the condition
+        std::condition_variable _condition{};       //!< Condition to wake up the I/O thread and flush()
+        size_t _inFlight = 0;                       //!< The number of messages in flight
+        unsigned _flushing = 0;                     //!< The number of waiting flush() calls
+        bool _stop = false;                         //!< Flag to stop the I/O thread
+        std::thread _thread{};                      //!< The I/O thread
+
+        // counters
+        std::atomic<uint64_t> _pushed{0};           //!< @see Statistics
+        std::atomic<uint64_t> _dropped{0};          //!< @see Statistics
+        std::atomic<uint64_t> _conflated{0};        //!< @see Statistics
+        std::atomic<uint64_t> _published{0};        //!< @see Statistics
+        std::atomic<uint64_t> _messages{0};         //!< @see Statistics
+        std::atomic<uint64_t> _failed{0};           //!< @see Statistics
+
+
+    public:
+
+
+        /**
+         * Constructor. Starts the I/O thread with the default options.
+         * @param transport Transport (must outlive the publisher)
+         */
+        explicit Publisher(Transport &transport);
+
+
+        /**
+         * Constructor. Starts the I/O thread.
+         * @param transport Transport (must outlive the publisher)
+         * @param options Options
+         */
+        Publisher(Transport &transport, const Options &options);
+
+
+        /**
+         * Destructor. Publishes the remaining states, @see close()
+         */
+        virtual ~Publisher();
+
+
+        Publisher(const Publisher &) = delete;
+        Publisher &operator=(const Publisher &) = delete;
+
+
+        /**
+         * Pushes the state of a vehicle (any thread, never blocks)
+         * @param id ID of the vehicle
+         * @param time Simulation time
+         * @param state State
+         * @return Flag indicating whether the state was accepted (false: dropped, since the queue is full)
+         */
+        bool push(uint32_t id, double time, const models::State &state) {
+
+            // reserve a place in the queue
+            if(_queued.fetch_add(1, std::memory_order_relaxed) >= _options.queueCapacity) {
+                _queued.fetch_sub(1, std::memory_order_relaxed);
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+
+            _queue.push(Sample{id, time, state});
+            _pushed.fetch_add(1, std::memory_order_relaxed);
+
+            return true;
+
+        }
+
+
+        /**
+         * Publishes the buffered states without waiting for the linger time and waits until all messages are completed
+         */
+        void flush();
+
+
+        /**
+         * Publishes the remaining states, waits for their completion and stops the I/O thread
+         */
+        void close();
+
+
+        /**
+         * Returns the counters
+         * @return Statistics
+         */
+        Statistics statistics() const;
+
+
+    protected:
+
+
+        /**
+         * The loop of the I/O thread
+         */
+        void work();
+
+
+        /**
+         * Moves the queued states to the buffers of their topics
+         * @return Number of collected states
+         */
+        size_t collect();
+
+
+        /**
+         * Adds the state to the buffer of its topic and downsamples the buffer, if full
+         * @param sample State
+         * @param now Actual time
+         */
+        void add(const Sample &sample, Clock::time_point now);
+
+
+        /**
+         * Publishes the full and due batches as long as messages can be in flight
+         * @param now Actual time
+         * @param force Flag to publish all batches without waiting for the linger time
+         * @return Time at which the next batch is due
+         */
+        Clock::time_point publish(Clock::time_point now, bool force);
+
+
+        /**
+         * Publishes one batch of the topic
+         * @param topic Topic
+         */
+        void publishBatch(Topic &topic);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_PUBLISHER_H
@@ -0,0 +1,58 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include "Transport.h"
+
+namespace telemetry {
+
+
+    bool Transport::matches(const std::string &filter, const char *topic) {
+
+        size_t f = 0;
+        while(f < filter.size()) {
+
+            // all remaining levels
+            if(filter[f] == '#')
+                return true;
+
+            // one level
+            if(filter[f] == '+') {
+                while(*topic != '\0' && *topic != '/')
+                    ++topic;
+                ++f;
+                continue;
+            }
+
+            if(*topic == '\0' || filter[f] != *topic)
+                return false;
+
+            ++f;
+            ++topic;
+
+        }
+
+        return *topic == '\0';
+
+    }
+
+}
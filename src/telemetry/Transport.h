@@ -0,0 +1,103 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_TRANSPORT_H
+#define DUMMYPROJECT_TRANSPORT_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+
+namespace telemetry {
+
+
+    /**
+     * @brief The interface of a message transport (e.g. an MQTT client).
+     *
+     * A publish is asynchronous: the transport takes the payload and calls the completion, when the message is delivered
+     * or failed. The completion may be called by any thread (also synchronously by publish()) and must be called exactly
+     * once per message.
+     *
+     * The received messages of a subscription are passed to the handler as pointers into the buffers of the transport,
+     * which are valid during the call only. This way, a message can be decoded without copying it.
+     */
+    class Transport {
+
+    public:
+
+        /**
+         * The completion of a publish
+         * @param success Flag indicating whether the message was delivered
+         */
+        typedef std::function<void(bool success)> Completion;
+
+
+        /**
+         * The handler of a subscription
+         * @param topic Topic of the message (null-terminated)
+         * @param payload Payload of the message
+         * @param size Size of the payload
+         */
+        typedef std::function<void(const char *topic, const char *payload, size_t size)> Handler;
+
+
+        /**
+         * Destructor
+         */
+        virtual ~Transport() = default;
+
+
+        /**
+         * Publishes a message
+         * @param topic Topic
+         * @param payload Payload
+         * @param completion Completion to be called when the message is delivered or failed
+         */
+        virtual void publish(const std::string &topic, std::string &&payload, Completion completion) = 0;
+
+
+        /**
+         * @brief Subscribes to the topics matching the filter.
+         *
+         * The filter is a topic, which may contain the MQTT wildcards "+" (one level) and "#" (all remaining levels).
+         * The handler is called by a thread of the transport, one message at a time.
+         *
+         * @param filter Topic filter
+         * @param handler Handler
+         */
+        virtual void subscribe(const std::string &filter, Handler handler) = 0;
+
+
+        /**
+         * Returns true, if the topic matches the filter (@see subscribe())
+         * @param filter Topic filter
+         * @param topic Topic (null-terminated)
+         * @return Match flag
+         */
+        static bool matches(const std::string &filter, const char *topic);
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_TRANSPORT_H
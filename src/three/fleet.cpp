@@ -0,0 +1,290 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <algorithm>
+#include <cmath>
+#include <LongitudinalModel/LongitudinalFleet.h>
+#include <memory/AlignedAllocator.h>
+#include <proto/PIDBank.h>
+#include "fleet.h"
+
+
+namespace threelib {
+
+
+    //!< A fleet of vehicles with speed controllers
+    struct Fleet {
+
+        FleetMode mode;                              //!< Mode of the fleet
+        double time = 0.0;                           //!< Simulation time
+        models::LongitudinalFleet vehicles{};        //!< Vehicles
+        PIDBank controllers{};                       //!< Speed controllers (closed loop mode only)
+        memory::AlignedVector<double> targets{};     //!< Target speeds (closed loop mode only)
+
+        explicit Fleet(FleetMode mode) : mode(mode) {}
+
+    };
+
+
+    /**
+     * Checks the handle and the range of units
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @return Flag indicating whether the range is valid
+     */
+    static bool valid(const Fleet *fleet, size_t first, size_t n) {
+
+        return fleet != nullptr && first <= fleet->vehicles.size() && n <= fleet->vehicles.size() - first;
+
+    }
+
+
+    Fleet *fleetCreate(size_t n, FleetMode mode) {
+
+        // check
+        if(mode != FLEET_OPEN_LOOP && mode != FLEET_CLOSED_LOOP)
+            return nullptr;
+
+        // exceptions must not pass the C interface
+        try {
+
+            auto fleet = new Fleet(mode);
+
+            fleet->vehicles.reserve(n);
+            for(size_t i = 0; i < n; ++i)
+                fleet->vehicles.add();
+
+            if(mode == FLEET_CLOSED_LOOP) {
+
+                fleet->controllers.reserve(n);
+                for(size_t i = 0; i < n; ++i)
+                    fleet->controllers.add(0.0, 0.0, 0.0);
+
+                fleet->targets.assign(n, 0.0);
+
+            }
+
+            return fleet;
+
+        } catch(...) {
+            return nullptr;
+        }
+
+    }
+
+
+    void fleetDestroy(Fleet *fleet) {
+
+        delete fleet;
+
+    }
+
+
+    size_t fleetSize(const Fleet *fleet) {
+
+        return fleet == nullptr ? 0 : fleet->vehicles.size();
+
+    }
+
+
+    double fleetTime(const Fleet *fleet) {
+
+        return fleet == nullptr ? 0.0 : fleet->time;
+
+    }
+
+
+    int fleetSetVehicleParameters(Fleet *fleet, size_t first, size_t n, const double *mass,
+            const double *maxTorque, const double *airDragParam, const double *rhoAir) {
+
+        // check
+        if(!valid(fleet, first, n))
+            return 1;
+
+        for(size_t i = 0; i < n; ++i) {
+
+            auto parameters = fleet->vehicles.getParameters(first + i);
+
+            if(mass != nullptr)
+                parameters.mass = mass[i];
+            if(maxTorque != nullptr)
+                parameters.maxTorque = maxTorque[i];
+            if(airDragParam != nullptr)
+                parameters.airDragParam = airDragParam[i];
+            if(rhoAir != nullptr)
+                parameters.rhoAir = rhoAir[i];
+
+            fleet->vehicles.setParameters(first + i, parameters);
+
+        }
+
+        return 0;
+
+    }
+
+
+    int fleetSetControllerGains(Fleet *fleet, size_t first, size_t n, const double *kP, const double *kI,
+            const double *kD) {
+
+        // check
+        if(!valid(fleet, first, n) || fleet->mode != FLEET_CLOSED_LOOP)
+            return 1;
+        else if(n != 0 && (kP == nullptr || kI == nullptr || kD == nullptr))
+            return 1;
+
+        for(size_t i = 0; i < n; ++i)
+            fleet->controllers.setParameters(first + i, kP[i], kI[i], kD[i]);
+
+        return 0;
+
+    }
+
+
+    int fleetSetInputs(Fleet *fleet, size_t first, size_t n, const double *inputs) {
+
+        // check
+        if(!valid(fleet, first, n) || (n != 0 && inputs == nullptr))
+            return 1;
+
+        // pedal values or target speeds
+        auto target = fleet->mode == FLEET_CLOSED_LOOP ? fleet->targets.data() : fleet->vehicles.inputs();
+        std::copy(inputs, inputs + n, target + first);
+
+        return 0;
+
+    }
+
+
+    int fleetStep(Fleet *fleet, double timeStepSize, unsigned int steps) {
+
+        // check
+        if(fleet == nullptr || !(timeStepSize > 0.0) || !std::isfinite(timeStepSize))
+            return 1;
+
+        auto n = fleet->vehicles.size();
+        auto pedals = fleet->vehicles.inputs();
+        auto speeds = fleet->vehicles.velocities();
+
+        for(unsigned int k = 0; k < steps; ++k) {
+
+            // closed loop: control error -> controller -> pedal
+            if(fleet->mode == FLEET_CLOSED_LOOP) {
+
+                auto errors = fleet->controllers.inputs();
+                auto targets = fleet->targets.data();
+                for(size_t i = 0; i < n; ++i)
+                    errors[i] = targets[i] - speeds[i];
+
+                fleet->controllers.step(fleet->time, timeStepSize);
+
+                auto outputs = fleet->controllers.outputs();
+                std::copy(outputs, outputs + n, pedals);
+
+            }
+
+            fleet->vehicles.step(timeStepSize);
+            fleet->time += timeStepSize;
+
+        }
+
+        return 0;
+
+    }
+
+
+    int fleetGetStates(const Fleet *fleet, size_t first, size_t n, double *a, double *v, double *s) {
+
+        // check
+        if(!valid(fleet, first, n))
+            return 1;
+
+        if(a != nullptr)
+            std::copy(fleet->vehicles.accelerations() + first, fleet->vehicles.accelerations() + first + n, a);
+        if(v != nullptr)
+            std::copy(fleet->vehicles.velocities() + first, fleet->vehicles.velocities() + first + n, v);
+        if(s != nullptr)
+            std::copy(fleet->vehicles.distances() + first, fleet->vehicles.distances() + first + n, s);
+
+        return 0;
+
+    }
+
+
+    int fleetSetStates(Fleet *fleet, size_t first, size_t n, const double *a, const double *v, const double *s) {
+
+        // check
+        if(!valid(fleet, first, n))
+            return 1;
+
+        for(size_t i = 0; i < n; ++i) {
+
+            auto state = fleet->vehicles.getState(first + i);
+
+            if(a != nullptr)
+                state.a = a[i];
+            if(v != nullptr)
+                state.v = v[i];
+            if(s != nullptr)
+                state.s = s[i];
+
+            fleet->vehicles.setState(first + i, state);
+
+        }
+
+        return 0;
+
+    }
+
+
+    int fleetGetPedals(const Fleet *fleet, size_t first, size_t n, double *pedals) {
+
+        // check
+        if(!valid(fleet, first, n) || (n != 0 && pedals == nullptr))
+            return 1;
+
+        auto inputs = fleet->vehicles.inputs();
+        std::copy(inputs + first, inputs + first + n, pedals);
+
+        return 0;
+
+    }
+
+
+    int fleetReset(Fleet *fleet) {
+
+        // check
+        if(fleet == nullptr)
+            return 1;
+
+        for(size_t i = 0; i < fleet->vehicles.size(); ++i)
+            fleet->vehicles.setState(i, models::State{});
+
+        fleet->controllers.reset();
+        fleet->time = 0.0;
+
+        return 0;
+
+    }
+
+}
@@ -0,0 +1,200 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+/**
+ * @file fleet.h
+ *
+ * C interface to simulate fleets of vehicles (@see models::LongitudinalFleet) with speed controllers (@see PIDBank)
+ *
+ * A fleet is created with a number of units and is referenced by an opaque handle. The inputs are set and the states
+ * are read for ranges of units from and into arrays of the caller, so thousands of units are stepped per call without
+ * any marshalling per unit. Stepping a fleet does not allocate memory. The functions of one fleet must not be called
+ * concurrently. The header can be included from C and C++.
+ *
+ */
+
+
+#ifndef DUMMYPROJECT_FLEET_H
+#define DUMMYPROJECT_FLEET_H
+
+#include "three.h"
+
+
+#ifdef __cplusplus
+extern "C" {
+
+namespace threelib {
+#endif
+
+    /** Opaque handle of a fleet */
+    typedef struct Fleet Fleet;
+
+
+    /** Mode of a fleet */
+    typedef enum FleetMode {
+        FLEET_OPEN_LOOP = 0,    /**< The inputs are the pedal values of the vehicles */
+        FLEET_CLOSED_LOOP = 1   /**< The inputs are the target speeds of the PID speed controllers */
+    } FleetMode;
+
+
+    /**
+     * Creates a fleet of vehicles with the default parameters at standstill. In closed loop mode, the gains of the
+     * controllers are zero and must be set (@see fleetSetControllerGains()).
+     * @param n Number of units
+     * @param mode Mode of the fleet
+     * @return Handle of the fleet (NULL, if the fleet could not be created)
+     */
+    SHARED_EXPORT Fleet *fleetCreate(size_t n, FleetMode mode);
+
+
+    /**
+     * Destroys the fleet
+     * @param fleet Handle of the fleet (NULL is ignored)
+     */
+    SHARED_EXPORT void fleetDestroy(Fleet *fleet);
+
+
+    /**
+     * Returns the number of units of the fleet
+     * @param fleet Handle of the fleet
+     * @return Number of units (0 for an invalid handle)
+     */
+    SHARED_EXPORT size_t fleetSize(const Fleet *fleet);
+
+
+    /**
+     * Returns the simulation time of the fleet (the sum of the stepped time step sizes since the last reset)
+     * @param fleet Handle of the fleet
+     * @return Simulation time
+     */
+    SHARED_EXPORT double fleetTime(const Fleet *fleet);
+
+
+    /**
+     * Sets the parameters of the vehicles first, ..., first + n - 1. Arrays passed as NULL are not changed.
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @param mass Masses in kg
+     * @param maxTorque Maximum torques in Nm
+     * @param airDragParam Air drag coefficients
+     * @param rhoAir Air densities in kg/m^3
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetSetVehicleParameters(Fleet *fleet, size_t first, size_t n, const double *mass,
+            const double *maxTorque, const double *airDragParam, const double *rhoAir);
+
+
+    /**
+     * Sets the gains of the speed controllers of the units first, ..., first + n - 1
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @param kP Proportional gains
+     * @param kI Integral gains
+     * @param kD Derivative gains
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetSetControllerGains(Fleet *fleet, size_t first, size_t n, const double *kP,
+            const double *kI, const double *kD);
+
+
+    /**
+     * Sets the inputs of the units first, ..., first + n - 1, which are the pedal values in open loop mode and the
+     * target speeds in m/s in closed loop mode. The inputs are kept until they are set again.
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @param inputs Inputs
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetSetInputs(Fleet *fleet, size_t first, size_t n, const double *inputs);
+
+
+    /**
+     * Steps all units of the fleet
+     * @param fleet Handle of the fleet
+     * @param timeStepSize Time step size in s
+     * @param steps Number of steps
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetStep(Fleet *fleet, double timeStepSize, unsigned int steps);
+
+
+    /**
+     * Copies the states of the vehicles first, ..., first + n - 1 into the given arrays. Arrays passed as NULL are
+     * skipped.
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @param a Accelerations in m/s^2 (output)
+     * @param v Velocities in m/s (output)
+     * @param s Distances in m (output)
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetGetStates(const Fleet *fleet, size_t first, size_t n, double *a, double *v, double *s);
+
+
+    /**
+     * Sets the states of the vehicles first, ..., first + n - 1. Arrays passed as NULL are not changed.
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @param a Accelerations in m/s^2
+     * @param v Velocities in m/s
+     * @param s Distances in m
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetSetStates(Fleet *fleet, size_t first, size_t n, const double *a, const double *v,
+            const double *s);
+
+
+    /**
+     * Copies the pedal values of the last step of the vehicles first, ..., first + n - 1 (the outputs of the
+     * controllers in closed loop mode)
+     * @param fleet Handle of the fleet
+     * @param first Index of the first unit
+     * @param n Number of units
+     * @param pedals Pedal values (output)
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetGetPedals(const Fleet *fleet, size_t first, size_t n, double *pedals);
+
+
+    /**
+     * Resets the fleet: the vehicles are at standstill, the controllers are reset and the time is zero. Parameters,
+     * gains and inputs are kept.
+     * @param fleet Handle of the fleet
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int fleetReset(Fleet *fleet);
+
+
+#ifdef __cplusplus
+} // namespace threelib
+
+}
+#endif
+
+
+#endif //DUMMYPROJECT_FLEET_H
@@ -22,10 +22,172 @@
 //
 
 
+#include <memory>
+#include <parallel/ThreadPool.h>
 #include "three.h"
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define THREELIB_X86_SIMD
+#include <immintrin.h>
+#endif
+
 namespace threelib {
 
+
+    // thread pool of the batched operations (nullptr = serial execution)
+    static std::unique_ptr<parallel::ThreadPool> pool{};
+
+    // minimum number of elements to be processed in parallel
+    static size_t parallelThreshold = (size_t) 1 << 18;
+
+
+    /**
+     * Executes the kernel for the index range [0, n), split over the thread pool for large arrays
+     * @param n Number of values
+     * @param kernel Kernel to be called with the begin and end index of a range
+     */
+    template<typename Kernel>
+    static void run(size_t n, const Kernel &kernel) {
+
+        if(pool == nullptr || n < parallelThreshold)
+            kernel(0, n);
+        else
+            pool->parallelFor(n, kernel);
+
+    }
+
+
+    //!< Returns the address of the i-th value with the given stride
+    template<typename T>
+    static T *at(T *a, size_t i, ptrdiff_t stride) {
+
+        return a + (ptrdiff_t) i * stride;
+
+    }
+
+
+    /**
+     * Scalar kernels of the contiguous operations
+     */
+    static void addScalar(double *a, double b, size_t begin, size_t end) {
+
+        for(size_t i = begin; i < end; ++i)
+            a[i] += b;
+
+    }
+
+    static void scaleScalar(double *a, double b, size_t begin, size_t end) {
+
+        for(size_t i = begin; i < end; ++i)
+            a[i] *= b;
+
+    }
+
+    static void axpyScalar(double *y, const double *x, double alpha, size_t begin, size_t end) {
+
+        for(size_t i = begin; i < end; ++i)
+            y[i] += alpha * x[i];
+
+    }
+
+
+#ifdef THREELIB_X86_SIMD
+
+    /**
+     * AVX2 kernels of the contiguous operations (four values per instruction), same results as the scalar kernels
+     */
+    __attribute__((target("avx2")))
+    static void addAVX2(double *a, double b, size_t begin, size_t end) {
+
+        const __m256d vb = _mm256_set1_pd(b);
+
+        size_t i = begin;
+        for(; i + 4 <= end; i += 4)
+            _mm256_storeu_pd(a + i, _mm256_add_pd(_mm256_loadu_pd(a + i), vb));
+
+        addScalar(a, b, i, end);
+
+    }
+
+    __attribute__((target("avx2")))
+    static void scaleAVX2(double *a, double b, size_t begin, size_t end) {
+
+        const __m256d vb = _mm256_set1_pd(b);
+
+        size_t i = begin;
+        for(; i + 4 <= end; i += 4)
+            _mm256_storeu_pd(a + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), vb));
+
+        scaleScalar(a, b, i, end);
+
+    }
+
+    __attribute__((target("avx2")))
+    static void axpyAVX2(double *y, const double *x, double alpha, size_t begin, size_t end) {
+
+        const __m256d va = _mm256_set1_pd(alpha);
+
+        size_t i = begin;
+        for(; i + 4 <= end; i += 4) {
+            __m256d ax = _mm256_mul_pd(va, _mm256_loadu_pd(x + i));
+            _mm256_storeu_pd(y + i, _mm256_add_pd(_mm256_loadu_pd(y + i), ax));
+        }
+
+        axpyScalar(y, x, alpha, i, end);
+
+    }
+
+
+    // the CPU check must be initialized, since the library may be loaded before the runtime initialized it
+    static bool supportsAVX2() {
+
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2");
+
+    }
+
+    static const bool AVX2 = supportsAVX2();
+
+#endif
+
+
+    /**
+     * Kernels of the contiguous operations, selected by the CPU support
+     */
+    static void addKernel(double *a, double b, size_t begin, size_t end) {
+
+#ifdef THREELIB_X86_SIMD
+        if(AVX2)
+            return addAVX2(a, b, begin, end);
+#endif
+
+        addScalar(a, b, begin, end);
+
+    }
+
+    static void scaleKernel(double *a, double b, size_t begin, size_t end) {
+
+#ifdef THREELIB_X86_SIMD
+        if(AVX2)
+            return scaleAVX2(a, b, begin, end);
+#endif
+
+        scaleScalar(a, b, begin, end);
+
+    }
+
+    static void axpyKernel(double *y, const double *x, double alpha, size_t begin, size_t end) {
+
+#ifdef THREELIB_X86_SIMD
+        if(AVX2)
+            return axpyAVX2(y, x, alpha, begin, end);
+#endif
+
+        axpyScalar(y, x, alpha, begin, end);
+
+    }
+
+
     int add(double *a, double b) {
 
         // check
@@ -39,4 +201,121 @@ namespace threelib {
 
     }
 
+
+
+    unsigned int abiVersion(void) {
+
+        return ((unsigned int) THREELIB_ABI_VERSION_MAJOR << 16) | (unsigned int) THREELIB_ABI_VERSION_MINOR;
+
+    }
+
+
+    int setThreads(size_t threads, size_t threshold) {
+
+        // exceptions must not pass the C interface
+        try {
+            pool.reset(threads == 1 ? nullptr : new parallel::ThreadPool(threads));
+        } catch(...) {
+            return 1;
+        }
+
+        parallelThreshold = threshold;
+
+        return 0;
+
+    }
+
+
+    int addArray(double *a, size_t n, double b) {
+
+        // check
+        if(a == nullptr)
+            return 1;
+
+        // operation
+        run(n, [a, b](size_t begin, size_t end) { addKernel(a, b, begin, end); });
+
+        return 0;
+
+    }
+
+
+    int addStrided(double *a, size_t n, ptrdiff_t stride, double b) {
+
+        // check
+        if(a == nullptr || stride == 0)
+            return 1;
+
+        // operation
+        run(n, [a, stride, b](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+                *at(a, i, stride) += b;
+        });
+
+        return 0;
+
+    }
+
+
+    int scaleArray(double *a, size_t n, double b) {
+
+        // check
+        if(a == nullptr)
+            return 1;
+
+        // operation
+        run(n, [a, b](size_t begin, size_t end) { scaleKernel(a, b, begin, end); });
+
+        return 0;
+
+    }
+
+
+    int scaleStrided(double *a, size_t n, ptrdiff_t stride, double b) {
+
+        // check
+        if(a == nullptr || stride == 0)
+            return 1;
+
+        // operation
+        run(n, [a, stride, b](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+                *at(a, i, stride) *= b;
+        });
+
+        return 0;
+
+    }
+
+
+    int axpyArray(double *y, const double *x, size_t n, double alpha) {
+
+        // check
+        if(y == nullptr || x == nullptr)
+            return 1;
+
+        // operation
+        run(n, [y, x, alpha](size_t begin, size_t end) { axpyKernel(y, x, alpha, begin, end); });
+
+        return 0;
+
+    }
+
+
+    int axpyStrided(double *y, const double *x, size_t n, ptrdiff_t strideY, ptrdiff_t strideX, double alpha) {
+
+        // check
+        if(y == nullptr || x == nullptr || strideY == 0)
+            return 1;
+
+        // operation
+        run(n, [y, x, strideY, strideX, alpha](size_t begin, size_t end) {
+            for(size_t i = begin; i < end; ++i)
+                *at(y, i, strideY) += alpha * *at(x, i, strideX);
+        });
+
+        return 0;
+
+    }
+
 }
\ No newline at end of file
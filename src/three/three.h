@@ -27,6 +27,11 @@
  *
  * This file demonstrates how to create a shared lib file
  *
+ * Besides the scalar operation, the library provides batched operations on arrays of values for hosts calling through
+ * the C ABI (e.g. Python or MATLAB wrappers), which process a whole array per call. Contiguous arrays are processed
+ * with SIMD instructions (if supported by the CPU) and large arrays are split over a thread pool (@see setThreads()).
+ * The header can be included from C and C++. The simulation of vehicle fleets is declared in fleet.h.
+ *
  */
 
 
@@ -44,10 +49,21 @@
     #define SHARED_EXPORT
 #endif
 
+#include <stddef.h>
+
+
+/** Major version of the C ABI, which is increased on incompatible changes */
+#define THREELIB_ABI_VERSION_MAJOR 1
 
+/** Minor version of the C ABI, which is increased when functions are added */
+#define THREELIB_ABI_VERSION_MINOR 2
+
+
+#ifdef __cplusplus
 extern "C" {
 
 namespace threelib {
+#endif
 
     /**
      * Adds the value b to the value a
@@ -58,9 +74,97 @@ namespace threelib {
     SHARED_EXPORT int add(double *a, double b);
 
 
+    /**
+     * Returns the version of the C ABI of the loaded library. A host built against the major version M and minor
+     * version m can use the library, if the major version equals M and the minor version is at least m.
+     * @return Version (major version in the upper 16 bits, minor version in the lower 16 bits)
+     */
+    SHARED_EXPORT unsigned int abiVersion(void);
+
+
+    /**
+     * Sets the number of threads of the batched operations. Arrays with at least the given number of elements are
+     * split over the threads. The function must not be called concurrently with the batched operations.
+     * @param threads Number of threads including the calling thread (0 = number of hardware threads, 1 = serial)
+     * @param threshold Minimum number of elements to be processed in parallel
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int setThreads(size_t threads, size_t threshold);
+
+
+    /**
+     * Adds the value b to all n values of the array a
+     * @param a A pointer to the array, the value b will be added to. a will be overwritten.
+     * @param n Number of values
+     * @param b The value added to the values of a.
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int addArray(double *a, size_t n, double b);
+
+
+    /**
+     * Adds the value b to n values of the array a with the given stride (a[0], a[stride], ..., a[(n - 1) * stride])
+     * @param a A pointer to the first value, the value b will be added to. a will be overwritten.
+     * @param n Number of values
+     * @param stride Distance between two values in elements (must not be zero, negative strides go backwards)
+     * @param b The value added to the values of a.
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int addStrided(double *a, size_t n, ptrdiff_t stride, double b);
+
+
+    /**
+     * Multiplies all n values of the array a with the value b
+     * @param a A pointer to the array to be scaled. a will be overwritten.
+     * @param n Number of values
+     * @param b The factor.
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int scaleArray(double *a, size_t n, double b);
+
+
+    /**
+     * Multiplies n values of the array a with the given stride with the value b (@see addStrided())
+     * @param a A pointer to the first value to be scaled. a will be overwritten.
+     * @param n Number of values
+     * @param stride Distance between two values in elements (must not be zero)
+     * @param b The factor.
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int scaleStrided(double *a, size_t n, ptrdiff_t stride, double b);
+
+
+    /**
+     * Adds the array x multiplied by alpha to the array y (y = alpha * x + y)
+     * @param y A pointer to the array, the scaled values of x will be added to. y will be overwritten.
+     * @param x A pointer to the array to be added (must not overlap with y, unless it is the same array).
+     * @param n Number of values
+     * @param alpha The factor of x.
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int axpyArray(double *y, const double *x, size_t n, double alpha);
+
+
+    /**
+     * Adds n values of the array x multiplied by alpha to n values of the array y with the given strides
+     * (y[i * strideY] += alpha * x[i * strideX])
+     * @param y A pointer to the first value, the scaled values of x will be added to. y will be overwritten.
+     * @param x A pointer to the first value to be added.
+     * @param n Number of values
+     * @param strideY Distance between two values of y in elements (must not be zero)
+     * @param strideX Distance between two values of x in elements
+     * @param alpha The factor of x.
+     * @return Error code (0 = no error, 1 = an error)
+     */
+    SHARED_EXPORT int axpyStrided(double *y, const double *x, size_t n, ptrdiff_t strideY, ptrdiff_t strideX,
+            double alpha);
+
+
+#ifdef __cplusplus
 } // namespace threelib
 
 }
+#endif
 
 
 #endif //DUMMYPROJECT_THREE_H
@@ -0,0 +1,214 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <cstring>
+#include <stdexcept>
+#include "Reader.h"
+
+#ifdef TRACE_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+namespace trace {
+
+
+    Reader::Reader(const std::string &path) : _file(path) {
+
+        auto data = _file.data();
+        auto size = _file.size();
+
+        // header and trailer
+        file::Header header{};
+        file::Trailer trailer{};
+
+        if(size < sizeof(header) + sizeof(trailer))
+            throw std::runtime_error("Trace file " + path + " is truncated or was not closed.");
+
+        std::memcpy(&header, data, sizeof(header));
+        std::memcpy(&trailer, data + size - sizeof(trailer), sizeof(trailer));
+
+        if(std::memcmp(header.magic, file::MAGIC, 4) != 0 || header.version != file::VERSION)
+            throw std::runtime_error("File " + path + " is not a trace file of version "
+                    + std::to_string(file::VERSION) + ".");
+
+        if(std::memcmp(trailer.magic, file::MAGIC, 4) != 0 || trailer.version != file::VERSION
+                || trailer.indexOffset + trailer.indexSize + sizeof(trailer) != size)
+            throw std::runtime_error("Trace file " + path + " is truncated or was not closed.");
+
+        // index
+        auto position = trailer.indexOffset;
+        auto read = [&](void *target, size_t n) {
+
+            if(position + n > trailer.indexOffset + trailer.indexSize)
+                throw std::runtime_error("Trace file " + path + " is corrupted.");
+
+            std::memcpy(target, data + position, n);
+            position += n;
+
+        };
+
+        uint64_t signals = 0;
+        read(&signals, sizeof(signals));
+
+        for(uint64_t i = 0; i < signals; ++i) {
+
+            uint32_t length = 0;
+            read(&length, sizeof(length));
+
+            std::string name(length, '\0');
+            read(&name[0], length);
+
+            _names.push_back(std::move(name));
+
+        }
+
+        uint64_t chunks = 0;
+        read(&chunks, sizeof(chunks));
+
+        if(chunks > trailer.indexSize / sizeof(file::ChunkEntry))
+            throw std::runtime_error("Trace file " + path + " is corrupted.");
+
+        _chunks.resize(chunks);
+        read(_chunks.data(), chunks * sizeof(file::ChunkEntry));
+
+        // chunks per signal (written in the order of time)
+        _signalChunks.resize(signals);
+        for(size_t k = 0; k < _chunks.size(); ++k) {
+
+            auto &c = _chunks[k];
+            if(c.signal >= signals || c.offset + c.storedSize > trailer.indexOffset)
+                throw std::runtime_error("Trace file " + path + " is corrupted.");
+
+            _signalChunks[c.signal].push_back(k);
+
+        }
+
+#ifdef TRACE_WITH_ZLIB
+        _inflate.reset(new z_stream{}, [](z_stream *stream) {
+            inflateEnd(stream);
+            delete stream;
+        });
+
+        if(inflateInit(_inflate.get()) != Z_OK)
+            throw std::runtime_error("Decompression could not be initialized.");
+#endif
+
+    }
+
+
+    size_t Reader::size() const {
+
+        return _names.size();
+
+    }
+
+
+    const std::string &Reader::name(uint32_t signal) const {
+
+        return _names.at(signal);
+
+    }
+
+
+    uint32_t Reader::find(const std::string &name) const {
+
+        for(size_t i = 0; i < _names.size(); ++i) {
+            if(_names[i] == name)
+                return (uint32_t) i;
+        }
+
+        throw std::out_of_range("Signal " + name + " does not exist.");
+
+    }
+
+
+    uint64_t Reader::samples(uint32_t signal) const {
+
+        uint64_t n = 0;
+        for(auto k : _signalChunks.at(signal))
+            n += _chunks[k].samples;
+
+        return n;
+
+    }
+
+
+    void Reader::forEachChunk(uint32_t signal, const ChunkFunction &function) const {
+
+        for(auto k : _signalChunks.at(signal)) {
+
+            auto &c = _chunks[k];
+            auto n = (size_t) c.samples;
+            auto stored = _file.data() + c.offset;
+
+            if(c.compression == (uint32_t) Compression::NONE) {
+
+                if(c.storedSize != 2 * n * sizeof(double))
+                    throw std::runtime_error("Trace chunk is corrupted.");
+
+                // chunks are aligned to 8 bytes
+                auto times = reinterpret_cast<const double *>(stored);
+                function(times, times + n, n);
+
+            } else if(c.compression == (uint32_t) Compression::ZLIB) {
+
+#ifdef TRACE_WITH_ZLIB
+                _buffer.resize(2 * n);
+
+                _inflate->next_in = reinterpret_cast<Bytef *>(const_cast<char *>(stored));
+                _inflate->avail_in = (uInt) c.storedSize;
+                _inflate->next_out = reinterpret_cast<Bytef *>(_buffer.data());
+                _inflate->avail_out = (uInt) (2 * n * sizeof(double));
+
+                auto result = inflate(_inflate.get(), Z_FINISH);
+                auto remaining = _inflate->avail_out;
+
+                if(inflateReset(_inflate.get()) != Z_OK || result != Z_STREAM_END || remaining != 0)
+                    throw std::runtime_error("Trace chunk could not be decompressed.");
+
+                function(_buffer.data(), _buffer.data() + n, n);
+#else
+                throw std::runtime_error("Compression is not supported by the build.");
+#endif
+
+            } else
+                throw std::runtime_error("Trace chunk has an unknown compression.");
+
+        }
+
+    }
+
+
+    void Reader::read(uint32_t signal, std::vector<double> &times, std::vector<double> &values) const {
+
+        times.clear();
+        values.clear();
+
+        forEachChunk(signal, [&times, &values](const double *t, const double *v, size_t n) {
+            times.insert(times.end(), t, t + n);
+            values.insert(values.end(), v, v + n);
+        });
+
+    }
+
+}
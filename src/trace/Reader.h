@@ -0,0 +1,131 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_READER_H
+#define DUMMYPROJECT_READER_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include <memory/MappedFile.h>
+#include "TraceFile.h"
+
+struct z_stream_s;
+
+namespace trace {
+
+
+    /**
+     * @brief Reads a trace file written by the recorder (@see Recorder).
+     *
+     * The file is memory-mapped and only the index is read on construction. The samples of a signal are read chunk by
+     * chunk, so only the pages of the chunks of the signal are touched. Uncompressed chunks are passed directly from the
+     * mapped pages without copying. A reader shall be used by one thread at a time.
+     */
+    class Reader {
+
+    public:
+
+        /**
+         * The function called for each chunk of a signal
+         * @param times Times of the samples
+         * @param values Values of the samples
+         * @param n Number of samples
+         */
+        typedef std::function<void(const double *times, const double *values, size_t n)> ChunkFunction;
+
+
+    protected:
+
+        memory::MappedFile _file;                           //!< The mapped file
+        std::vector<std::string> _names{};                  //!< The names of the signals
+        std::vector<file::ChunkEntry> _chunks{};            //!< The index of the chunks
+        std::vector<std::vector<size_t>> _signalChunks{};   //!< The chunks of each signal in the order of time
+        mutable std::vector<double> _buffer{};              //!< Buffer for decompressed chunks
+        std::shared_ptr<z_stream_s> _inflate{};             //!< The decompression stream (reused for all chunks)
+
+
+    public:
+
+
+        /**
+         * Constructor. Maps the file and reads the index.
+         * @param path Path of the file
+         */
+        explicit Reader(const std::string &path);
+
+
+        /**
+         * Returns the number of signals
+         * @return Number of signals
+         */
+        size_t size() const;
+
+
+        /**
+         * Returns the name of a signal
+         * @param signal Index of the signal
+         * @return Name
+         */
+        const std::string &name(uint32_t signal) const;
+
+
+        /**
+         * Returns the index of the signal with the given name
+         * @param name Name of the signal
+         * @return Index of the signal
+         */
+        uint32_t find(const std::string &name) const;
+
+
+        /**
+         * Returns the number of samples of a signal
+         * @param signal Index of the signal
+         * @return Number of samples
+         */
+        uint64_t samples(uint32_t signal) const;
+
+
+        /**
+         * Calls the function for each chunk of a signal in the order of time. The arrays are only valid during the call.
+         * @param signal Index of the signal
+         * @param function Function
+         */
+        void forEachChunk(uint32_t signal, const ChunkFunction &function) const;
+
+
+        /**
+         * Reads all samples of a signal
+         * @param signal Index of the signal
+         * @param times Times to be filled
+         * @param values Values to be filled
+         */
+        void read(uint32_t signal, std::vector<double> &times, std::vector<double> &values) const;
+
+    };
+
+}
+
+#endif //DUMMYPROJECT_READER_H
@@ -0,0 +1,343 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <cstring>
+#include "Recorder.h"
+
+#ifdef TRACE_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+namespace trace {
+
+
+    //!< Counter to give each recorder a unique ID
+    static std::atomic<uint64_t> recorderCounter{0};
+
+
+    Recorder::Recorder(const std::string &path) : Recorder(path, Options{}) {}
+
+
+    Recorder::Recorder(const std::string &path, const Options &options)
+            : _options(options), _uid(++recorderCounter),
+              _stream(path, std::ios::out | std::ios::binary | std::ios::trunc), _path(path) {
+
+        if(!isSupported(options.compression))
+            throw std::invalid_argument("Compression is not supported by the build.");
+
+        if(options.blockSamples == 0)
+            throw std::invalid_argument("Block size must be positive.");
+
+        if(options.ringCapacity < 2 || (options.ringCapacity & (options.ringCapacity - 1)) != 0)
+            throw std::invalid_argument("Ring capacity must be a power of two of at least 2.");
+
+        if(!_stream)
+            throw std::runtime_error("Trace file " + path + " could not be created.");
+
+#ifdef TRACE_WITH_ZLIB
+        if(options.compression == Compression::ZLIB) {
+
+            _deflate.reset(new z_stream{}, [](z_stream *stream) {
+                deflateEnd(stream);
+                delete stream;
+            });
+
+            if(deflateInit(_deflate.get(), options.compressionLevel) != Z_OK)
+                throw std::invalid_argument("Compression level is not supported.");
+
+        }
+#endif
+
+        // header
+        file::Header header{{file::MAGIC[0], file::MAGIC[1], file::MAGIC[2], file::MAGIC[3]}, file::VERSION};
+        write(&header, sizeof(header));
+
+        // start background thread
+        _thread = std::thread(&Recorder::work, this);
+
+    }
+
+
+    Recorder::~Recorder() {
+
+        try {
+            close();
+        } catch(...) {
+            // errors can only be handled by calling close()
+        }
+
+    }
+
+
+    Signal Recorder::addSignal(const std::string &name) {
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if(_closed)
+            throw std::logic_error("Recorder is closed.");
+
+        _names.push_back(name);
+        _signals.store((uint32_t) _names.size(), std::memory_order_release);
+
+        return Signal(this, (uint32_t) (_names.size() - 1));
+
+    }
+
+
+    void Recorder::close() {
+
+        // stop background thread
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if(_closed)
+                return;
+
+            _closed = true;
+            _stop = true;
+        }
+
+        _condition.notify_one();
+        _thread.join();
+
+        if(_exception)
+            std::rethrow_exception(_exception);
+
+        // index
+        auto indexOffset = _position;
+
+        auto signals = (uint64_t) _names.size();
+        write(&signals, sizeof(signals));
+        for(auto &name : _names) {
+            auto length = (uint32_t) name.size();
+            write(&length, sizeof(length));
+            write(name.data(), length);
+        }
+
+        auto chunks = (uint64_t) _chunks.size();
+        write(&chunks, sizeof(chunks));
+        write(_chunks.data(), _chunks.size() * sizeof(file::ChunkEntry));
+
+        // trailer
+        file::Trailer trailer{indexOffset, _position - indexOffset,
+                {file::MAGIC[0], file::MAGIC[1], file::MAGIC[2], file::MAGIC[3]}, file::VERSION};
+        write(&trailer, sizeof(trailer));
+
+        _stream.close();
+        if(!_stream)
+            throw std::runtime_error("Trace file " + _path + " could not be written.");
+
+    }
+
+
+    size_t Recorder::signals() const {
+
+        return _signals.load(std::memory_order_acquire);
+
+    }
+
+
+    uint64_t Recorder::written() const {
+
+        return _written.load(std::memory_order_acquire);
+
+    }
+
+
+    uint64_t Recorder::stalls() const {
+
+        return _stalls.load(std::memory_order_relaxed);
+
+    }
+
+
+    uint64_t Recorder::dropped() const {
+
+        return _dropped.load(std::memory_order_relaxed);
+
+    }
+
+
+    bool Recorder::isSupported(Compression compression) {
+
+#ifdef TRACE_WITH_ZLIB
+        return compression == Compression::NONE || compression == Compression::ZLIB;
+#else
+        return compression == Compression::NONE;
+#endif
+
+    }
+
+
+    Recorder::Ring *Recorder::createRing() {
+
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        if(_closed)
+            throw std::logic_error("Recorder is closed.");
+
+        auto &ring = _rings[std::this_thread::get_id()];
+        if(!ring)
+            ring.reset(new Ring(_options.ringCapacity));
+
+        return ring.get();
+
+    }
+
+
+    void Recorder::work() {
+
+        try {
+
+            std::unique_lock<std::mutex> lock(_mutex);
+            while(!_stop) {
+
+                // a wake-up between the check and the wait is handled in the next interval
+                _condition.wait_for(lock, _options.flushInterval, [this] {
+                    return _stop || _wakeup.exchange(false, std::memory_order_acquire);
+                });
+
+                lock.unlock();
+                drain();
+                lock.lock();
+
+            }
+
+            lock.unlock();
+
+            // remaining samples
+            drain();
+            writeBlock();
+
+        } catch(...) {
+            _exception = std::current_exception();
+            _failed.store(true, std::memory_order_release);
+        }
+
+    }
+
+
+    void Recorder::drain() {
+
+        // rings and signals registered so far
+        std::vector<Ring *> rings{};
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            for(auto &e : _rings)
+                rings.push_back(e.second.get());
+
+            _columns.resize(_names.size());
+        }
+
+        for(auto ring : rings) {
+
+            _buffered += ring->consume([this](const Sample &sample) {
+
+                // signal registered after the resize
+                if(sample.signal >= _columns.size())
+                    _columns.resize(sample.signal + 1);
+
+                auto &column = _columns[sample.signal];
+                column.times.push_back(sample.time);
+                column.values.push_back(sample.value);
+
+            });
+
+            if(_buffered >= _options.blockSamples)
+                writeBlock();
+
+        }
+
+    }
+
+
+    void Recorder::writeBlock() {
+
+        for(uint32_t signal = 0; signal < _columns.size(); ++signal) {
+
+            auto &column = _columns[signal];
+            auto n = column.times.size();
+            if(n == 0)
+                continue;
+
+            // align chunk to 8 bytes, so the arrays can be used directly from a mapped file
+            static const char zeros[8] = {};
+            write(zeros, (8 - _position % 8) % 8);
+
+            file::ChunkEntry entry{signal, (uint32_t) _options.compression, _position, 2 * n * sizeof(double), n,
+                    column.times.front(), column.times.back()};
+
+            if(_options.compression == Compression::NONE) {
+
+                write(column.times.data(), n * sizeof(double));
+                write(column.values.data(), n * sizeof(double));
+
+            } else {
+
+#ifdef TRACE_WITH_ZLIB
+                // times and values in one stream
+                _raw.resize(2 * n * sizeof(double));
+                std::memcpy(_raw.data(), column.times.data(), n * sizeof(double));
+                std::memcpy(_raw.data() + n * sizeof(double), column.values.data(), n * sizeof(double));
+
+                // the stream is reset instead of initialized per chunk
+                _compressed.resize(deflateBound(_deflate.get(), (uLong) _raw.size()));
+
+                _deflate->next_in = reinterpret_cast<Bytef *>(_raw.data());
+                _deflate->avail_in = (uInt) _raw.size();
+                _deflate->next_out = reinterpret_cast<Bytef *>(_compressed.data());
+                _deflate->avail_out = (uInt) _compressed.size();
+
+                if(deflate(_deflate.get(), Z_FINISH) != Z_STREAM_END || deflateReset(_deflate.get()) != Z_OK)
+                    throw std::runtime_error("Trace chunk could not be compressed.");
+
+                auto stored = _compressed.size() - _deflate->avail_out;
+                entry.storedSize = stored;
+                write(_compressed.data(), stored);
+#endif
+
+            }
+
+            _chunks.push_back(entry);
+            _written.fetch_add(n, std::memory_order_release);
+
+            column.times.clear();
+            column.values.clear();
+
+        }
+
+        _buffered = 0;
+
+    }
+
+
+    void Recorder::write(const void *data, size_t n) {
+
+        _stream.write(reinterpret_cast<const char *>(data), (std::streamsize) n);
+        if(!_stream)
+            throw std::runtime_error("Trace file " + _path + " could not be written.");
+
+        _position += n;
+
+    }
+
+}
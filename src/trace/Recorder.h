@@ -0,0 +1,365 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_RECORDER_H
+#define DUMMYPROJECT_RECORDER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <parallel/SPSCQueue.h>
+#include "TraceFile.h"
+
+struct z_stream_s;
+
+namespace trace {
+
+
+    class Recorder;
+
+
+    /**
+     * A handle of a registered signal, @see Recorder::addSignal()
+     */
+    class Signal {
+
+        Recorder *_recorder = nullptr;              //!< The recorder
+        uint32_t _id = 0;                           //!< The index of the signal
+
+
+    public:
+
+        Signal() = default;
+
+        Signal(Recorder *recorder, uint32_t id) : _recorder(recorder), _id(id) {}
+
+
+        /**
+         * Returns the index of the signal
+         * @return Index
+         */
+        uint32_t id() const {
+
+            return _id;
+
+        }
+
+
+        /**
+         * Records a sample of the signal, @see Recorder::record()
+         * @param time Simulation time
+         * @param value Value
+         */
+        inline void record(double time, double value) const;
+
+    };
+
+
+    /**
+     * @brief Records samples of signals into a columnar trace file (@see file).
+     *
+     * Models register their signals once and record samples in their step. A sample is pushed into a lock-free ring
+     * buffer of the recording thread, so recording neither locks nor allocates. A background thread drains the rings
+     * periodically, collects the samples per signal and, when a block of samples is buffered, writes one chunk per
+     * signal to the file (optionally compressed). Each time a recording thread has pushed half a ring of samples, it
+     * wakes up the background thread before the flush interval elapses (high-water mark), so a ring sized for the load
+     * never fills up. The default ring holds 2^18 samples, which covers 10k signals at 1 kHz (100k samples per flush
+     * interval) with the high-water mark. Only if a ring is full anyway, the recording thread waits until there is
+     * space again (no sample is dropped, @see stalls()). Only when the background thread failed or the
+     * recorder is closed meanwhile, the waiting sample is dropped and counted (@see dropped()); the error of the
+     * background thread is rethrown by close().
+     *
+     * The samples of a signal shall be recorded by one thread in the order of time. The file is complete after close(),
+     * which is called by the destructor.
+     */
+    class Recorder {
+
+    public:
+
+        //!< The options of the recorder
+        struct Options {
+            size_t ringCapacity = 1 << 18;          //!< Capacity of the ring of each thread (power of two, >= 2)
+            size_t blockSamples = 1 << 22;          //!< Number of buffered samples, which triggers writing the chunks
+            Compression compression = Compression::NONE;  //!< Compression of the chunks
+            int compressionLevel = 1;               //!< Compression level (1: fastest, 9: smallest)
+            std::chrono::milliseconds flushInterval{10};  //!< Interval in which the rings are drained
+        };
+
+
+    protected:
+
+        //!< A sample in a ring
+        struct Sample {
+            uint32_t signal;                        //!< Index of the signal
+            double time;                            //!< Simulation time
+            double value;                           //!< Value
+        };
+
+        //!< The buffered samples of a signal
+        struct Column {
+            std::vector<double> times;              //!< Times of the samples
+            std::vector<double> values;             //!< Values of the samples
+        };
+
+        typedef parallel::SPSCQueue<Sample> Ring;
+
+        Options _options;                           //!< The options
+        uint64_t _uid;                              //!< The unique ID of the recorder (for the thread caches)
+
+        // recording threads
+        std::mutex _mutex{};                        //!< Mutex of the signals and rings
+        std::vector<std::string> _names{};          //!< The names of the signals
+        std::atomic<uint32_t> _signals{0};          //!< The number of signals
+        std::map<std::thread::id, std::unique_ptr<Ring>> _rings{};  //!< The rings of the threads
+        std::atomic<uint64_t> _stalls{0};           //!< Number of waits for a full ring
+        std::atomic<uint64_t> _dropped{0};          //!< Number of samples dropped after a failure or closing
+        std::atomic<bool> _closed{false};           //!< Flag indicating that the recorder is closed
+        std::atomic<bool> _wakeup{false};           //!< Flag requesting an early drain of the rings
+
+        // background thread
+        std::condition_variable _condition{};       //!< Condition to wake up the background thread
+        bool _stop = false;                         //!< Flag to stop the background thread
+        std::thread _thread{};                      //!< The background thread
+        std::exception_ptr _exception = nullptr;    //!< The first error of the background thread
+        std::atomic<bool> _failed{false};           //!< Flag indicating that the background thread failed
+
+        std::ofstream _stream;                      //!< The output stream
+        std::string _path;                          //!< The path of the file
+        uint64_t _position = 0;                     //!< The position in the file
+        std::vector<Column> _columns{};             //!< The buffered samples per signal
+        size_t _buffered = 0;                       //!< The number of buffered samples
+        std::vector<file::ChunkEntry> _chunks{};    //!< The index of the written chunks
+        std::vector<char> _raw{};                   //!< Buffer for chunks to be compressed
+        std::vector<char> _compressed{};            //!< Buffer for compressed chunks
+        std::shared_ptr<z_stream_s> _deflate{};     //!< The compression stream (reused for all chunks)
+        std::atomic<uint64_t> _written{0};          //!< Number of written samples
+
+
+    public:
+
+
+        /**
+         * Constructor. Creates the file with the default options and starts the background thread.
+         * @param path Path of the file
+         */
+        explicit Recorder(const std::string &path);
+
+
+        /**
+         * Constructor. Creates the file and starts the background thread.
+         * @param path Path of the file
+         * @param options Options
+         */
+        Recorder(const std::string &path, const Options &options);
+
+
+        /**
+         * Destructor. Closes the recorder, errors are ignored (call close() to get them).
+         */
+        virtual ~Recorder();
+
+
+        Recorder(const Recorder &) = delete;
+        Recorder &operator=(const Recorder &) = delete;
+
+
+        /**
+         * Registers a signal (any thread)
+         * @param name Name of the signal
+         * @return Handle of the signal
+         */
+        Signal addSignal(const std::string &name);
+
+
+        /**
+         * Records a sample (any thread, @see Signal::record())
+         * @param signal Index of the signal
+         * @param time Simulation time
+         * @param value Value
+         */
+        void record(uint32_t signal, double time, double value) {
+
+            if(signal >= _signals.load(std::memory_order_relaxed))
+                throw std::out_of_range("Signal is not registered.");
+
+            if(_closed.load(std::memory_order_relaxed))
+                throw std::logic_error("Recorder is closed.");
+
+            auto &ring = threadRing();
+            Sample sample{signal, time, value};
+
+            // wait for the background thread
+            while(!ring.push(sample)) {
+
+                // the ring is not drained anymore
+                if(_failed.load(std::memory_order_acquire) || _closed.load(std::memory_order_acquire)) {
+                    _dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+
+                _stalls.fetch_add(1, std::memory_order_relaxed);
+                wake();
+                std::this_thread::yield();
+
+            }
+
+            // high-water mark: half of the ring pushed since the last wake-up
+            if((ring.pushed() & ((ring.capacity() >> 1) - 1)) == 0)
+                wake();
+
+        }
+
+
+        /**
+         * Writes all recorded samples and the index and closes the file. Rethrows errors of the background thread.
+         */
+        void close();
+
+
+        /**
+         * Returns the number of registered signals
+         * @return Number of signals
+         */
+        size_t signals() const;
+
+
+        /**
+         * Returns the number of samples written to the file
+         * @return Number of samples
+         */
+        uint64_t written() const;
+
+
+        /**
+         * Returns the number of times a recording thread waited for a full ring
+         * @return Number of stalls
+         */
+        uint64_t stalls() const;
+
+
+        /**
+         * Returns the number of samples dropped, because the background thread failed or the recorder was closed
+         * @return Number of dropped samples
+         */
+        uint64_t dropped() const;
+
+
+        /**
+         * Returns true, if the compression is supported by the build
+         * @param compression Compression
+         * @return Support flag
+         */
+        static bool isSupported(Compression compression);
+
+
+    protected:
+
+
+        /**
+         * Returns the ring of the calling thread, which is cached thread-locally
+         * @return Ring
+         */
+        Ring &threadRing() {
+
+            struct Cache {
+                uint64_t recorder = 0;
+                Ring *ring = nullptr;
+            };
+
+            static thread_local Cache cache{};
+
+            if(cache.recorder != _uid) {
+                cache.ring = createRing();
+                cache.recorder = _uid;
+            }
+
+            return *cache.ring;
+
+        }
+
+
+        /**
+         * Returns the ring of the calling thread, which is created if not existing
+         * @return Ring
+         */
+        Ring *createRing();
+
+
+        /**
+         * Wakes up the background thread to drain the rings (without locking)
+         */
+        void wake() {
+
+            _wakeup.store(true, std::memory_order_release);
+            _condition.notify_one();
+
+        }
+
+
+        /**
+         * The loop of the background thread
+         */
+        void work();
+
+
+        /**
+         * Moves the samples from the rings to the columns and writes the chunks, if a block is buffered
+         */
+        void drain();
+
+
+        /**
+         * Writes one chunk per signal with buffered samples
+         */
+        void writeBlock();
+
+
+        /**
+         * Writes the bytes to the file
+         * @param data Bytes
+         * @param n Number of bytes
+         */
+        void write(const void *data, size_t n);
+
+    };
+
+
+    void Signal::record(double time, double value) const {
+
+        _recorder->record(_id, time, value);
+
+    }
+
+}
+
+#endif //DUMMYPROJECT_RECORDER_H
@@ -0,0 +1,80 @@
+// Copyright (c) 2020 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#ifndef DUMMYPROJECT_TRACEFILE_H
+#define DUMMYPROJECT_TRACEFILE_H
+
+#include <cstdint>
+
+namespace trace {
+
+
+    /**
+     * @brief The layout of a trace file.
+     *
+     * The file starts with a header and consists of chunks, each holding the samples of one signal: the times followed
+     * by the values as double arrays, optionally compressed. The chunks of all signals are interleaved in the order they
+     * were flushed and start at offsets aligned to 8 bytes. The file ends with the index and the trailer:
+     *
+     * * Index:   uint64 number of signals, per signal uint32 length and name, uint64 number of chunks, chunk entries
+     * * Trailer: offset and size of the index, "DTRC", version
+     */
+    namespace file {
+
+        constexpr static const char MAGIC[4] = {'D', 'T', 'R', 'C'};   //!< The file identifier
+        constexpr static const uint32_t VERSION = 1;                    //!< The version of the file format
+
+        //!< The header of a trace file
+        struct Header {
+            char magic[4];                          //!< File identifier
+            uint32_t version;                       //!< Version of the file format
+        };
+
+        //!< The index entry of a chunk
+        struct ChunkEntry {
+            uint32_t signal;                        //!< Index of the signal
+            uint32_t compression;                   //!< Compression of the chunk (@see Compression)
+            uint64_t offset;                        //!< Offset of the chunk in the file
+            uint64_t storedSize;                    //!< Size of the chunk in the file
+            uint64_t samples;                       //!< Number of samples in the chunk
+            double begin;                           //!< Time of the first sample
+            double end;                             //!< Time of the last sample
+        };
+
+        //!< The trailer of a trace file
+        struct Trailer {
+            uint64_t indexOffset;                   //!< Offset of the index
+            uint64_t indexSize;                     //!< Size of the index
+            char magic[4];                          //!< File identifier
+            uint32_t version;                       //!< Version of the file format
+        };
+
+    }
+
+
+    //!< The compression of the chunks
+    enum class Compression : uint32_t {NONE, ZLIB};
+
+}
+
+#endif //DUMMYPROJECT_TRACEFILE_H
@@ -0,0 +1,212 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+/*
+ * Test of the C interface of the shared library three, compiled as C to check that the headers are C compatible.
+ * The test returns the number of failed checks.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <three/fleet.h>
+#include <three/three.h>
+
+
+#define UNITS 1000
+
+
+static int failures = 0;
+
+#define CHECK(condition) \
+    do { \
+        if(!(condition)) { \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures; \
+        } \
+    } while(0)
+
+
+/* reference implementation of a vehicle step with the default parameters (@see LongitudinalModel::modelStep()) */
+static void stepReference(double input, double dt, double *a, double *v, double *s) {
+
+    double driveForce = 4.0 * input * 5000.0 / 0.3;
+    double airDrag = 0.5 * 1.2041 * 0.6 * *v * *v;
+    double ds;
+
+    *a = (driveForce - airDrag) / 1300.0;
+    ds = 0.5 * *a * dt + *v * dt;
+
+    *s += ds > 0.0 ? ds : 0.0;
+    *v += *a * dt;
+    *v = *v > 0.0 ? *v : 0.0;
+
+}
+
+
+static void testVersion(void) {
+
+    unsigned int version = abiVersion();
+
+    CHECK(version >> 16 == THREELIB_ABI_VERSION_MAJOR);
+    CHECK((version & 0xffffu) >= THREELIB_ABI_VERSION_MINOR);
+
+}
+
+
+static void testOpenLoop(void) {
+
+    static double inputs[UNITS], a[UNITS], v[UNITS], s[UNITS], mass[UNITS / 2];
+    double ra = 0.0, rv = 0.0, rs = 0.0;
+    size_t i;
+    unsigned int k;
+
+    Fleet *fleet = fleetCreate(UNITS, FLEET_OPEN_LOOP);
+    CHECK(fleet != NULL);
+    CHECK(fleetSize(fleet) == UNITS);
+
+    /* the second half of the vehicles is heavier */
+    for(i = 0; i < UNITS; ++i)
+        inputs[i] = 0.05;
+
+    for(i = 0; i < UNITS / 2; ++i)
+        mass[i] = 2600.0;
+
+    CHECK(fleetSetInputs(fleet, 0, UNITS, inputs) == 0);
+    CHECK(fleetSetVehicleParameters(fleet, UNITS / 2, UNITS / 2, mass, NULL, NULL, NULL) == 0);
+
+    /* 10 s in one call */
+    CHECK(fleetStep(fleet, 0.01, 1000) == 0);
+    CHECK(fabs(fleetTime(fleet) - 10.0) < 1e-9);
+
+    for(k = 0; k < 1000; ++k)
+        stepReference(0.05, 0.01, &ra, &rv, &rs);
+
+    CHECK(fleetGetStates(fleet, 0, UNITS, a, v, s) == 0);
+    for(i = 0; i < UNITS / 2; ++i) {
+        CHECK(fabs(a[i] - ra) < 1e-9 && fabs(v[i] - rv) < 1e-9 && fabs(s[i] - rs) < 1e-9);
+        CHECK(v[UNITS / 2 + i] < v[i]);
+    }
+
+    /* pedals are the inputs */
+    CHECK(fleetGetPedals(fleet, 10, 1, a) == 0);
+    CHECK(a[0] == 0.05);
+
+    /* reset */
+    CHECK(fleetReset(fleet) == 0);
+    CHECK(fleetTime(fleet) == 0.0);
+    CHECK(fleetGetStates(fleet, UNITS - 1, 1, NULL, v, s) == 0);
+    CHECK(v[0] == 0.0 && s[0] == 0.0);
+
+    /* set a state */
+    v[0] = 20.0;
+    CHECK(fleetSetStates(fleet, 3, 1, NULL, v, NULL) == 0);
+    CHECK(fleetGetStates(fleet, 3, 1, NULL, v, s) == 0);
+    CHECK(v[0] == 20.0 && s[0] == 0.0);
+
+    fleetDestroy(fleet);
+
+}
+
+
+static void testClosedLoop(void) {
+
+    static double targets[UNITS], kP[UNITS], kI[UNITS], kD[UNITS], v[UNITS], pedals[UNITS];
+    size_t i;
+
+    Fleet *fleet = fleetCreate(UNITS, FLEET_CLOSED_LOOP);
+    CHECK(fleet != NULL);
+
+    for(i = 0; i < UNITS; ++i) {
+        targets[i] = 5.0 + 10.0 * (double) (i % 3);
+        kP[i] = 0.1;
+        kI[i] = 0.01;
+        kD[i] = 0.0;
+    }
+
+    CHECK(fleetSetControllerGains(fleet, 0, UNITS, kP, kI, kD) == 0);
+    CHECK(fleetSetInputs(fleet, 0, UNITS, targets) == 0);
+
+    /* 120 s */
+    CHECK(fleetStep(fleet, 0.01, 12000) == 0);
+
+    /* the speeds reach the targets */
+    CHECK(fleetGetStates(fleet, 0, UNITS, NULL, v, NULL) == 0);
+    CHECK(fleetGetPedals(fleet, 0, UNITS, pedals) == 0);
+    for(i = 0; i < UNITS; ++i) {
+        CHECK(fabs(v[i] - targets[i]) < 0.05);
+        CHECK(pedals[i] > 0.0);
+    }
+
+    fleetDestroy(fleet);
+
+}
+
+
+static void testErrors(void) {
+
+    double value = 1.0;
+    Fleet *fleet = fleetCreate(10, FLEET_OPEN_LOOP);
+
+    CHECK(fleetCreate(10, (FleetMode) 7) == NULL);
+
+    /* invalid handle */
+    CHECK(fleetSize(NULL) == 0);
+    CHECK(fleetStep(NULL, 0.01, 1) == 1);
+    CHECK(fleetReset(NULL) == 1);
+    CHECK(fleetSetInputs(NULL, 0, 1, &value) == 1);
+    fleetDestroy(NULL);
+
+    /* invalid ranges and arguments */
+    CHECK(fleetSetInputs(fleet, 10, 1, &value) == 1);
+    CHECK(fleetSetInputs(fleet, 5, (size_t) -1, &value) == 1);
+    CHECK(fleetSetInputs(fleet, 0, 1, NULL) == 1);
+    CHECK(fleetGetStates(fleet, 9, 2, NULL, &value, NULL) == 1);
+    CHECK(fleetStep(fleet, 0.0, 1) == 1);
+    CHECK(fleetStep(fleet, NAN, 1) == 1);
+
+    /* open loop fleets have no controllers */
+    CHECK(fleetSetControllerGains(fleet, 0, 1, &value, &value, &value) == 1);
+
+    /* empty ranges are valid */
+    CHECK(fleetSetInputs(fleet, 10, 0, NULL) == 0);
+
+    fleetDestroy(fleet);
+
+}
+
+
+int main(void) {
+
+    testVersion();
+    testOpenLoop();
+    testClosedLoop();
+    testErrors();
+
+    if(failures == 0)
+        printf("All checks passed.\n");
+
+    return failures;
+
+}
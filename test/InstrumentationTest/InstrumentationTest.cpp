@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/Instrumentation.h>
+#include <simulation/Model.h>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using sim::Instrumentation;
+
+
+namespace {
+
+    class SleepModel : public sim::Model<double> {
+
+    public:
+
+        std::chrono::microseconds duration{0};
+
+        void reset() override {}
+
+        bool step(double simTime, double timeStepSize) override {
+
+            if(duration.count() != 0)
+                std::this_thread::sleep_for(duration);
+
+            return true;
+
+        }
+
+    };
+
+
+    std::unique_ptr<SleepModel> createModel(std::string &&id, std::string &&name, double stepSize) {
+
+        std::unique_ptr<SleepModel> model(new SleepModel);
+        model->create();
+        model->setIDAndName(std::move(id), std::move(name));
+        model->setTimeStepSize(stepSize);
+        model->initialize(0.0);
+
+        return model;
+
+    }
+
+}
+
+
+TEST(InstrumentationTest, Enabled) {
+
+    EXPECT_TRUE(Instrumentation::enabled());
+
+}
+
+
+TEST(InstrumentationTest, ExecutedAndSkippedSteps) {
+
+    auto model = createModel("m1", "Fast", 0.1);
+    model->duration = std::chrono::microseconds(200);
+
+    // the model runs every 10th simulation step (the first step is at the start time)
+    for(int i = 0; i < 100; ++i)
+        model->simStep(0.01 * i);
+
+    auto statistics = model->getStepProbe().snapshot();
+    EXPECT_EQ("m1", statistics.id);
+    EXPECT_EQ("Fast", statistics.name);
+    EXPECT_EQ(10, statistics.executed);
+    EXPECT_EQ(90, statistics.skipped);
+    EXPECT_EQ(10, statistics.latency.count());
+    EXPECT_GE(statistics.latency.min(), 200000);
+    EXPECT_LT(statistics.latency.percentile(50.0), 100000000);
+
+    // reset of all models
+    Instrumentation::global().reset();
+    statistics = model->getStepProbe().snapshot();
+    EXPECT_EQ(0, statistics.executed);
+    EXPECT_EQ(0, statistics.skipped);
+
+}
+
+
+TEST(InstrumentationTest, InactiveModelSkips) {
+
+    auto model = createModel("m2", "Inactive", 0.1);
+    model->deactivate();
+
+    model->simStep(0.0);
+    model->simStep(0.1);
+
+    auto statistics = model->getStepProbe().snapshot();
+    EXPECT_EQ(0, statistics.executed);
+    EXPECT_EQ(2, statistics.skipped);
+
+}
+
+
+TEST(InstrumentationTest, Registry) {
+
+    auto &registry = Instrumentation::global();
+    auto before = registry.size();
+
+    {
+        auto m1 = createModel("a", "A", 0.1);
+        auto m2 = createModel("b", "B", 0.1);
+        EXPECT_EQ(before + 2, registry.size());
+
+        m2->simStep(0.0);
+
+        // in the order of the construction
+        auto statistics = registry.snapshot();
+        ASSERT_EQ(before + 2, statistics.size());
+        EXPECT_EQ("a", statistics[before].id);
+        EXPECT_EQ(0, statistics[before].executed);
+        EXPECT_EQ("b", statistics[before + 1].id);
+        EXPECT_EQ(1, statistics[before + 1].executed);
+    }
+
+    // the probes are removed with the models
+    EXPECT_EQ(before, registry.size());
+
+}
+
+
+TEST(InstrumentationTest, WriteJSON) {
+
+    auto model = createModel("m\"3", "Quoted\\Name", 0.1);
+    model->simStep(0.0);
+    model->simStep(0.05);
+
+    std::stringstream ss;
+    Instrumentation::writeJSON(ss, {model->getStepProbe().snapshot()});
+
+    auto json = ss.str();
+    EXPECT_EQ(0, json.find("{\"models\":[{\"id\":\"m\\\"3\",\"name\":\"Quoted\\\\Name\",\"executed\":1,\"skipped\":1,"));
+    EXPECT_NE(std::string::npos, json.find("\"latency_ns\":{\"count\":1,"));
+    EXPECT_NE(std::string::npos, json.find("\"p99\":"));
+    EXPECT_EQ("]}\n", json.substr(json.size() - 3));
+
+    // the format of the stream is kept
+    ss.str("");
+    ss << 0.5;
+    EXPECT_EQ("0.5", ss.str());
+
+}
+
+
+TEST(InstrumentationTest, WritePrometheus) {
+
+    auto model = createModel("m4", "Slow", 0.1);
+    model->duration = std::chrono::microseconds(1000);
+    model->simStep(0.0);
+    model->simStep(0.05);
+
+    std::stringstream ss;
+    Instrumentation::writePrometheus(ss, {model->getStepProbe().snapshot()});
+    auto text = ss.str();
+
+    EXPECT_NE(std::string::npos, text.find("# TYPE sim_model_steps_total counter\n"));
+    EXPECT_NE(std::string::npos, text.find("sim_model_steps_total{id=\"m4\",name=\"Slow\",result=\"executed\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("sim_model_steps_total{id=\"m4\",name=\"Slow\",result=\"skipped\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("# TYPE sim_model_step_duration_seconds histogram\n"));
+
+    // the step took at least 1 ms
+    EXPECT_NE(std::string::npos, text.find("sim_model_step_duration_seconds_bucket{id=\"m4\",name=\"Slow\",le=\"0.0005\"} 0\n"));
+    EXPECT_NE(std::string::npos, text.find("sim_model_step_duration_seconds_bucket{id=\"m4\",name=\"Slow\",le=\"0.1\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("sim_model_step_duration_seconds_bucket{id=\"m4\",name=\"Slow\",le=\"+Inf\"} 1\n"));
+    EXPECT_NE(std::string::npos, text.find("sim_model_step_duration_seconds_count{id=\"m4\",name=\"Slow\"} 1\n"));
+
+}
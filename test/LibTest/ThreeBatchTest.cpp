@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <three/three.h>
+#include <vector>
+
+
+namespace {
+
+    std::vector<double> sequence(size_t n) {
+
+        std::vector<double> values(n);
+        for(size_t i = 0; i < n; ++i)
+            values[i] = 0.5 * (double) i - 7.0;
+
+        return values;
+
+    }
+
+}
+
+
+TEST(ThreeBatchTest, AbiVersion) {
+
+    auto version = threelib::abiVersion();
+
+    EXPECT_EQ(THREELIB_ABI_VERSION_MAJOR, version >> 16);
+    EXPECT_GE(version & 0xffffu, THREELIB_ABI_VERSION_MINOR);
+
+}
+
+
+TEST(ThreeBatchTest, EqualsScalarOperation) {
+
+    // not a multiple of the vector width
+    auto a = sequence(1003);
+    auto expected = a;
+
+    EXPECT_EQ(0, threelib::addArray(a.data(), a.size(), 2.5));
+    for(auto &e : expected)
+        threelib::add(&e, 2.5);
+
+    EXPECT_EQ(expected, a);
+
+    EXPECT_EQ(0, threelib::scaleArray(a.data(), a.size(), -1.5));
+    for(auto &e : expected)
+        e *= -1.5;
+
+    EXPECT_EQ(expected, a);
+
+    auto x = sequence(1003);
+    EXPECT_EQ(0, threelib::axpyArray(a.data(), x.data(), a.size(), 0.25));
+    for(size_t i = 0; i < expected.size(); ++i)
+        expected[i] += 0.25 * x[i];
+
+    EXPECT_EQ(expected, a);
+
+}
+
+
+TEST(ThreeBatchTest, Strided) {
+
+    // every third value
+    auto a = sequence(30);
+    auto expected = a;
+
+    EXPECT_EQ(0, threelib::addStrided(a.data(), 10, 3, 1.0));
+    EXPECT_EQ(0, threelib::scaleStrided(a.data() + 1, 10, 3, 2.0));
+    for(size_t i = 0; i < 30; i += 3) {
+        expected[i] += 1.0;
+        expected[i + 1] *= 2.0;
+    }
+
+    EXPECT_EQ(expected, a);
+
+    // backwards, y[i * 2] += 3 * x[(9 - i)]
+    auto x = sequence(10);
+    EXPECT_EQ(0, threelib::axpyStrided(a.data(), x.data() + 9, 10, 2, -1, 3.0));
+    for(size_t i = 0; i < 10; ++i)
+        expected[2 * i] += 3.0 * x[9 - i];
+
+    EXPECT_EQ(expected, a);
+
+}
+
+
+TEST(ThreeBatchTest, Errors) {
+
+    double a = 1.0;
+
+    EXPECT_EQ(1, threelib::addArray(nullptr, 10, 1.0));
+    EXPECT_EQ(1, threelib::scaleArray(nullptr, 10, 1.0));
+    EXPECT_EQ(1, threelib::axpyArray(&a, nullptr, 1, 1.0));
+    EXPECT_EQ(1, threelib::addStrided(&a, 1, 0, 1.0));
+    EXPECT_EQ(1, threelib::scaleStrided(&a, 1, 0, 1.0));
+    EXPECT_EQ(1, threelib::axpyStrided(&a, &a, 1, 0, 1, 1.0));
+
+    // empty arrays are valid
+    EXPECT_EQ(0, threelib::addArray(&a, 0, 1.0));
+    EXPECT_EQ(1.0, a);
+
+}
+
+
+TEST(ThreeBatchTest, Parallel) {
+
+    auto a = sequence(100003);
+    auto x = sequence(100003);
+    auto expected = a;
+
+    for(size_t i = 0; i < expected.size(); ++i)
+        expected[i] = (expected[i] + 1.0) * 2.0 + 0.5 * x[i];
+
+    // split over four threads above 1000 values
+    ASSERT_EQ(0, threelib::setThreads(4, 1000));
+
+    EXPECT_EQ(0, threelib::addArray(a.data(), a.size(), 1.0));
+    EXPECT_EQ(0, threelib::scaleStrided(a.data(), a.size(), 1, 2.0));
+    EXPECT_EQ(0, threelib::axpyArray(a.data(), x.data(), a.size(), 0.5));
+
+    EXPECT_EQ(expected, a);
+
+    // back to serial execution
+    ASSERT_EQ(0, threelib::setThreads(1, 0));
+
+}
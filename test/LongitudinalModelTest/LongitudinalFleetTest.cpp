@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <LongitudinalModel/LongitudinalFleet.h>
+#include <vector>
+
+
+class VehicleModel : public models::LongitudinalModel {
+
+public:
+
+    explicit VehicleModel(const models::Parameters &parameters) {
+
+        setParameters(parameters);
+
+    }
+
+};
+
+
+TEST(LongitudinalFleetTest, EqualsScalarModel) {
+
+    for(auto kernel : {models::LongitudinalFleet::Kernel::SCALAR, models::LongitudinalFleet::Kernel::AVX2}) {
+
+        if(!models::LongitudinalFleet::isSupported(kernel))
+            continue;
+
+        // 103 vehicles (not a multiple of the vector width)
+        models::LongitudinalFleet fleet{};
+        ASSERT_TRUE(fleet.setKernel(kernel));
+
+        std::vector<VehicleModel> vehicles{};
+        for(size_t i = 0; i < 103; ++i) {
+
+            models::Parameters parameters{};
+            parameters.mass = 1000.0 + 10.0 * (double) i;
+            parameters.maxTorque = 4000.0 + 20.0 * (double) i;
+
+            vehicles.emplace_back(parameters);
+            EXPECT_EQ(i, fleet.add(parameters));
+
+        }
+
+        EXPECT_EQ(vehicles.size(), fleet.size());
+
+        // run with varying inputs (including braking to zero velocity)
+        for(unsigned int k = 0; k < 2000; ++k) {
+
+            for(size_t i = 0; i < vehicles.size(); ++i) {
+
+                double input = k < 1000 ? 0.001 * (double) (i % 10) : -0.05;
+
+                vehicles[i].modelStep(input, 0.01);
+                fleet.setInput(i, input);
+
+            }
+
+            fleet.step(0.01);
+
+        }
+
+        // compare
+        for(size_t i = 0; i < vehicles.size(); ++i) {
+
+            auto expected = vehicles[i].getState();
+            auto actual = fleet.getState(i);
+
+            EXPECT_DOUBLE_EQ(expected.a, actual.a);
+            EXPECT_DOUBLE_EQ(expected.v, actual.v);
+            EXPECT_DOUBLE_EQ(expected.s, actual.s);
+
+            EXPECT_DOUBLE_EQ(expected.v, fleet.velocities()[i]);
+
+        }
+
+    }
+
+}
+
+
+TEST(LongitudinalFleetTest, Access) {
+
+    models::LongitudinalFleet fleet{};
+    fleet.reserve(10);
+
+    fleet.add();
+    fleet.add(models::Parameters{1500.0, 4000.0, 0.5, 1.2}, models::State{0.0, 10.0, 100.0});
+
+    EXPECT_DOUBLE_EQ(10.0, fleet.getState(1).v);
+    EXPECT_DOUBLE_EQ(100.0, fleet.distances()[1]);
+    EXPECT_DOUBLE_EQ(1500.0, fleet.getParameters(1).mass);
+    EXPECT_DOUBLE_EQ(1300.0, fleet.getParameters(0).mass);
+
+    fleet.setState(0, models::State{1.0, 2.0, 3.0});
+    EXPECT_DOUBLE_EQ(2.0, fleet.getState(0).v);
+
+    // step a range only
+    fleet.inputs()[0] = 1.0;
+    fleet.inputs()[1] = 1.0;
+    fleet.step(0.1, 1, 2);
+    EXPECT_DOUBLE_EQ(2.0, fleet.getState(0).v);
+    EXPECT_LT(10.0, fleet.getState(1).v);
+
+    // errors
+    EXPECT_THROW(fleet.step(0.1, 1, 3), std::out_of_range);
+    EXPECT_THROW(fleet.getState(2), std::out_of_range);
+    EXPECT_TRUE(fleet.setKernel(models::LongitudinalFleet::Kernel::SCALAR));
+    EXPECT_EQ(models::LongitudinalFleet::Kernel::SCALAR, fleet.getKernel());
+
+}
@@ -0,0 +1,216 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <solver/DormandPrince.h>
+#include <solver/ExplicitEuler.h>
+#include <solver/RungeKutta4.h>
+#include <cmath>
+#include <stdexcept>
+
+
+namespace {
+
+    // x' = -x, x(0) = 1
+    class Decay : public solver::System {
+
+    public:
+
+        size_t size() const override {
+
+            return 1;
+
+        }
+
+        void derivatives(double, const double *x, double *dxdt) const override {
+
+            dxdt[0] = -x[0];
+
+        }
+
+    };
+
+
+    // integrates the decay until t = 1 and returns the error
+    double decayError(solver::Solver &solver, double h) {
+
+        Decay decay{};
+        double x = 1.0;
+
+        auto n = (unsigned int) std::lround(1.0 / h);
+        for(unsigned int i = 0; i < n; ++i)
+            solver.integrate(decay, (double) i * h, h, &x);
+
+        return std::abs(x - std::exp(-1.0));
+
+    }
+
+
+    // analytic solution of the vehicle accelerating with constant input from standstill: m v' = F - k v^2
+    models::State analytic(const models::Parameters &p, double input, double t) {
+
+        double k = 0.5 * p.rhoAir * p.airDragParam;
+        double force = 4.0 * input * p.maxTorque / 0.3;
+        double vMax = std::sqrt(force / k);
+        double omega = std::sqrt(force * k) / p.mass;
+
+        return {force / p.mass * (1.0 - std::pow(std::tanh(omega * t), 2.0)),
+                vMax * std::tanh(omega * t),
+                p.mass / k * std::log(std::cosh(omega * t))};
+
+    }
+
+}
+
+
+TEST(SolverTest, OrderOfConvergence) {
+
+    solver::ExplicitEuler euler{};
+    solver::RungeKutta4 rk4{};
+
+    // halving the step size reduces the error by 2^order
+    EXPECT_NEAR(2.0, decayError(euler, 0.01) / decayError(euler, 0.005), 0.1);
+    EXPECT_NEAR(16.0, decayError(rk4, 0.01) / decayError(rk4, 0.005), 0.5);
+
+    // one evaluation per Euler step, four per RK4 step
+    EXPECT_EQ(300, euler.steps());
+    EXPECT_EQ(300, euler.evaluations());
+    EXPECT_EQ(300, rk4.steps());
+    EXPECT_EQ(1200, rk4.evaluations());
+
+    euler.reset();
+    EXPECT_EQ(0, euler.steps());
+    EXPECT_EQ(0, euler.evaluations());
+
+}
+
+
+TEST(SolverTest, DormandPrinceTolerance) {
+
+    // the global error follows the tolerance
+    solver::DormandPrince loose(1e-4, 1e-4);
+    solver::DormandPrince tight(1e-10, 1e-10);
+
+    double looseError = decayError(loose, 1.0);
+    double tightError = decayError(tight, 1.0);
+
+    EXPECT_LT(looseError, 1e-4);
+    EXPECT_LT(tightError, 1e-9);
+    EXPECT_LT(loose.steps(), tight.steps());
+
+    // the step size is kept between the calls: many short calls do not need more steps than the requested spans
+    solver::DormandPrince dp(1e-8, 1e-8);
+    EXPECT_LT(decayError(dp, 0.1), 1e-7);
+    EXPECT_LT(dp.steps(), 15);
+    EXPECT_GT(dp.stepSize(), 0.1);
+
+    dp.reset();
+    EXPECT_EQ(0, dp.steps());
+    EXPECT_EQ(0, dp.rejected());
+    EXPECT_EQ(0.0, dp.stepSize());
+
+}
+
+
+TEST(SolverTest, DormandPrinceLimits) {
+
+    EXPECT_THROW(solver::DormandPrince(0.0, 0.0), std::invalid_argument);
+    EXPECT_THROW(solver::DormandPrince(-1.0, 1e-6), std::invalid_argument);
+
+    solver::DormandPrince dp{};
+    EXPECT_THROW(dp.setStepLimits(0.0, 1.0), std::invalid_argument);
+    EXPECT_THROW(dp.setStepLimits(0.1, 0.01), std::invalid_argument);
+
+    // the maximum step size is respected
+    dp.setStepLimits(1e-12, 0.01);
+    decayError(dp, 1.0);
+
+    EXPECT_GE(dp.steps(), 100);
+    EXPECT_LE(dp.stepSize(), 0.01);
+
+}
+
+
+TEST(SolverTest, LongitudinalModelAccuracy) {
+
+    const double input = 0.05;
+    const double end = 60.0;
+
+    models::Parameters parameters{};
+    auto reference = analytic(parameters, input, end);
+
+    // fixed scheme with a small time step
+    models::LongitudinalModel fixed{};
+    for(unsigned int i = 0; i < 6000; ++i)
+        fixed.modelStep(input, 0.01);
+
+    double fixedError = std::abs(fixed.getState().s - reference.s);
+
+    // fourth order solver with a 50 times larger time step is more accurate
+    models::LongitudinalModel model{};
+    solver::RungeKutta4 rk4{};
+    for(unsigned int i = 0; i < 120; ++i)
+        model.modelStep(input, 0.5, rk4);
+
+    EXPECT_LT(std::abs(model.getState().s - reference.s), 0.01 * fixedError);
+    EXPECT_NEAR(reference.v, model.getState().v, 1e-4);
+    EXPECT_NEAR(reference.a, model.getState().a, 1e-4);
+
+    // adaptive solver within a single call
+    models::LongitudinalModel adaptive{};
+    solver::DormandPrince dp(1e-9, 1e-9);
+    adaptive.modelStep(input, end, dp);
+
+    EXPECT_NEAR(reference.s, adaptive.getState().s, 1e-4);
+    EXPECT_NEAR(reference.v, adaptive.getState().v, 1e-6);
+
+}
+
+
+TEST(SolverTest, LongitudinalModelStandstill) {
+
+    models::LongitudinalModel model{};
+    model.setState({0.0, 5.0, 0.0});
+
+    // braking to standstill does not roll backwards
+    solver::DormandPrince dp{};
+    double s = 0.0;
+    for(unsigned int i = 0; i < 100; ++i) {
+
+        model.modelStep(-0.05, 0.1, dp);
+
+        EXPECT_GE(model.getState().v, 0.0);
+        EXPECT_GE(model.getState().s, s);
+        s = model.getState().s;
+
+    }
+
+    EXPECT_EQ(0.0, model.getState().v);
+    EXPECT_EQ(0.0, model.getState().a);
+
+    // braking deceleration: F = 4 * 0.05 * 5000 / 0.3, t = 5 m/s * m / F (drag neglected) ~ 1.95 s
+    EXPECT_NEAR(5.0 * 5.0 / 2.0 * 1300.0 / (4.0 * 0.05 * 5000.0 / 0.3), s, 0.2);
+
+}
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory/FlatHashMap.h>
+#include <random>
+#include <string>
+#include <unordered_map>
+
+
+TEST(FlatHashMapTest, InsertFindErase) {
+
+    memory::FlatHashMap<uint32_t, std::string> map;
+
+    EXPECT_EQ(0, map.size());
+    EXPECT_EQ(16, map.capacity());
+    EXPECT_EQ(nullptr, map.find(1));
+
+    // insert
+    auto res = map.insert(1, "one");
+    EXPECT_TRUE(res.second);
+    EXPECT_EQ("one", *res.first);
+
+    res = map.insert(1, "uno");
+    EXPECT_FALSE(res.second);
+    EXPECT_EQ("one", *res.first);
+
+    map.insert(2, "two");
+    EXPECT_EQ(2, map.size());
+    EXPECT_TRUE(map.contains(2));
+    EXPECT_EQ("two", *map.find(2));
+
+    // erase
+    EXPECT_TRUE(map.erase(1));
+    EXPECT_FALSE(map.erase(1));
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(1, map.size());
+
+    // clear
+    map.clear();
+    EXPECT_EQ(0, map.size());
+    EXPECT_FALSE(map.contains(2));
+
+}
+
+
+TEST(FlatHashMapTest, Reference) {
+
+    memory::FlatHashMap<uint32_t, int> map;
+    std::unordered_map<uint32_t, int> ref;
+
+    // random operations on a small key range (many collisions and shifts) compared to the standard map
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> keys(0, 2000);
+
+    for(int i = 0; i < 100000; ++i) {
+
+        auto key = keys(gen);
+
+        if(gen() % 3 == 0) {
+            EXPECT_EQ(ref.erase(key) == 1, map.erase(key));
+        } else {
+            EXPECT_EQ(ref.emplace(key, i).second, map.insert(key, i).second);
+        }
+
+    }
+
+    EXPECT_EQ(ref.size(), map.size());
+    EXPECT_LE(map.size() * 8, map.capacity() * 7);
+
+    for(uint32_t key = 0; key <= 2000; ++key) {
+
+        auto it = ref.find(key);
+        auto value = map.find(key);
+
+        ASSERT_EQ(it != ref.end(), value != nullptr);
+        if(value != nullptr) {
+            EXPECT_EQ(it->second, *value);
+        }
+
+    }
+
+    // every entry is visited once
+    size_t count = 0;
+    map.forEach([&ref, &count](uint32_t key, int value) {
+        EXPECT_EQ(ref[key], value);
+        count++;
+    });
+
+    EXPECT_EQ(ref.size(), count);
+
+}
+
+
+TEST(FlatHashMapTest, Reserve) {
+
+    memory::FlatHashMap<uint32_t, uint32_t> map;
+    map.reserve(1000);
+
+    auto capacity = map.capacity();
+    EXPECT_LE(1000, capacity);
+
+    // no growth up to the reserved size
+    for(uint32_t i = 0; i < 1000; ++i)
+        map.insert(i, i);
+
+    EXPECT_EQ(capacity, map.capacity());
+    EXPECT_LE(capacity * 8, map.memoryUsage());
+
+}
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <memory/Slab.h>
+#include <set>
+#include <stdexcept>
+
+
+struct Counted {
+
+    static int instances;
+    int value;
+
+    explicit Counted(int v) : value(v) { instances++; }
+    ~Counted() { instances--; }
+
+};
+
+int Counted::instances = 0;
+
+
+TEST(SlabTest, CreateDestroy) {
+
+    {
+
+        memory::Slab<Counted, 4> slab;
+
+        // create
+        auto a = slab.create(1);
+        auto b = slab.create(2);
+
+        EXPECT_EQ(2, slab.size());
+        EXPECT_EQ(4, slab.capacity());
+        EXPECT_EQ(2, Counted::instances);
+        EXPECT_EQ(1, slab[a].value);
+        EXPECT_EQ(2, slab[b].value);
+        EXPECT_TRUE(slab.alive(a));
+
+        // destroy
+        slab.destroy(a);
+        EXPECT_FALSE(slab.alive(a));
+        EXPECT_EQ(1, slab.size());
+        EXPECT_EQ(1, Counted::instances);
+        EXPECT_THROW(slab.destroy(a), std::invalid_argument);
+        EXPECT_THROW(slab.destroy(100), std::invalid_argument);
+
+        // the slot is reused
+        auto c = slab.create(3);
+        EXPECT_EQ(a, c);
+        EXPECT_EQ(3, slab[c].value);
+
+        // the remaining objects are destroyed with the slab
+        slab.create(4);
+
+    }
+
+    EXPECT_EQ(0, Counted::instances);
+
+}
+
+
+TEST(SlabTest, Growth) {
+
+    memory::Slab<Counted, 4> slab;
+    slab.reserve(6);
+    EXPECT_EQ(8, slab.capacity());
+
+    // objects stay in place when the slab grows
+    std::set<memory::Slab<Counted, 4>::Handle> handles;
+    auto first = slab.create(0);
+    auto ptr = &slab[first];
+
+    for(int i = 1; i < 100; ++i)
+        handles.insert(slab.create(i));
+
+    EXPECT_EQ(ptr, &slab[first]);
+    EXPECT_EQ(99, handles.size());
+    EXPECT_EQ(100, slab.size());
+    EXPECT_EQ(100, slab.capacity());
+
+    // no growth when recycling
+    for(auto h : handles)
+        slab.destroy(h);
+
+    for(int i = 1; i < 100; ++i)
+        slab.create(i);
+
+    EXPECT_EQ(100, slab.capacity());
+
+}
@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <proto/PID_controller.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <simulation/ModelGraph.h>
+
+
+class ControllerModel : public sim::Model<double> {
+
+public:
+
+    sim::Input<double> velocity{this};
+    sim::Output<double> pedal{this};
+
+    PID_controller controller{};
+    double target = 20.0;
+
+    bool create() override {
+
+        sim::Model<double>::create();
+        controller.create();
+        controller.setParameters(0.01, 0.001, 0.0);
+
+        return true;
+
+    }
+
+    void reset() override {
+
+        controller.reset();
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        controller.setInput(target - velocity.get());
+        controller.step(simTime, _timeStepSize);
+        pedal.set(controller.getOutput());
+
+        return true;
+
+    }
+
+};
+
+
+class VehicleModel : public sim::Model<double>, public models::LongitudinalModel {
+
+public:
+
+    sim::Input<double> pedal{this};
+    sim::Output<double> velocity{this};
+
+    void reset() override {
+
+        state = models::State{0.0, 0.0, 0.0};
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        modelStep(pedal.get(), _timeStepSize);
+        velocity.set(state.v);
+
+        return true;
+
+    }
+
+};
+
+
+TEST(ClosedLoopTest, ModelGraph) {
+
+    double dt = 0.01;
+
+    // hand-coded reference
+    PID_controller pid{};
+    pid.create();
+    pid.setParameters(0.01, 0.001, 0.0);
+    pid.reset();
+
+    VehicleModel reference{};
+    reference.reset();
+
+    // models
+    ControllerModel controller{};
+    VehicleModel vehicle{};
+
+    for(sim::ModelBase *m : std::vector<sim::ModelBase *>{&controller, &vehicle}) {
+        auto model = dynamic_cast<sim::Model<double> *>(m);
+        model->create();
+        model->setTimeStepSize(dt);
+        model->initialize(0.0);
+    }
+
+    // graph: the feedback of the velocity is delayed by one step
+    sim::ModelGraph graph{};
+    graph.addModel(&vehicle);
+    graph.addModel(&controller);
+    graph.connect(controller.pedal, vehicle.pedal);
+    graph.connect(vehicle.velocity, controller.velocity, true);
+
+    for(unsigned long i = 0; i < 10000; ++i) {
+
+        double t = dt * (double) i;
+
+        // reference
+        pid.setInput(20.0 - reference.getState().v);
+        pid.step(t, dt);
+        reference.modelStep(pid.getOutput(), dt);
+
+        // graph
+        EXPECT_EQ(2, graph.step(t));
+
+    }
+
+    // check
+    EXPECT_DOUBLE_EQ(reference.getState().v, vehicle.getState().v);
+    EXPECT_DOUBLE_EQ(reference.getState().s, vehicle.getState().s);
+    EXPECT_NEAR(20.0, vehicle.getState().v, 1e-3);
+
+}
@@ -23,7 +23,11 @@
 //
 
 #include <cmath>
+#include <cstdio>
+#include <stdexcept>
 #include <gtest/gtest.h>
+#include <google/protobuf/arena.h>
+#include <proto/Models.pb.h>
 #include <proto/PID_controller.h>
 #include <LongitudinalModel/LongitudinalModel.h>
 
@@ -98,4 +102,68 @@ TEST_F(ModelProtoTest, SaveAndLoadModel) {
     EXPECT_FALSE(this->resetFlag);
 
 
-}
\ No newline at end of file
+}
+
+
+TEST_F(ModelProtoTest, SaveAndLoadMessage) {
+
+    // set model
+    PID_controller pid{};
+    pid.create();
+    pid.setParameters(0.01, 0.001, 0.0);
+    pid.reset();
+    pid.setInput(2.0);
+    pid.step(0.0, 0.1);
+
+    // save to a message on an arena
+    google::protobuf::Arena arena;
+    auto msg = google::protobuf::Arena::CreateMessage<simulation::models::PID>(&arena);
+    pid.save(msg);
+
+    EXPECT_DOUBLE_EQ(0.01, msg->parameters().k_p());
+    EXPECT_DOUBLE_EQ(2.0, msg->states().x_0());
+    EXPECT_DOUBLE_EQ(0.2, msg->states().x_int());
+    EXPECT_FALSE(msg->states().reset());
+
+    // load
+    this->create();
+    this->reset();
+    this->load(*msg);
+
+    EXPECT_DOUBLE_EQ(0.01,  this->kP);
+    EXPECT_DOUBLE_EQ(0.001, this->kI);
+    EXPECT_DOUBLE_EQ(0.0,   this->kD);
+    EXPECT_DOUBLE_EQ(2.0,   this->x0);
+    EXPECT_DOUBLE_EQ(0.2,   this->xInt);
+    EXPECT_FALSE(this->resetFlag);
+
+}
+
+
+TEST_F(ModelProtoTest, LoadErrors) {
+
+    // missing file
+    EXPECT_THROW(this->load("ModelProtoTest-missing.bin"), std::runtime_error);
+
+    // other paths do not collide
+    PID_controller a{}, b{};
+    a.create();
+    b.create();
+    a.setParameters(1.0, 0.0, 0.0);
+    b.setParameters(2.0, 0.0, 0.0);
+    a.reset();
+    b.reset();
+
+    a.save("ModelProtoTest-a.bin");
+    b.save("ModelProtoTest-b.bin");
+
+    this->load("ModelProtoTest-a.bin");
+    EXPECT_DOUBLE_EQ(1.0, this->kP);
+
+    this->load("ModelProtoTest-b.bin");
+    EXPECT_DOUBLE_EQ(2.0, this->kP);
+
+    std::remove("ModelProtoTest-a.bin");
+    std::remove("ModelProtoTest-b.bin");
+
+}
@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <proto/PIDBank.h>
+#include <cmath>
+#include <vector>
+
+
+class InspectableController : public PID_controller {
+
+public:
+
+    using PID_controller::kP;
+    using PID_controller::kI;
+    using PID_controller::kD;
+    using PID_controller::xInt;
+    using PID_controller::x0;
+    using PID_controller::y;
+    using PID_controller::resetFlag;
+
+};
+
+
+TEST(PIDBankTest, EqualsController) {
+
+    for(auto kernel : {PIDBank::Kernel::SCALAR, PIDBank::Kernel::AVX2}) {
+
+        if(!PIDBank::isSupported(kernel))
+            continue;
+
+        PIDBank bank{};
+        ASSERT_TRUE(bank.setKernel(kernel));
+
+        // 37 controllers (not a multiple of the vector width)
+        std::vector<PID_controller> controllers(37);
+        for(size_t i = 0; i < controllers.size(); ++i) {
+
+            controllers[i].create();
+            controllers[i].setParameters(0.1 * (double) i, 0.01, 0.5);
+            controllers[i].reset();
+
+            EXPECT_EQ(i, bank.add(controllers[i]));
+
+        }
+
+        // run with resets and a zero time step
+        for(unsigned int k = 0; k < 500; ++k) {
+
+            double dt = k == 100 ? 0.0 : 0.01;
+
+            for(size_t i = 0; i < controllers.size(); ++i) {
+
+                double err = std::sin(0.01 * (double) (k * (i + 1)));
+                bool reset = (k + i) % 97 == 0;
+
+                controllers[i].setInput(err, reset);
+                controllers[i].step(0.01 * k, dt);
+
+                bank.setInput(i, err, reset);
+
+            }
+
+            bank.step(0.01 * k, dt);
+
+            for(size_t i = 0; i < controllers.size(); ++i)
+                ASSERT_DOUBLE_EQ(controllers[i].getOutput(), bank.getOutput(i));
+
+        }
+
+    }
+
+}
+
+
+TEST(PIDBankTest, CopyController) {
+
+    // create controller
+    InspectableController controller{};
+    controller.create();
+    controller.setParameters(1.0, 2.0, 3.0);
+    controller.reset();
+    controller.setInput(1.0);
+    controller.step(0.0, 0.1);
+
+    // copy to bank and back
+    PIDBank bank{};
+    bank.add(0.0, 0.0, 0.0);
+    auto index = bank.add(controller);
+    EXPECT_EQ(2, bank.size());
+
+    InspectableController copy{};
+    bank.get(index, copy);
+
+    EXPECT_DOUBLE_EQ(1.0, copy.kP);
+    EXPECT_DOUBLE_EQ(2.0, copy.kI);
+    EXPECT_DOUBLE_EQ(3.0, copy.kD);
+    EXPECT_DOUBLE_EQ(controller.xInt, copy.xInt);
+    EXPECT_DOUBLE_EQ(controller.x0, copy.x0);
+    EXPECT_DOUBLE_EQ(controller.y, copy.y);
+    EXPECT_FALSE(copy.resetFlag);
+
+    // reset all
+    bank.reset();
+    bank.get(index, copy);
+    EXPECT_DOUBLE_EQ(0.0, copy.xInt);
+    EXPECT_TRUE(copy.resetFlag);
+
+    EXPECT_THROW(bank.get(2, copy), std::out_of_range);
+
+}
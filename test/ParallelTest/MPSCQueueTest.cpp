@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <parallel/MPSCQueue.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+
+TEST(MPSCQueueTest, SingleThread) {
+
+    parallel::MPSCQueue<std::unique_ptr<int>> queue;
+    std::unique_ptr<int> value;
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+
+    // first in, first out
+    for(int i = 0; i < 3; ++i)
+        queue.push(std::unique_ptr<int>(new int(i)));
+
+    EXPECT_FALSE(queue.empty());
+
+    for(int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(queue.pop(value));
+        EXPECT_EQ(i, *value);
+    }
+
+    EXPECT_TRUE(queue.empty());
+
+    // remaining values are deleted with the queue
+    queue.push(std::unique_ptr<int>(new int(3)));
+
+}
+
+
+TEST(MPSCQueueTest, MultipleProducers) {
+
+    const int producers = 4;
+    const int n = 10000;
+
+    parallel::MPSCQueue<int> queue;
+
+    std::vector<std::thread> threads;
+    for(int p = 0; p < producers; ++p) {
+        threads.emplace_back([&queue, p] {
+            for(int i = 0; i < n; ++i)
+                queue.push(p * n + i);
+        });
+    }
+
+    // every value is popped once and the values of a producer are in order
+    std::vector<int> last(producers, -1);
+    int count = 0;
+    int value = 0;
+
+    while(count < producers * n) {
+
+        if(!queue.pop(value)) {
+            std::this_thread::yield();
+            continue;
+        }
+
+        EXPECT_LT(last[value / n], value % n);
+        last[value / n] = value % n;
+        count++;
+
+    }
+
+    for(auto &t : threads)
+        t.join();
+
+    EXPECT_TRUE(queue.empty());
+
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <parallel/SPSCQueue.h>
+#include <stdexcept>
+#include <thread>
+
+
+TEST(SPSCQueueTest, SingleThread) {
+
+    EXPECT_THROW(parallel::SPSCQueue<int>(0), std::invalid_argument);
+    EXPECT_THROW(parallel::SPSCQueue<int>(3), std::invalid_argument);
+
+    parallel::SPSCQueue<int> queue(4);
+    int value = 0;
+
+    EXPECT_EQ(4, queue.capacity());
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop(value));
+
+    // fill the ring
+    for(int i = 0; i < 4; ++i)
+        EXPECT_TRUE(queue.push(i));
+
+    EXPECT_FALSE(queue.push(4));
+
+    // first in, first out
+    ASSERT_TRUE(queue.pop(value));
+    EXPECT_EQ(0, value);
+
+    // wrap around
+    EXPECT_TRUE(queue.push(4));
+
+    int expected = 1;
+    EXPECT_EQ(4, queue.consume([&expected](int v) { EXPECT_EQ(expected++, v); }));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(0, queue.consume([](int) { FAIL(); }));
+
+}
+
+
+TEST(SPSCQueueTest, ProducerConsumer) {
+
+    const long n = 200000;
+    parallel::SPSCQueue<long> queue(64);
+
+    std::thread producer([&queue, n] {
+        for(long i = 0; i < n; ++i) {
+            while(!queue.push(i))
+                std::this_thread::yield();
+        }
+    });
+
+    // values arrive in order
+    long expected = 0;
+    long value = 0;
+    while(expected < n) {
+
+        if(expected % 2 == 0) {
+            if(queue.pop(value)) {
+                EXPECT_EQ(expected++, value);
+            }
+        } else {
+            queue.consume([&expected](long v) { EXPECT_EQ(expected++, v); });
+        }
+
+    }
+
+    producer.join();
+    EXPECT_TRUE(queue.empty());
+
+}
@@ -0,0 +1,108 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <parallel/ShardedExecutor.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+
+TEST(ShardedExecutorTest, Shards) {
+
+    parallel::ShardedExecutor executor(3);
+    EXPECT_EQ(3, executor.size());
+
+    // keys are mapped to valid shards and spread over all shards
+    std::vector<int> counts(3, 0);
+    for(uint64_t key = 0; key < 300; ++key) {
+        auto shard = executor.shardOf(key);
+        ASSERT_LT(shard, 3);
+        counts[shard]++;
+    }
+
+    for(auto c : counts)
+        EXPECT_LT(50, c);
+
+    EXPECT_THROW(executor.post(3, [] {}), std::out_of_range);
+
+}
+
+
+TEST(ShardedExecutorTest, Post) {
+
+    const size_t shards = 4;
+    const int n = 10000;
+
+    parallel::ShardedExecutor executor(shards);
+
+    // one thread per shard, unprotected state per shard
+    std::vector<std::thread::id> ids(shards);
+    std::vector<std::vector<int>> values(shards);
+
+    // post from multiple threads
+    std::vector<std::thread> threads;
+    for(size_t s = 0; s < shards; ++s) {
+        threads.emplace_back([&executor, &ids, &values, s, shards] {
+            for(int i = 0; i < n; ++i) {
+                auto shard = (s + (size_t) i) % shards;
+                executor.post(shard, [&ids, &values, shard, i] {
+                    if(ids[shard] == std::thread::id())
+                        ids[shard] = std::this_thread::get_id();
+                    EXPECT_EQ(ids[shard], std::this_thread::get_id());
+                    values[shard].push_back(i);
+                });
+            }
+        });
+    }
+
+    for(auto &t : threads)
+        t.join();
+
+    executor.sync();
+
+    // all tasks are executed
+    size_t count = 0;
+    for(auto &v : values)
+        count += v.size();
+
+    EXPECT_EQ(shards * n, count);
+
+}
+
+
+TEST(ShardedExecutorTest, Destruction) {
+
+    std::atomic<int> count{0};
+
+    // remaining tasks are executed on destruction
+    {
+        parallel::ShardedExecutor executor(2);
+        for(int i = 0; i < 1000; ++i)
+            executor.post((size_t) i % 2, [&count] { count++; });
+    }
+
+    EXPECT_EQ(1000, count);
+
+}
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <parallel/ThreadPool.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+
+TEST(ThreadPoolTest, ParallelFor) {
+
+    for(size_t threads : {1, 2, 3, 8}) {
+
+        parallel::ThreadPool pool(threads);
+        EXPECT_EQ(threads, pool.size());
+
+        // every index is processed exactly once
+        std::vector<int> counts(10007, 0);
+        for(size_t chunkSize : {0, 1, 7, 100000}) {
+
+            pool.parallelFor(counts.size(), [&counts](size_t begin, size_t end) {
+                for(size_t i = begin; i < end; ++i)
+                    counts[i]++;
+            }, chunkSize);
+
+        }
+
+        for(auto c : counts)
+            EXPECT_EQ(4, c);
+
+        // empty loop
+        pool.parallelFor(0, [](size_t, size_t) { FAIL(); });
+
+    }
+
+}
+
+
+TEST(ThreadPoolTest, NestedLoop) {
+
+    parallel::ThreadPool pool(4);
+
+    std::vector<std::vector<int>> values(16, std::vector<int>(100, 0));
+    pool.parallelFor(values.size(), [&pool, &values](size_t begin, size_t end) {
+        for(size_t i = begin; i < end; ++i) {
+            auto &v = values[i];
+            pool.parallelFor(v.size(), [&v](size_t b, size_t e) {
+                for(size_t j = b; j < e; ++j)
+                    v[j] = (int) j;
+            });
+        }
+    }, 1);
+
+    for(auto &v : values)
+        EXPECT_EQ(4950, std::accumulate(v.begin(), v.end(), 0));
+
+}
+
+
+TEST(ThreadPoolTest, Exception) {
+
+    parallel::ThreadPool pool(4);
+
+    EXPECT_THROW(pool.parallelFor(100, [](size_t begin, size_t end) {
+        if(begin <= 50 && 50 < end)
+            throw std::runtime_error("error");
+    }, 1), std::runtime_error);
+
+    // pool is usable afterwards
+    std::atomic<size_t> sum{0};
+    pool.parallelFor(100, [&sum](size_t begin, size_t end) { sum += end - begin; });
+    EXPECT_EQ(100, sum);
+
+}
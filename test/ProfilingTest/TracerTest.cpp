@@ -0,0 +1,241 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <profiling/Tracer.h>
+#include <proto/Models.pb.h>
+#include <proto/PID_controller.h>
+#include <simulation/Model.h>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using profiling::Tracer;
+
+
+namespace {
+
+    class EmptyModel : public sim::Model<double> {
+
+    public:
+
+        void reset() override {}
+
+        bool step(double simTime, double timeStepSize) override {
+
+            return true;
+
+        }
+
+    };
+
+
+    size_t occurrences(const std::string &text, const std::string &pattern) {
+
+        size_t count = 0;
+        for(auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1))
+            ++count;
+
+        return count;
+
+    }
+
+
+    class TracerTest : public ::testing::Test {
+
+    protected:
+
+        void SetUp() override {
+
+            Tracer::global().clear();
+            Tracer::global().enable();
+
+        }
+
+        void TearDown() override {
+
+            Tracer::global().enable(false);
+            Tracer::global().clear();
+
+        }
+
+        static std::string exportTrace(size_t *count = nullptr) {
+
+            std::stringstream ss;
+            auto n = Tracer::global().writeChromeTrace(ss);
+            if(count != nullptr)
+                *count = n;
+
+            return ss.str();
+
+        }
+
+    };
+
+}
+
+
+TEST_F(TracerTest, Disabled) {
+
+    Tracer::global().enable(false);
+
+    {
+        PROFILE_SPAN("test", "disabled");
+    }
+
+    size_t count = 1;
+    auto json = exportTrace(&count);
+
+    EXPECT_EQ(0, count);
+    EXPECT_EQ("{\"traceEvents\":[\n],\"displayTimeUnit\":\"ns\",\"otherData\":{\"dropped\":0}}\n", json);
+
+}
+
+
+TEST_F(TracerTest, NestedSpans) {
+
+    {
+        PROFILE_SPAN("test", "outer");
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+
+        {
+            PROFILE_SPAN("test", "inner \"quoted\"");
+        }
+    }
+
+    size_t count = 0;
+    auto json = exportTrace(&count);
+
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(2, occurrences(json, "\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, json.find("{\"name\":\"outer\",\"cat\":\"test\",\"ph\":\"X\",\"ts\":"));
+    EXPECT_NE(std::string::npos, json.find("{\"name\":\"inner \\\"quoted\\\"\",\"cat\":\"test\""));
+
+    // the inner span ends first, the outer span lasts at least 100 us
+    auto outer = json.find("\"outer\"");
+    auto duration = std::stod(json.substr(json.find("\"dur\":", outer) + 6));
+    EXPECT_GE(duration, 100.0);
+    EXPECT_LT(json.find("\"inner"), outer);
+
+    // the spans are removed by the export
+    exportTrace(&count);
+    EXPECT_EQ(0, count);
+
+}
+
+
+TEST_F(TracerTest, Threads) {
+
+    const int threads = 4;
+    const int spans = 100;
+
+    std::vector<std::thread> workers{};
+    for(int t = 0; t < threads; ++t) {
+        workers.emplace_back([t, spans]() {
+            Tracer::global().setThreadName("worker-" + std::to_string(t));
+            for(int i = 0; i < spans; ++i) {
+                PROFILE_SPAN("test", "work");
+            }
+        });
+    }
+
+    for(auto &w : workers)
+        w.join();
+
+    size_t count = 0;
+    auto json = exportTrace(&count);
+
+    EXPECT_EQ(threads * spans, count);
+    EXPECT_EQ(threads, occurrences(json, "\"name\":\"thread_name\",\"ph\":\"M\""));
+
+    for(int t = 0; t < threads; ++t)
+        EXPECT_NE(std::string::npos, json.find("\"args\":{\"name\":\"worker-" + std::to_string(t) + "\"}"));
+
+    // one thread ID per thread
+    std::set<std::string> ids{};
+    for(auto pos = json.find("\"tid\":"); pos != std::string::npos; pos = json.find("\"tid\":", pos + 1))
+        ids.insert(json.substr(pos + 6, json.find_first_of(",}", pos) - pos - 6));
+
+    EXPECT_EQ(threads, ids.size());
+
+}
+
+
+TEST_F(TracerTest, DroppedSpans) {
+
+    const size_t capacity = Tracer::CAPACITY;
+
+    // a full ring drops the spans
+    for(size_t i = 0; i < capacity + 10; ++i)
+        Tracer::global().record("test", "span", Tracer::now(), 1);
+
+    EXPECT_EQ(10, Tracer::global().dropped());
+
+    size_t count = 0;
+    auto json = exportTrace(&count);
+
+    EXPECT_EQ(capacity, count);
+    EXPECT_NE(std::string::npos, json.find("\"otherData\":{\"dropped\":10}"));
+    EXPECT_EQ(0, Tracer::global().dropped());
+
+}
+
+
+TEST_F(TracerTest, ModelLifecycle) {
+
+    EmptyModel model{};
+    model.create();
+    model.setTimeStepSize(0.1);
+    model.initialize(0.0);
+    model.simStep(0.0);
+    model.simStep(0.05);
+    model.terminate(0.05);
+
+    auto json = exportTrace();
+
+    EXPECT_EQ(1, occurrences(json, "\"name\":\"Model::initialize\",\"cat\":\"model\""));
+    EXPECT_EQ(2, occurrences(json, "\"name\":\"Model::simStep\",\"cat\":\"model\""));
+    EXPECT_EQ(1, occurrences(json, "\"name\":\"Model::step\",\"cat\":\"model\""));
+    EXPECT_EQ(1, occurrences(json, "\"name\":\"Model::terminate\",\"cat\":\"model\""));
+
+}
+
+
+TEST_F(TracerTest, PIDSaveAndLoad) {
+
+    PID_controller pid{};
+    pid.create();
+
+    simulation::models::PID msg;
+    pid.save(&msg);
+    pid.load(msg);
+
+    auto json = exportTrace();
+
+    EXPECT_EQ(1, occurrences(json, "\"name\":\"PID_controller::save\",\"cat\":\"pid\""));
+    EXPECT_EQ(1, occurrences(json, "\"name\":\"PID_controller::load\",\"cat\":\"pid\""));
+
+}
@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <remote/AsyncRemoteServer.h>
+#include <chrono>
+#include <string>
+
+using simulation::models::VehicleDefinition;
+using simulation::models::VehicleInput;
+using simulation::models::VehicleInputBatch;
+using simulation::models::VehicleState;
+using simulation::models::VehicleStateBatch;
+
+
+TEST(AsyncRemoteServerTest, ShutdownWithOpenStream) {
+
+    // start on a free port
+    int port = 0;
+    remote::AsyncRemoteServer server(2, 1);
+    server.start("127.0.0.1:0", &port);
+    ASSERT_LT(0, port);
+
+    auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials());
+    auto stub = simulation::models::RemoteController::NewStub(channel);
+
+    // create units (on both shards)
+    for(uint32_t id = 1; id <= 4; ++id) {
+
+        grpc::ClientContext context;
+        VehicleDefinition def;
+        VehicleState state;
+
+        def.set_id(id);
+        ASSERT_TRUE(stub->CreateUnit(&context, def, &state).ok());
+
+    }
+
+    // open a stream and step all units once
+    grpc::ClientContext context;
+    auto stream = stub->StreamRequests(&context);
+
+    VehicleInputBatch inputs;
+    VehicleStateBatch states;
+
+    for(uint32_t id = 1; id <= 4; ++id) {
+        auto input = inputs.add_inputs();
+        input->set_id(id);
+        input->set_pedal(1.0);
+    }
+
+    ASSERT_TRUE(stream->Write(inputs));
+    ASSERT_TRUE(stream->Read(&states));
+    ASSERT_EQ(4, states.states_size());
+
+    for(uint32_t id = 1; id <= 4; ++id) {
+        EXPECT_EQ(id, states.states((int) id - 1).id());
+        EXPECT_DOUBLE_EQ(remote::DEFAULT_TIME_STEP_SIZE, states.states((int) id - 1).time());
+    }
+
+    // the idle stream is cancelled after the timeout
+    auto t0 = std::chrono::steady_clock::now();
+    server.shutdown(std::chrono::milliseconds(100));
+    EXPECT_GT(std::chrono::seconds(5), std::chrono::steady_clock::now() - t0);
+
+    EXPECT_FALSE(stream->Read(&states));
+    EXPECT_FALSE(stream->Finish().ok());
+
+}
+
+
+TEST(AsyncRemoteServerTest, ClosedLoop) {
+
+    int port = 0;
+    remote::AsyncRemoteServer server(2, 1);
+    server.start("127.0.0.1:0", &port);
+
+    auto channel = grpc::CreateChannel("127.0.0.1:" + std::to_string(port), grpc::InsecureChannelCredentials());
+    auto stub = simulation::models::RemoteController::NewStub(channel);
+
+    // closed loop unit
+    {
+
+        grpc::ClientContext context;
+        VehicleDefinition def;
+        VehicleState state;
+
+        def.set_id(3);
+        def.set_time_step_size(0.01);
+        def.mutable_controller()->set_k_p(0.1);
+        ASSERT_TRUE(stub->CreateUnit(&context, def, &state).ok());
+
+    }
+
+    // the shard of the unit controls the pedal to the target velocity
+    VehicleState state;
+    for(int i = 0; i < 100; ++i) {
+
+        grpc::ClientContext context;
+        VehicleInput input;
+
+        input.set_id(3);
+        input.set_target_velocity(10.0);
+        ASSERT_TRUE(stub->SendRequest(&context, input, &state).ok());
+
+    }
+
+    EXPECT_LT(0.0, state.velocity());
+    EXPECT_GT(10.0, state.velocity());
+
+}
@@ -0,0 +1,198 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <grpcpp/server_builder.h>
+#include <remote/RemoteController.h>
+#include <memory>
+
+using simulation::models::VehicleDefinition;
+using simulation::models::VehicleInput;
+using simulation::models::VehicleInputBatch;
+using simulation::models::VehicleState;
+using simulation::models::VehicleStateBatch;
+
+
+/**
+ * Runs the synchronous service in process, the stub is connected by an in-process channel
+ */
+class RemoteControllerTest : public testing::Test {
+
+protected:
+
+    remote::RemoteControllerImpl service{};
+    std::unique_ptr<grpc::Server> server{};
+    std::unique_ptr<simulation::models::RemoteController::Stub> stub{};
+
+
+    void SetUp() override {
+
+        grpc::ServerBuilder builder;
+        builder.RegisterService(&service);
+        server = builder.BuildAndStart();
+        ASSERT_NE(nullptr, server);
+
+        stub = simulation::models::RemoteController::NewStub(server->InProcessChannel(grpc::ChannelArguments()));
+
+    }
+
+
+    void TearDown() override {
+
+        server->Shutdown();
+
+    }
+
+
+    grpc::Status create(uint32_t id) {
+
+        grpc::ClientContext context;
+        VehicleDefinition def;
+        VehicleState state;
+
+        def.set_id(id);
+        def.set_time_step_size(0.1);
+
+        return stub->CreateUnit(&context, def, &state);
+
+    }
+
+};
+
+
+TEST_F(RemoteControllerTest, StreamBatch) {
+
+    ASSERT_TRUE(create(1).ok());
+    ASSERT_TRUE(create(2).ok());
+    EXPECT_EQ(grpc::StatusCode::ALREADY_EXISTS, create(1).error_code());
+
+    grpc::ClientContext context;
+    auto stream = stub->StreamRequests(&context);
+
+    // one batch for both units, unit 2 stands still
+    VehicleInputBatch inputs;
+    VehicleStateBatch states;
+
+    auto input = inputs.add_inputs();
+    input->set_id(1);
+    input->set_pedal(1.0);
+
+    input = inputs.add_inputs();
+    input->set_id(2);
+    input->set_pedal(0.0);
+
+    for(int i = 1; i <= 2; ++i) {
+
+        ASSERT_TRUE(stream->Write(inputs));
+        ASSERT_TRUE(stream->Read(&states));
+
+        // the states are in the order of the inputs
+        ASSERT_EQ(2, states.states_size());
+        EXPECT_EQ(1, states.states(0).id());
+        EXPECT_EQ(2, states.states(1).id());
+        EXPECT_DOUBLE_EQ(0.1 * i, states.states(0).time());
+        EXPECT_DOUBLE_EQ(0.1 * i, states.states(1).time());
+        EXPECT_LT(0.0, states.states(0).velocity());
+        EXPECT_DOUBLE_EQ(0.0, states.states(1).velocity());
+
+    }
+
+    ASSERT_TRUE(stream->WritesDone());
+    EXPECT_TRUE(stream->Finish().ok());
+
+}
+
+
+TEST_F(RemoteControllerTest, NotFound) {
+
+    ASSERT_TRUE(create(1).ok());
+
+    // unary
+    {
+
+        grpc::ClientContext context;
+        VehicleInput input;
+        VehicleState state;
+
+        input.set_id(7);
+        EXPECT_EQ(grpc::StatusCode::NOT_FOUND, stub->SendRequest(&context, input, &state).error_code());
+
+    }
+
+    // stream (the batch is not answered, the stream ends with the error)
+    grpc::ClientContext context;
+    auto stream = stub->StreamRequests(&context);
+
+    VehicleInputBatch inputs;
+    VehicleStateBatch states;
+
+    inputs.add_inputs()->set_id(1);
+    inputs.add_inputs()->set_id(7);
+
+    stream->Write(inputs);
+    EXPECT_FALSE(stream->Read(&states));
+    EXPECT_EQ(grpc::StatusCode::NOT_FOUND, stream->Finish().error_code());
+
+}
+
+
+TEST(RemoteControllerUnitTest, ClosedLoop) {
+
+    remote::UnitRegistry units;
+
+    VehicleDefinition def;
+    VehicleInput input;
+    VehicleState state;
+
+    // open loop unit
+    def.set_id(1);
+    def.set_time_step_size(0.01);
+    ASSERT_TRUE(remote::createUnit(units, def, &state).ok());
+    EXPECT_FALSE(units.find(1)->closedLoop);
+
+    // closed loop unit
+    def.set_id(2);
+    def.mutable_controller()->set_k_p(0.5);
+    def.mutable_controller()->set_k_i(0.05);
+    ASSERT_TRUE(remote::createUnit(units, def, &state).ok());
+    EXPECT_TRUE(units.find(2)->closedLoop);
+
+    // the pedal of the input is ignored in closed loop
+    input.set_pedal(0.0);
+    input.set_target_velocity(10.0);
+
+    for(int i = 0; i < 6000; ++i) {
+
+        input.set_id(1);
+        ASSERT_TRUE(remote::stepUnit(units, input, &state).ok());
+
+        input.set_id(2);
+        ASSERT_TRUE(remote::stepUnit(units, input, &state).ok());
+
+    }
+
+    EXPECT_DOUBLE_EQ(0.0, units.find(1)->model.getState().v);
+    EXPECT_NEAR(10.0, state.velocity(), 0.5);
+    EXPECT_NEAR(60.0, state.time(), 1e-6);
+
+}
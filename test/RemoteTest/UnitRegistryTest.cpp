@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <remote/UnitRegistry.h>
+
+
+TEST(UnitRegistryTest, CreateDestroy) {
+
+    remote::UnitRegistry units;
+
+    // create
+    auto unit = units.create(7);
+    ASSERT_NE(nullptr, unit);
+    EXPECT_DOUBLE_EQ(remote::DEFAULT_TIME_STEP_SIZE, unit->timeStepSize);
+    EXPECT_DOUBLE_EQ(0.0, unit->time);
+    EXPECT_EQ(nullptr, units.create(7));
+    EXPECT_EQ(1, units.size());
+
+    // find
+    unit->model.modelStep(1.0, 0.1);
+    EXPECT_EQ(unit, units.find(7));
+    EXPECT_LT(0.0, units.find(7)->model.getState().v);
+    EXPECT_EQ(nullptr, units.find(8));
+
+    // destroy
+    EXPECT_TRUE(units.destroy(7));
+    EXPECT_FALSE(units.destroy(7));
+    EXPECT_EQ(nullptr, units.find(7));
+    EXPECT_EQ(0, units.size());
+
+    // a new unit starts in its initial state
+    unit = units.create(7);
+    ASSERT_NE(nullptr, unit);
+    EXPECT_DOUBLE_EQ(0.0, unit->model.getState().v);
+
+}
+
+
+TEST(UnitRegistryTest, Churn) {
+
+    remote::UnitRegistry units;
+    units.reserve(10000);
+    auto memory = units.memoryUsage();
+
+    // creating and destroying units within the reserved size allocates no memory
+    for(int round = 0; round < 3; ++round) {
+
+        for(uint32_t id = 0; id < 10000; ++id)
+            ASSERT_NE(nullptr, units.create(id + (uint32_t) round * 10000));
+
+        EXPECT_EQ(10000, units.size());
+
+        for(uint32_t id = 0; id < 10000; ++id)
+            ASSERT_TRUE(units.destroy(id + (uint32_t) round * 10000));
+
+    }
+
+    EXPECT_EQ(0, units.size());
+    EXPECT_EQ(memory, units.memoryUsage());
+
+}
@@ -0,0 +1,440 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/EventTimeServer.h>
+#include <simulation/ModelGraph.h>
+#include <simulation/Port.h>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+
+namespace {
+
+    using Mode = sim::Model<double>::ExecutionMode;
+
+
+    // logs the steps of all models (index, time)
+    typedef std::vector<std::pair<size_t, double>> Log;
+
+
+    // wakes itself up with a doubling interval
+    class TimerModel : public sim::Model<double> {
+
+    public:
+
+        double interval = 0.1;
+        std::vector<double> times{};
+        std::vector<double> stepSizes{};
+        Log *log = nullptr;
+        size_t index = 0;
+
+        void reset() override {
+
+            interval = 0.1;
+            times.clear();
+            stepSizes.clear();
+
+        }
+
+        bool step(double simTime, double timeStepSize) override {
+
+            times.push_back(simTime);
+            stepSizes.push_back(timeStepSize);
+
+            if(log != nullptr)
+                log->emplace_back(index, simTime);
+
+            if(getExecutionMode() == Mode::EVENT_DRIVEN)
+                wakeUp(simTime + interval);
+
+            interval *= 2.0;
+
+            return true;
+
+        }
+
+    };
+
+
+    // writes the tenths of the simulation time to the output (changes every 100 steps of 1 ms)
+    class StaircaseModel : public sim::Model<double> {
+
+    public:
+
+        sim::Output<double> out{this};
+        Log *log = nullptr;
+        size_t index = 0;
+
+        void reset() override {}
+
+        bool step(double simTime, double) override {
+
+            out.set(std::floor(simTime * 10.0 + 1e-9));
+
+            if(log != nullptr)
+                log->emplace_back(index, simTime);
+
+            return true;
+
+        }
+
+    };
+
+
+    // copies the input, when it changed
+    class FollowerModel : public sim::Model<double> {
+
+    public:
+
+        sim::Input<double> in{this};
+        std::vector<double> times{};
+        std::vector<double> values{};
+
+        void reset() override {
+
+            times.clear();
+            values.clear();
+
+        }
+
+        bool step(double simTime, double) override {
+
+            times.push_back(simTime);
+            values.push_back(in.get());
+
+            return true;
+
+        }
+
+    };
+
+
+    template<typename T>
+    void setupEventModel(T &model, double startTime = 0.0) {
+
+        model.create();
+        model.setExecutionMode(Mode::EVENT_DRIVEN);
+        model.setStartExecutionTime(startTime);
+        model.initialize(0.0);
+
+    }
+
+
+    template<typename T>
+    void setupFixedModel(T &model, double timeStepSize) {
+
+        model.create();
+        model.setTimeTrackingOriginMode(sim::Model<double>::TimeTrackingOriginMode::FROM_START);
+        model.setTimeStepSize(timeStepSize);
+        model.initialize(0.0);
+
+    }
+
+
+    // runs the server from event to event until the end time
+    unsigned long run(sim::EventTimeServer &server, double end) {
+
+        unsigned long steps = 0;
+        for(double t = server.getNextStepTime(); t <= end; t = server.getNextStepTime())
+            steps += server.step(t);
+
+        return steps;
+
+    }
+
+}
+
+
+TEST(EventTimeServerTest, WakeUps) {
+
+    TimerModel timer{};
+    setupEventModel(timer, 0.5);
+
+    EXPECT_EQ(Mode::EVENT_DRIVEN, timer.getExecutionMode());
+    EXPECT_TRUE(timer.isActive());
+    EXPECT_DOUBLE_EQ(0.5, timer.getNextStepTime());
+
+    sim::EventTimeServer server{};
+    server.registerModel(&timer);
+
+    EXPECT_EQ(1, server.size());
+    EXPECT_DOUBLE_EQ(0.5, server.getNextStepTime());
+
+    // first step at the start time, then the requested wake-ups only
+    EXPECT_EQ(5, run(server, 2.5));
+
+    std::vector<double> expected{0.5, 0.6, 0.8, 1.2, 2.0};
+    ASSERT_EQ(expected.size(), timer.times.size());
+    for(size_t i = 0; i < expected.size(); ++i)
+        EXPECT_NEAR(expected[i], timer.times[i], 1e-12);
+
+    // time step size is the time since the last step
+    EXPECT_NEAR(0.8, timer.stepSizes.back(), 1e-12);
+    EXPECT_NEAR(3.6, server.getNextStepTime(), 1e-12);
+
+}
+
+
+TEST(EventTimeServerTest, WakeUpRules) {
+
+    TimerModel fixed{};
+    setupFixedModel(fixed, 0.1);
+
+    // fixed-step models cannot be woken up, the mode cannot be changed after initialization
+    EXPECT_THROW(fixed.wakeUp(1.0), std::runtime_error);
+    EXPECT_THROW(fixed.setExecutionMode(Mode::EVENT_DRIVEN), std::runtime_error);
+
+    // fixed-step models are not affected by notifications
+    fixed.notify();
+    EXPECT_DOUBLE_EQ(0.0, fixed.getNextStepTime());
+
+    TimerModel timer{};
+    setupEventModel(timer);
+
+    sim::EventTimeServer server{};
+    server.registerModel(&timer);
+    EXPECT_THROW(server.registerModel(&timer), std::invalid_argument);
+    EXPECT_THROW(server.registerModel(nullptr), std::invalid_argument);
+
+    run(server, 0.0);
+    EXPECT_NEAR(0.1, timer.getWakeUpTime(), 1e-12);
+
+    // the earliest wake-up is performed
+    timer.wakeUp(0.05);
+    timer.wakeUp(0.08);
+    EXPECT_DOUBLE_EQ(0.05, timer.getWakeUpTime());
+    EXPECT_DOUBLE_EQ(0.05, server.getNextStepTime());
+
+    // a wake-up in the past is performed at the actual time
+    server.step(0.01);
+    timer.wakeUp(0.0);
+    EXPECT_DOUBLE_EQ(0.01, server.getNextStepTime());
+
+    EXPECT_EQ(1, server.step(0.02));
+    EXPECT_DOUBLE_EQ(0.02, timer.times.back());
+
+}
+
+
+TEST(EventTimeServerTest, CoexistsWithFixedStep) {
+
+    Log log{};
+
+    // fixed-step model registered between two timers
+    TimerModel first{}, last{};
+    TimerModel fixed{};
+    setupEventModel(first);
+    setupFixedModel(fixed, 0.1);
+    setupEventModel(last);
+
+    first.index = 0;
+    fixed.index = 1;
+    last.index = 2;
+    first.log = fixed.log = last.log = &log;
+
+    sim::EventTimeServer server{};
+    server.registerModel(&first);
+    server.registerModel(&fixed);
+    server.registerModel(&last);
+
+    run(server, 1.0);
+
+    // fixed-step model runs in every step, the timers at their wake-ups only
+    EXPECT_EQ(11, fixed.times.size());
+    EXPECT_EQ(4, first.times.size());
+    EXPECT_EQ(4, last.times.size());
+
+    // models due at the same time are executed in the order of registration
+    for(size_t i = 1; i < log.size(); ++i) {
+        if(std::abs(log[i].second - log[i - 1].second) < 1e-9) {
+            EXPECT_LT(log[i - 1].first, log[i].first);
+        } else {
+            EXPECT_LT(log[i - 1].second, log[i].second);
+        }
+    }
+
+}
+
+
+TEST(EventTimeServerTest, DeactivatedModel) {
+
+    TimerModel fixed{};
+    fixed.create();
+    fixed.setTimeStepSize(0.1);
+    fixed.initialize(0.0);
+
+    sim::EventTimeServer server{};
+    server.registerModel(&fixed);
+
+    EXPECT_EQ(4, run(server, 0.35));
+
+    // the pending step is skipped, then the model is not scheduled anymore
+    fixed.deactivate();
+    EXPECT_EQ(0, run(server, 1.05));
+    EXPECT_EQ(4, fixed.times.size());
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), server.getNextStepTime());
+
+    // the activation schedules the model again (the model is reset by the activation)
+    fixed.activate();
+    EXPECT_NEAR(0.4, server.getNextStepTime(), 1e-12);
+
+    EXPECT_EQ(7, run(server, 1.05));
+    ASSERT_EQ(7, fixed.times.size());
+    EXPECT_NEAR(0.4, fixed.times.front(), 1e-12);
+    EXPECT_NEAR(1.0, fixed.times.back(), 1e-12);
+
+}
+
+
+TEST(EventTimeServerTest, TriggeringInput) {
+
+    // the follower is registered first, so it is woken up after its turn in the step
+    FollowerModel follower{};
+    StaircaseModel staircase{};
+    setupEventModel(follower);
+    setupFixedModel(staircase, 0.001);
+
+    follower.in.connect(staircase.out);
+    follower.in.setTrigger(true);
+    EXPECT_TRUE(follower.in.isTrigger());
+
+    sim::EventTimeServer server{};
+    server.registerModel(&follower);
+    server.registerModel(&staircase);
+
+    unsigned long steps = 0;
+    for(unsigned int i = 0; i < 1000; ++i)
+        steps += server.step(0.001 * i);
+
+    // one step at the start and one per change, in the same simulation step as the change
+    ASSERT_EQ(10, follower.times.size());
+    for(size_t i = 1; i < follower.times.size(); ++i) {
+        EXPECT_NEAR(0.1 * (double) i, follower.times[i], 1e-9);
+        EXPECT_DOUBLE_EQ((double) i, follower.values[i]);
+    }
+
+    EXPECT_EQ(1010, steps);
+
+    // no notifications after removing the trigger
+    follower.in.setTrigger(false);
+    for(unsigned int i = 1000; i < 1200; ++i)
+        server.step(0.001 * i);
+
+    EXPECT_EQ(10, follower.times.size());
+
+}
+
+
+TEST(EventTimeServerTest, TriggeringInputPolled) {
+
+    // event-driven models also work with servers polling the models in every step
+    StaircaseModel staircase{};
+    FollowerModel follower{};
+    setupFixedModel(staircase, 0.001);
+    setupEventModel(follower);
+
+    sim::ModelGraph graph{};
+    graph.addModel(&staircase);
+    graph.addModel(&follower);
+    graph.connect(staircase.out, follower.in);
+    follower.in.setTrigger(true);
+
+    for(unsigned int i = 0; i < 1000; ++i)
+        graph.step(0.001 * i);
+
+    ASSERT_EQ(10, follower.times.size());
+    EXPECT_NEAR(0.9, follower.times.back(), 1e-9);
+    EXPECT_DOUBLE_EQ(9.0, follower.values.back());
+
+}
+
+
+TEST(EventTimeServerTest, Snapshot) {
+
+    TimerModel timer{};
+    setupEventModel(timer);
+    timer.wakeUp(-1.0);
+    timer.wakeUp(-2.0);
+
+    // write state
+    sim::SnapshotWriter counter{};
+    timer.saveState(counter);
+
+    std::vector<char> buffer(counter.size());
+    sim::SnapshotWriter writer(buffer.data());
+    timer.saveState(writer);
+
+    // restore into a fixed-step model
+    TimerModel restored{};
+    setupFixedModel(restored, 0.1);
+
+    sim::SnapshotReader reader(buffer.data(), buffer.size());
+    restored.loadState(reader);
+
+    EXPECT_EQ(Mode::EVENT_DRIVEN, restored.getExecutionMode());
+    EXPECT_DOUBLE_EQ(-2.0, restored.getWakeUpTime());
+
+}
+
+
+TEST(EventTimeServerTest, TickTimeBase) {
+
+    class TickTimer : public sim::Model<double, sim::Ticks> {
+
+    public:
+
+        std::vector<sim::Ticks> times{};
+
+        void reset() override {}
+
+        bool step(sim::Ticks simTime, sim::Ticks) override {
+
+            times.push_back(simTime);
+            wakeUp(simTime + std::chrono::milliseconds(7));
+
+            return true;
+
+        }
+
+    };
+
+    TickTimer timer{};
+    timer.create();
+    timer.setExecutionMode(TickTimer::ExecutionMode::EVENT_DRIVEN);
+    timer.initialize(sim::Ticks(0));
+
+    sim::TickEventTimeServer server{};
+    server.registerModel(&timer);
+
+    for(auto t = server.getNextStepTime(); t <= std::chrono::seconds(1); t = server.getNextStepTime())
+        server.step(t);
+
+    // exact multiples of 7 ms
+    ASSERT_EQ(143, timer.times.size());
+    EXPECT_EQ(std::chrono::milliseconds(994), timer.times.back());
+
+}
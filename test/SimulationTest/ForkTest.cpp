@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/Fork.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    class BranchVehicle : public sim::Model<double>, public models::LongitudinalModel {
+
+    public:
+
+        double pedal = 0.0;
+
+        void reset() override {
+
+            *_data = 0.0;
+            setState(models::State{});
+
+        }
+
+        bool step(double simTime, double timeStepSize) override {
+
+            modelStep(pedal, timeStepSize);
+            *_data += 1.0;
+
+            return true;
+
+        }
+
+        double getData() const {
+
+            return *_data;
+
+        }
+
+        void saveState(sim::SnapshotWriter &writer) const override {
+
+            sim::Model<double>::saveState(writer);
+            writer.write(pedal);
+            writer.write(state);
+            writer.write(getParameters());
+
+        }
+
+        void loadState(sim::SnapshotReader &reader) override {
+
+            sim::Model<double>::loadState(reader);
+            reader.read(pedal);
+            reader.read(state);
+
+            models::Parameters parameters{};
+            reader.read(parameters);
+            setParameters(parameters);
+
+        }
+
+    };
+
+}
+
+
+class ForkTest : public ::testing::Test {
+
+protected:
+
+    std::vector<std::unique_ptr<BranchVehicle>> _models{};
+    std::vector<sim::ModelBase *> _pointers{};
+
+    void SetUp() override {
+
+        _models = create();
+        for(auto &m : _models)
+            _pointers.push_back(m.get());
+
+        // warm-up
+        run(_models, 0.0, 5.0);
+
+    }
+
+    static std::vector<std::unique_ptr<BranchVehicle>> create() {
+
+        std::vector<std::unique_ptr<BranchVehicle>> models{};
+        for(size_t i = 0; i < 10; ++i) {
+
+            models.emplace_back(new BranchVehicle);
+            auto &m = models.back();
+
+            m->create();
+            m->setIDAndName("vehicle-" + std::to_string(i), "Vehicle");
+            m->setTimeStepSize(0.01 * (double) (i % 2 + 1));
+            m->initialize(0.0);
+            m->pedal = 0.05 * (double) (i + 1);
+
+        }
+
+        return models;
+
+    }
+
+    static void run(std::vector<std::unique_ptr<BranchVehicle>> &models, double start, double end) {
+
+        sim::TimeServer server{};
+        for(auto &m : models)
+            server.registerModel(m.get());
+
+        for(unsigned long k = 1; start + (double) k * 0.01 < end + 1e-9; ++k)
+            server.step(start + (double) k * 0.01);
+
+    }
+
+    static sim::Branch::Factory factory() {
+
+        return [](size_t) { return std::unique_ptr<sim::ModelBase>(new BranchVehicle); };
+
+    }
+
+};
+
+
+TEST_F(ForkTest, CopyOnWrite) {
+
+    sim::Fork fork(_pointers, 5.0, factory());
+    auto branches = fork.branch(3);
+
+    EXPECT_EQ(10, branches[0].size());
+    EXPECT_DOUBLE_EQ(5.0, branches[0].getSimTime());
+
+    // nothing materialized yet
+    for(auto &b : branches) {
+        for(size_t i = 0; i < b.size(); ++i)
+            EXPECT_TRUE(b.isShared(i));
+    }
+
+    // materialize one model in one branch
+    auto model = branches[1].get<BranchVehicle>(3);
+    EXPECT_FALSE(branches[1].isShared(3));
+    EXPECT_TRUE(branches[1].isShared(2));
+    EXPECT_TRUE(branches[0].isShared(3));
+    EXPECT_EQ(model, branches[1].get(3));
+
+    // state is restored from the image
+    EXPECT_EQ("vehicle-3", model->getID());
+    EXPECT_DOUBLE_EQ(_models[3]->getData(), model->getData());
+    EXPECT_DOUBLE_EQ(_models[3]->getState().v, model->getState().v);
+    EXPECT_EQ(BranchVehicle::ModelState::RUNNING, model->getModelState());
+
+    // changes do not affect the original model or the image
+    model->pedal = 0.0;
+    EXPECT_DOUBLE_EQ(0.2, _models[3]->pedal);
+    EXPECT_DOUBLE_EQ(0.2, branches[2].get<BranchVehicle>(3)->pedal);
+
+}
+
+
+TEST_F(ForkTest, BranchesMatchContinuedSimulation) {
+
+    parallel::ThreadPool pool(3);
+
+    for(auto p : std::vector<parallel::ThreadPool *>{nullptr, &pool}) {
+
+        sim::Fork fork(_pointers, 5.0, factory(), p);
+        auto branches = fork.branch(4);
+
+        // vary parameters in branches 1 to 3
+        auto parameters = branches[1].get<BranchVehicle>(0)->getParameters();
+        parameters.mass = 2000.0;
+        branches[1].get<BranchVehicle>(0)->setParameters(parameters);
+        branches[2].get<BranchVehicle>(0)->pedal = 1.0;
+        branches[3].get<BranchVehicle>(5)->pedal = 0.0;
+
+        // 10 models, half of them at 100 Hz and half at 50 Hz for 5 s, per branch
+        EXPECT_EQ(4 * (5 * 500 + 5 * 250), fork.run(branches, 10.0, 0.01));
+        EXPECT_NEAR(10.0, branches[0].getSimTime(), 1e-9);
+
+        // the original models are not changed by the branches
+        EXPECT_DOUBLE_EQ(500.0, _models[0]->getData());
+
+        // the unchanged branch matches the continued simulation
+        auto reference = create();
+        run(reference, 0.0, 5.0);
+        run(reference, 5.0, 10.0);
+
+        for(size_t i = 0; i < reference.size(); ++i) {
+            auto model = branches[0].get<BranchVehicle>(i);
+            EXPECT_DOUBLE_EQ(reference[i]->getData(), model->getData());
+            EXPECT_DOUBLE_EQ(reference[i]->getState().s, model->getState().s);
+            EXPECT_DOUBLE_EQ(reference[i]->getState().v, model->getState().v);
+        }
+
+        // the varied branches differ
+        EXPECT_LT(branches[1].get<BranchVehicle>(0)->getState().v, reference[0]->getState().v);
+        EXPECT_GT(branches[2].get<BranchVehicle>(0)->getState().v, reference[0]->getState().v);
+        EXPECT_LT(branches[3].get<BranchVehicle>(5)->getState().v, reference[5]->getState().v);
+        EXPECT_DOUBLE_EQ(reference[4]->getState().v, branches[3].get<BranchVehicle>(4)->getState().v);
+
+    }
+
+}
+
+
+TEST_F(ForkTest, Errors) {
+
+    EXPECT_THROW(sim::Fork(_pointers, 5.0, nullptr), std::invalid_argument);
+    EXPECT_THROW(sim::Fork({nullptr}, 5.0, factory()), std::invalid_argument);
+
+    sim::Fork fork(_pointers, 5.0, [](size_t) { return std::unique_ptr<sim::ModelBase>(); });
+    auto branches = fork.branch(1);
+
+    EXPECT_THROW(branches[0].get(0), std::runtime_error);
+    EXPECT_THROW(branches[0].get(10), std::out_of_range);
+    EXPECT_THROW(branches[0].run(6.0, 0.0), std::invalid_argument);
+
+}
@@ -0,0 +1,214 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/ModelGraph.h>
+#include <memory>
+#include <vector>
+
+
+class SignalModel : public sim::Model<double> {
+
+public:
+
+    sim::Input<double> in{this};
+    sim::Output<double> out{this};
+
+    double gain = 1.0;
+    double offset = 0.0;
+    bool hasInput = true;
+
+    void reset() override {
+
+        out.set(0.0);
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        out.set(offset + gain * (hasInput ? in.get() : simTime));
+        return true;
+
+    }
+
+};
+
+
+/**
+ * Creates the given number of models
+ * @param n Number of models
+ * @return Models
+ */
+std::vector<std::unique_ptr<SignalModel>> createSignalModels(size_t n) {
+
+    std::vector<std::unique_ptr<SignalModel>> models{};
+    for(size_t i = 0; i < n; ++i) {
+
+        models.emplace_back(new SignalModel);
+        models.back()->create();
+        models.back()->setTimeStepSize(0.1);
+        models.back()->initialize(0.0);
+
+    }
+
+    return models;
+
+}
+
+
+TEST(ModelGraphTest, Order) {
+
+    auto models = createSignalModels(4);
+    models[0]->hasInput = false;
+
+    // registration order differs from data flow: 0 -> 3 -> 1 -> 2
+    sim::ModelGraph graph{};
+    for(auto &m : models)
+        graph.addModel(m.get());
+
+    graph.connect(models[1]->out, models[2]->in);
+    graph.connect(models[3]->out, models[1]->in);
+    graph.connect(models[0]->out, models[3]->in);
+
+    // check levels
+    std::vector<std::vector<size_t>> expected{{0}, {3}, {1}, {2}};
+    EXPECT_EQ(expected, graph.getLevels());
+
+    // the signal is passed through in one step
+    models[3]->gain = 2.0;
+    EXPECT_EQ(4, graph.step(1.0));
+    EXPECT_DOUBLE_EQ(2.0, models[2]->out.get());
+
+    // errors
+    EXPECT_THROW(graph.addModel(models[0].get()), std::invalid_argument);
+    EXPECT_THROW(graph.addModel(nullptr), std::invalid_argument);
+
+    SignalModel other{};
+    EXPECT_THROW(graph.connect(other.out, models[0]->in), std::invalid_argument);
+    EXPECT_THROW(other.in.get(), std::runtime_error);
+
+}
+
+
+TEST(ModelGraphTest, AlgebraicLoop) {
+
+    // loop: 0 -> 1 -> 0
+    auto models = createSignalModels(2);
+    models[0]->offset = 1.0;
+
+    sim::ModelGraph graph{};
+    for(auto &m : models)
+        graph.addModel(m.get());
+
+    graph.connect(models[0]->out, models[1]->in);
+    graph.connect(models[1]->out, models[0]->in);
+
+    // not solvable
+    EXPECT_THROW(graph.step(0.0), std::runtime_error);
+
+    // break loop automatically: the connection back to the first model is delayed
+    graph.setLoopBreaking(true);
+    models[0]->in.setInitialValue(10.0);
+
+    EXPECT_EQ(2, graph.step(0.0));
+    EXPECT_TRUE(models[0]->in.isDelayed());
+    EXPECT_FALSE(models[1]->in.isDelayed());
+    EXPECT_DOUBLE_EQ(11.0, models[0]->out.get());
+    EXPECT_DOUBLE_EQ(11.0, models[1]->out.get());
+
+    // the delayed value is the output of the last step
+    EXPECT_EQ(2, graph.step(0.1));
+    EXPECT_DOUBLE_EQ(12.0, models[1]->out.get());
+
+}
+
+
+TEST(ModelGraphTest, Reconnect) {
+
+    auto models = createSignalModels(3);
+    models[2]->hasInput = false;
+
+    sim::ModelGraph graph{};
+    graph.setLoopBreaking(true);
+    for(auto &m : models)
+        graph.addModel(m.get());
+
+    // the input of the first model is connected to the second and then to the third model: 2 -> 0 -> 1
+    graph.connect(models[1]->out, models[0]->in);
+    graph.connect(models[2]->out, models[0]->in);
+    graph.connect(models[0]->out, models[1]->in);
+
+    // the replaced connection does not close a loop
+    std::vector<std::vector<size_t>> expected{{2}, {0}, {1}};
+    EXPECT_EQ(expected, graph.getLevels());
+    EXPECT_FALSE(models[0]->in.isDelayed());
+
+    // the signal is passed through in one step
+    EXPECT_EQ(3, graph.step(1.0));
+    EXPECT_DOUBLE_EQ(1.0, models[1]->out.get());
+
+}
+
+
+TEST(ModelGraphTest, Parallel) {
+
+    // wide graph: independent chains of three models
+    auto run = [](parallel::ThreadPool *pool) {
+
+        auto models = createSignalModels(300);
+
+        sim::ModelGraph graph(pool);
+        for(auto &m : models)
+            graph.addModel(m.get());
+
+        for(size_t i = 0; i < models.size(); i += 3) {
+
+            models[i]->hasInput = false;
+            models[i]->gain = 0.01 * (double) i;
+            models[i + 1]->offset = 1.0;
+            models[i + 2]->gain = 0.5;
+
+            graph.connect(models[i]->out, models[i + 1]->in);
+            graph.connect(models[i + 1]->out, models[i + 2]->in);
+
+        }
+
+        EXPECT_EQ(3, graph.getLevels().size());
+
+        for(unsigned int k = 0; k < 100; ++k)
+            EXPECT_EQ(300, graph.step(0.1 * k));
+
+        std::vector<double> outputs{};
+        for(auto &m : models)
+            outputs.push_back(m->out.get());
+
+        return outputs;
+
+    };
+
+    auto expected = run(nullptr);
+    parallel::ThreadPool pool(4);
+    EXPECT_EQ(expected, run(&pool));
+
+}
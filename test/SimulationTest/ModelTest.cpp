@@ -170,4 +170,51 @@ TEST_F(TestModel, Process) {
     this->destroy();
     
 
-}
\ No newline at end of file
+}
+
+
+class ArenaModel : public sim::Model<simulation::Model> {
+
+public:
+
+    explicit ArenaModel(google::protobuf::Arena *arena) : sim::Model<simulation::Model>(arena) {}
+
+    simulation::Model *data() {
+        return _data;
+    }
+
+    void reset() override {}
+
+    bool step(double simTime, double timeStepSize) override {
+        return true;
+    }
+
+};
+
+
+TEST(ModelArenaTest, Arena) {
+
+    google::protobuf::Arena arena;
+
+    // containers on the arena
+    {
+        ArenaModel model(&arena);
+        model.setIDAndName("model-1", "Model1");
+
+        EXPECT_EQ(&arena, model.getArena());
+        EXPECT_EQ(&arena, model.data()->GetArena());
+        EXPECT_EQ("model-1", model.getID());
+        EXPECT_EQ("Model1", model.getName());
+    }
+
+    EXPECT_LT(0, arena.SpaceUsed());
+
+    // containers on the heap
+    ArenaModel model(nullptr);
+    model.setIDAndName("model-2", "Model2");
+
+    EXPECT_EQ(nullptr, model.getArena());
+    EXPECT_EQ(nullptr, model.data()->GetArena());
+    EXPECT_EQ("model-2", model.getID());
+
+}
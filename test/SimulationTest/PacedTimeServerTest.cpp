@@ -0,0 +1,241 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/PacedTimeServer.h>
+#include <simulation/ParallelTimeServer.h>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using Mode = sim::Model<double>::TimeTrackingOriginMode;
+using Clock = std::chrono::steady_clock;
+
+
+namespace {
+
+    /**
+     * A steady clock which is advanced manually, which makes the paced tests independent of the scheduling of the
+     * test process. Each reading advances the clock by a microsecond, so spinning on the clock terminates.
+     */
+    struct ManualClock {
+
+        typedef std::chrono::nanoseconds duration;
+        typedef duration::rep rep;
+        typedef duration::period period;
+        typedef std::chrono::time_point<ManualClock> time_point;
+
+        static constexpr bool is_steady = true;
+
+        static std::atomic<int64_t> &ticks() {
+
+            static std::atomic<int64_t> t{0};
+            return t;
+
+        }
+
+        static time_point now() {
+
+            return time_point(duration(ticks().fetch_add(1000) + 1000));
+
+        }
+
+        static void advance(duration d) {
+
+            ticks().fetch_add(d.count());
+
+        }
+
+    };
+
+
+    class PacedModel : public sim::Model<double> {
+
+    public:
+
+        std::vector<double> times{};
+        std::chrono::milliseconds firstStepDuration{0};
+
+        PacedModel(double timeStepSize, Mode mode) {
+
+            create();
+            setTimeTrackingOriginMode(mode);
+            setTimeStepSize(timeStepSize);
+            initialize(0.0);
+
+        }
+
+        void reset() override {
+
+            times.clear();
+
+        }
+
+        bool step(double simTime, double timeStepSize) override {
+
+            // a slow first step (on the manual clock)
+            if(times.empty())
+                ManualClock::advance(firstStepDuration);
+
+            times.push_back(simTime);
+            return true;
+
+        }
+
+    };
+
+}
+
+
+TEST(PacedTimeServerTest, AsFastAsPossible) {
+
+    PacedModel a(0.01, Mode::FROM_START), b(0.03, Mode::FROM_LAST_STEP);
+
+    sim::PacedTimeServer<> server{};
+    server.setRealTimeFactor(INFINITY);
+    server.registerModel(&a);
+    server.registerModel(&b);
+
+    std::vector<double> ticks{};
+    auto start = Clock::now();
+    auto end = server.run(0.0, 10.0, [&ticks](double simTime) { ticks.push_back(simTime); });
+
+    EXPECT_LT(Clock::now() - start, std::chrono::seconds(1));
+    EXPECT_NEAR(10.0, end, 1e-9);
+
+    // the steps are executed at their due times
+    ASSERT_EQ(1001, a.times.size());
+    ASSERT_EQ(334, b.times.size());
+    EXPECT_NEAR(5.0, a.times[500], 1e-9);
+    EXPECT_NEAR(3.0, b.times[100], 1e-9);
+
+    auto &s = server.statistics();
+    EXPECT_EQ(ticks.size(), s.ticks);
+    EXPECT_EQ(1001 + 334, s.steps);
+    EXPECT_EQ(0, s.overruns);
+
+    EXPECT_EQ(1001, server.modelStatistics(0).steps);
+    EXPECT_EQ(0, server.modelStatistics(0).delayed);
+    EXPECT_EQ(0, server.modelStatistics(1).catchUps);
+    EXPECT_THROW(server.modelStatistics(2), std::out_of_range);
+    EXPECT_THROW(server.setRealTimeFactor(0.0), std::invalid_argument);
+
+}
+
+
+TEST(PacedTimeServerTest, AcceleratedRealTime) {
+
+    PacedModel model(0.01, Mode::FROM_LAST_STEP);
+
+    sim::PacedTimeServer<sim::TimeServer, ManualClock> server{};
+    server.setRealTimeFactor(10.0);
+    server.setTolerance(std::chrono::milliseconds(5));
+    server.setSpinTime(std::chrono::hours(1));
+    server.registerModel(&model);
+
+    // 1 s simulation time takes 100 ms
+    auto start = ManualClock::now();
+    server.run(0.0, 1.0);
+    auto elapsed = ManualClock::now() - start;
+
+    EXPECT_GE(elapsed, std::chrono::milliseconds(100));
+    EXPECT_LT(elapsed, std::chrono::milliseconds(101));
+
+    ASSERT_EQ(101, model.times.size());
+    EXPECT_NEAR(0.5, model.times[50], 1e-9);
+    EXPECT_EQ(0, server.statistics().overruns);
+    EXPECT_EQ(101, server.lateness().count());
+
+}
+
+
+TEST(PacedTimeServerTest, DelayedStepsAreCaughtUp) {
+
+    // a slow first step delays both models by about five steps
+    PacedModel fromStart(0.01, Mode::FROM_START), fromLastStep(0.01, Mode::FROM_LAST_STEP);
+    fromStart.firstStepDuration = std::chrono::milliseconds(55);
+
+    sim::PacedTimeServer<sim::TimeServer, ManualClock> server{};
+    server.setSpinTime(std::chrono::hours(1));
+    server.registerModel(&fromStart);
+    server.registerModel(&fromLastStep);
+    server.run(0.0, 0.2);
+
+    // the step after the slow one and the catch-up steps are late
+    EXPECT_EQ(5, server.statistics().overruns);
+
+    // the model tracking from the start catches up all steps
+    auto s = server.modelStatistics(0);
+    EXPECT_EQ(21, fromStart.times.size());
+    EXPECT_EQ(21, s.steps);
+    EXPECT_EQ(4, s.catchUps);
+    EXPECT_EQ(5, s.delayed);
+    EXPECT_NEAR(0.045, s.maxDelay, 1e-4);
+
+    // the model tracking from the last step skips the delayed steps
+    auto l = server.modelStatistics(1);
+    EXPECT_EQ(16, fromLastStep.times.size());
+    EXPECT_EQ(fromLastStep.times.size(), l.steps);
+    EXPECT_EQ(0, l.catchUps);
+    EXPECT_EQ(1, l.delayed);
+
+    // the simulation time is increasing
+    for(size_t i = 1; i < fromStart.times.size(); ++i)
+        EXPECT_GT(fromStart.times[i], fromStart.times[i - 1]);
+
+}
+
+
+TEST(PacedTimeServerTest, StopParallel) {
+
+    parallel::ThreadPool pool(2);
+
+    std::vector<std::unique_ptr<PacedModel>> models{};
+    for(int i = 0; i < 8; ++i)
+        models.emplace_back(new PacedModel(0.001, Mode::FROM_START));
+
+    sim::PacedTimeServer<sim::ParallelTimeServer> server(&pool, 1);
+    for(auto &m : models)
+        server.registerModel(m.get());
+
+    // run endlessly in real time until stopped
+    std::thread stopper([&server] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        server.stop();
+    });
+
+    auto end = server.run(0.0, INFINITY);
+    stopper.join();
+
+    EXPECT_GT(end, 0.04);
+    EXPECT_LT(end, 0.5);
+
+    for(auto &m : models)
+        EXPECT_EQ(models.front()->times.size(), m->times.size());
+
+}
@@ -0,0 +1,118 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/ParallelTimeServer.h>
+#include <memory>
+#include <vector>
+
+
+class IntegratorModel : public sim::Model<double> {
+
+public:
+
+    double x = 0.0;
+    double seed = 0.0;
+
+    void reset() override {
+
+        x = seed;
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        // some non-trivial, order dependent calculation (the first step size is infinite)
+        for(int i = 0; i < 10; ++i)
+            x = std::sin(x + simTime) + 0.5 * std::min(1.0, timeStepSize);
+
+        return true;
+
+    }
+
+};
+
+
+/**
+ * Runs a simulation with the given time server and returns the final model states
+ * @param server Time server
+ * @return States of the models
+ */
+std::vector<double> runSimulation(sim::TimeServer &server) {
+
+    const double stepSizes[] = {0.001, 0.01, 0.1};
+
+    std::vector<std::unique_ptr<IntegratorModel>> models{};
+    for(size_t i = 0; i < 500; ++i) {
+
+        models.emplace_back(new IntegratorModel);
+        models.back()->seed = 0.001 * (double) i;
+        models.back()->create();
+        models.back()->setTimeStepSize(stepSizes[i % 3]);
+        models.back()->initialize(0.0);
+
+        server.registerModel(models.back().get());
+
+    }
+
+    // run
+    unsigned long steps = 0;
+    for(unsigned int i = 0; i < 1000; ++i)
+        steps += server.step(0.001 * i);
+
+    // check steps
+    EXPECT_EQ(167 * 1000 + 167 * 100 + 166 * 10, steps);
+
+    // collect states
+    std::vector<double> states{};
+    for(auto &m : models) {
+        states.push_back(m->x);
+        EXPECT_EQ(sim::Model<double>::ModelState::RUNNING, m->getModelState());
+    }
+
+    return states;
+
+}
+
+
+TEST(ParallelTimeServerTest, Deterministic) {
+
+    // sequential reference
+    sim::TimeServer reference{};
+    auto expected = runSimulation(reference);
+
+    // parallel
+    for(size_t threads : {1, 2, 4, 7}) {
+
+        parallel::ThreadPool pool(threads);
+        sim::ParallelTimeServer server(&pool);
+
+        EXPECT_EQ(expected, runSimulation(server));
+
+    }
+
+    // pool needed
+    EXPECT_THROW(sim::ParallelTimeServer(nullptr), std::invalid_argument);
+
+}
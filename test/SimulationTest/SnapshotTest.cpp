@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/Snapshot.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <cstdio>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+class VehicleModel : public sim::Model<double>, public models::LongitudinalModel {
+
+public:
+
+    double pedal = 0.0;
+
+    void reset() override {
+
+        *_data = 0.0;
+        setState(models::State{});
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        modelStep(pedal, std::min(1.0, timeStepSize));
+        *_data += 1.0;
+
+        return true;
+
+    }
+
+    double getData() const {
+
+        return *_data;
+
+    }
+
+    void saveState(sim::SnapshotWriter &writer) const override {
+
+        sim::Model<double>::saveState(writer);
+        writer.write(state);
+
+    }
+
+    void loadState(sim::SnapshotReader &reader) override {
+
+        sim::Model<double>::loadState(reader);
+        reader.read(state);
+
+    }
+
+};
+
+
+class SnapshotTest : public ::testing::Test {
+
+protected:
+
+    std::vector<std::unique_ptr<VehicleModel>> _models{};
+    std::vector<std::string> _files{};
+
+    void SetUp() override {
+
+        createModels();
+
+    }
+
+    void createModels() {
+
+        _models.clear();
+        for(size_t i = 0; i < 50; ++i) {
+
+            _models.emplace_back(new VehicleModel);
+            auto &m = _models.back();
+
+            m->create();
+            m->setIDAndName("vehicle-" + std::to_string(i), "Vehicle");
+            m->setTimeStepSize(0.01 * (double) (i % 5 + 1));
+            m->initialize(0.0);
+            m->pedal = 0.01 * (double) i;
+
+        }
+
+    }
+
+    void TearDown() override {
+
+        for(auto &f : _files)
+            std::remove(f.c_str());
+
+    }
+
+    std::string file(const std::string &name) {
+
+        _files.push_back("SnapshotTest-" + name + ".bin");
+        return _files.back();
+
+    }
+
+    void run(double from, double to) {
+
+        for(double t = from; t < to - 1e-9; t += 0.01) {
+            for(auto &m : _models)
+                m->simStep(t);
+        }
+
+    }
+
+    std::vector<double> fingerprint() const {
+
+        std::vector<double> values{};
+        for(auto &m : _models) {
+            values.push_back(m->getState().v);
+            values.push_back(m->getState().s);
+            values.push_back(m->getData());
+            values.push_back(m->getNextStepTime());
+        }
+
+        return values;
+
+    }
+
+};
+
+
+TEST_F(SnapshotTest, SaveAndRestore) {
+
+    parallel::ThreadPool pool(3);
+
+    for(auto p : {(parallel::ThreadPool *) nullptr, &pool}) {
+
+        createModels();
+
+        sim::Snapshot snapshot(p);
+        for(auto &m : _models)
+            snapshot.registerModel(m.get());
+
+        EXPECT_EQ(_models.size(), snapshot.size());
+        EXPECT_THROW(snapshot.registerModel(nullptr), std::invalid_argument);
+
+        // full snapshot
+        run(0.0, 1.0);
+        auto expected = fingerprint();
+        EXPECT_EQ(_models.size(), snapshot.save(file("full")));
+
+        for(auto &m : _models)
+            EXPECT_FALSE(m->isDirty());
+
+        // continue and restore
+        run(1.0, 2.0);
+        EXPECT_NE(expected, fingerprint());
+
+        EXPECT_EQ(_models.size(), snapshot.load(file("full")));
+        EXPECT_EQ(expected, fingerprint());
+        EXPECT_EQ("vehicle-7", _models[7]->getID());
+
+        // the restored simulation continues identically
+        run(1.0, 2.0);
+        auto continued = fingerprint();
+
+        snapshot.load(file("full"));
+        run(1.0, 2.0);
+        EXPECT_EQ(continued, fingerprint());
+
+    }
+
+}
+
+
+TEST_F(SnapshotTest, Incremental) {
+
+    sim::Snapshot snapshot{};
+    for(auto &m : _models)
+        snapshot.registerModel(m.get());
+
+    // base
+    run(0.0, 1.0);
+    snapshot.save(file("base"));
+
+    // no changes, no records
+    EXPECT_EQ(0, snapshot.save(file("empty"), true));
+
+    // only some models change
+    for(size_t i = 0; i < _models.size(); i += 4)
+        _models[i]->setDirty(true);
+
+    for(size_t i = 1; i < _models.size(); i += 4)
+        EXPECT_TRUE(_models[i]->simStep(1.5));
+
+    auto expected = fingerprint();
+    EXPECT_EQ(26, snapshot.save(file("delta"), true));
+
+    // restore base and delta
+    run(1.0, 2.0);
+
+    EXPECT_EQ(_models.size(), snapshot.load(file("base")));
+    EXPECT_EQ(0, snapshot.load(file("empty")));
+    EXPECT_EQ(26, snapshot.load(file("delta")));
+    EXPECT_EQ(expected, fingerprint());
+
+}
+
+
+TEST_F(SnapshotTest, Errors) {
+
+    sim::Snapshot snapshot{};
+    for(auto &m : _models)
+        snapshot.registerModel(m.get());
+
+    snapshot.save(file("full"));
+
+    // missing file
+    EXPECT_THROW(snapshot.load(file("missing")), std::runtime_error);
+
+    // other models
+    sim::Snapshot other{};
+    other.registerModel(_models[0].get());
+    EXPECT_THROW(other.load(file("full")), std::runtime_error);
+
+    // not a snapshot
+    {
+        memory::MappedFile f(file("invalid"), 64);
+        std::memset(f.data(), 1, f.size());
+    }
+
+    EXPECT_THROW(snapshot.load(file("invalid")), std::runtime_error);
+
+}
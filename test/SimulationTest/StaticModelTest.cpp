@@ -0,0 +1,278 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/Model.h>
+#include <simulation/StaticModel.h>
+#include <simulation/StaticModelSet.h>
+#include <string>
+#include <vector>
+
+
+namespace {
+
+    // integrates the input with the time step size
+    class StaticIntegrator : public sim::StaticModel<StaticIntegrator, double> {
+
+    public:
+
+        double input = 1.0;
+        std::vector<double> times{};
+
+        void reset() {
+
+            _data = 0.0;
+            times.clear();
+
+        }
+
+        bool step(double simTime, double timeStepSize) {
+
+            if(!times.empty())
+                _data += input * timeStepSize;
+
+            times.push_back(simTime);
+            return true;
+
+        }
+
+    };
+
+
+    // the same as virtual model
+    class VirtualIntegrator : public sim::Model<double> {
+
+    public:
+
+        std::vector<double> times{};
+
+        void reset() override {
+
+            *_data = 0.0;
+            times.clear();
+
+        }
+
+        bool step(double simTime, double timeStepSize) override {
+
+            if(!times.empty())
+                *_data += timeStepSize;
+
+            times.push_back(simTime);
+            return true;
+
+        }
+
+    };
+
+
+    // doubles the value of the integrator
+    class StaticGain : public sim::StaticModel<StaticGain, double> {
+
+    public:
+
+        const StaticIntegrator *source = nullptr;
+
+        void reset() {
+
+            _data = 0.0;
+
+        }
+
+        bool step(double, double) {
+
+            _data = 2.0 * source->getData();
+            return true;
+
+        }
+
+    };
+
+
+    // counts its steps with the integer time base
+    class StaticTickCounter : public sim::StaticModel<StaticTickCounter, unsigned long, sim::Ticks> {
+
+    public:
+
+        void reset() {
+
+            _data = 0;
+
+        }
+
+        bool step(sim::Ticks, sim::Ticks) {
+
+            _data++;
+            return true;
+
+        }
+
+    };
+
+}
+
+
+TEST(StaticModelTest, Lifecycle) {
+
+    using State = StaticIntegrator::ModelState;
+
+    StaticIntegrator model{};
+
+    // check errors
+    EXPECT_THROW(model.setStartExecutionTime(0.0), std::runtime_error);
+    EXPECT_THROW(model.setTimeStepSize(0.1), std::runtime_error);
+    EXPECT_THROW(model.initialize(0.0), std::runtime_error);
+    EXPECT_THROW(model.simStep(0.0), std::runtime_error);
+    EXPECT_THROW(model.terminate(0.0), std::runtime_error);
+    EXPECT_THROW(model.destroy(), std::runtime_error);
+
+    EXPECT_TRUE(model.create());
+    EXPECT_THROW(model.create(), std::runtime_error);
+    EXPECT_EQ(State::CREATED, model.getModelState());
+
+    model.setIDAndName("integrator-1", "Integrator");
+    EXPECT_EQ("integrator-1", model.getID());
+    EXPECT_EQ("Integrator", model.getName());
+
+    model.setTimeStepSize(0.1);
+    model.setStartExecutionTime(1.0);
+    EXPECT_TRUE(model.initialize(0.0));
+    EXPECT_EQ(State::INITIALIZED, model.getModelState());
+    EXPECT_THROW(model.setTimeStepSize(0.2), std::runtime_error);
+
+    // not before the start time
+    EXPECT_FALSE(model.simStep(0.5));
+    EXPECT_TRUE(model.simStep(1.0));
+    EXPECT_FALSE(model.simStep(1.05));
+    EXPECT_TRUE(model.simStep(1.1));
+    EXPECT_EQ(State::RUNNING, model.getModelState());
+    EXPECT_NEAR(0.1, model.getData(), 1e-12);
+
+    // inactive models are not stepped
+    model.deactivate();
+    EXPECT_FALSE(model.simStep(1.2));
+    model.activate();
+    EXPECT_TRUE(model.simStep(1.2));
+    EXPECT_DOUBLE_EQ(0.0, model.getData());
+
+    EXPECT_THROW(model.destroy(), std::runtime_error);
+    EXPECT_TRUE(model.terminate(1.3));
+    EXPECT_TRUE(model.destroy());
+    EXPECT_EQ(State::DESTROYED, model.getModelState());
+
+}
+
+
+TEST(StaticModelTest, EqualsVirtualModel) {
+
+    using Mode = sim::Model<double>::TimeTrackingOriginMode;
+    using StaticMode = StaticIntegrator::TimeTrackingOriginMode;
+
+    for(auto fromStart : {false, true}) {
+
+        StaticIntegrator s{};
+        VirtualIntegrator v{};
+
+        s.create();
+        s.setTimeTrackingOriginMode(fromStart ? StaticMode::FROM_START : StaticMode::FROM_LAST_STEP);
+        s.setTimeStepSize(0.003);
+        s.setStartExecutionTime(0.01);
+        s.initialize(0.0);
+
+        v.create();
+        v.setTimeTrackingOriginMode(fromStart ? Mode::FROM_START : Mode::FROM_LAST_STEP);
+        v.setTimeStepSize(0.003);
+        v.setStartExecutionTime(0.01);
+        v.initialize(0.0);
+
+        for(int i = 0; i < 1000; ++i) {
+            double time = 0.001 * i;
+            EXPECT_EQ(v.simStep(time), s.simStep(time));
+            EXPECT_EQ(v.getNextStepTime(), s.getNextStepTime());
+        }
+
+        EXPECT_EQ(v.times, s.times);
+
+    }
+
+}
+
+
+TEST(StaticModelTest, ModelSet) {
+
+    sim::StaticModelSet<StaticIntegrator, StaticGain> set{};
+    EXPECT_EQ(2, set.size());
+
+    set.create();
+
+    auto &integrator = set.get<StaticIntegrator>();
+    auto &gain = set.get<1>();
+
+    integrator.setTimeStepSize(0.01);
+    gain.setTimeStepSize(0.02);
+    gain.source = &integrator;
+
+    set.initialize(0.0);
+
+    // the models are stepped in order
+    unsigned long steps = 0;
+    for(int i = 0; i <= 100; ++i)
+        steps += set.simStep(0.01 * i);
+
+    EXPECT_EQ(101 + 51, steps);
+    EXPECT_NEAR(1.0, integrator.getData(), 1e-9);
+    EXPECT_NEAR(2.0, gain.getData(), 1e-9);
+    EXPECT_NEAR(1.01, set.getNextStepTime(), 1e-9);
+
+    // the names of all models
+    std::vector<std::string> names{};
+    integrator.setIDAndName("a", "A");
+    gain.setIDAndName("b", "B");
+    set.forEach([&names](auto &model) { names.push_back(model.getName()); });
+    EXPECT_EQ((std::vector<std::string>{"A", "B"}), names);
+
+    set.terminate(1.0);
+    set.destroy();
+    EXPECT_EQ(StaticGain::ModelState::DESTROYED, gain.getModelState());
+
+}
+
+
+TEST(StaticModelTest, TickTimeBase) {
+
+    using namespace std::chrono;
+
+    sim::StaticModelSet<StaticTickCounter> set{};
+    set.create();
+    set.get<0>().setTimeStepSize(milliseconds(1));
+    set.initialize(sim::Ticks(0));
+
+    auto start = hours(24 * 100);
+    for(int i = 0; i < 10000; ++i)
+        set.simStep(start + i * milliseconds(1));
+
+    EXPECT_EQ(10000, set.get<0>().getData());
+    EXPECT_EQ(start + milliseconds(10000), set.getNextStepTime());
+
+}
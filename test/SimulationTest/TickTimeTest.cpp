@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/ParallelTimeServer.h>
+#include <simulation/TimeServer.h>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+using sim::Ticks;
+using Mode = sim::Model<double>::TimeTrackingOriginMode;
+using namespace std::chrono;
+
+
+namespace {
+
+    template<typename Time>
+    class StepCountingModel : public sim::Model<double, Time> {
+
+    public:
+
+        std::vector<Time> times{};
+        std::vector<Time> stepSizes{};
+
+        StepCountingModel(Time timeStepSize, Time startTime, Mode mode) {
+
+            this->create();
+            this->setTimeTrackingOriginMode(static_cast<typename sim::Model<double, Time>::TimeTrackingOriginMode>(mode));
+            this->setTimeStepSize(timeStepSize);
+            this->setStartExecutionTime(startTime);
+            this->initialize(startTime);
+
+        }
+
+        void reset() override {
+
+            times.clear();
+            stepSizes.clear();
+
+        }
+
+        bool step(Time simTime, Time timeStepSize) override {
+
+            times.push_back(simTime);
+            stepSizes.push_back(timeStepSize);
+            return true;
+
+        }
+
+    };
+
+}
+
+
+TEST(TickTimeTest, Traits) {
+
+    using Traits = sim::TimeTraits<Ticks>;
+
+    EXPECT_EQ(milliseconds(1), Traits::fromSeconds(0.001));
+    EXPECT_EQ(nanoseconds(1), Traits::fromSeconds(1e-9));
+    EXPECT_DOUBLE_EQ(86400.0 * 365.0, Traits::toSeconds(hours(24 * 365)));
+    EXPECT_EQ(hours(1), Traits::steps(milliseconds(1), 3600000));
+    EXPECT_TRUE(Traits::reached(milliseconds(3), milliseconds(3)));
+    EXPECT_FALSE(Traits::reached(milliseconds(3) - nanoseconds(1), milliseconds(3)));
+    EXPECT_EQ(Traits::infinity(), Traits::difference(seconds(1), Traits::never()));
+
+}
+
+
+TEST(TickTimeTest, ExactAfterLongRun) {
+
+    // start after 100 days, where the resolution of the floating point time (2e-9 s) exceeds its epsilon
+    auto start = hours(24 * 100);
+    constexpr int STEPS = 20000;
+
+    StepCountingModel<Ticks> fromStart(milliseconds(1), start, Mode::FROM_START);
+    StepCountingModel<Ticks> fromLastStep(milliseconds(1), start, Mode::FROM_LAST_STEP);
+    StepCountingModel<Ticks> slow(milliseconds(7), start, Mode::FROM_LAST_STEP);
+
+    sim::TickTimeServer server{};
+    server.registerModel(&fromStart);
+    server.registerModel(&fromLastStep);
+    server.registerModel(&slow);
+
+    EXPECT_EQ(start, server.getNextStepTime());
+
+    for(int k = 0; k <= STEPS; ++k)
+        server.step(start + k * milliseconds(1));
+
+    // every step is executed exactly at its time
+    ASSERT_EQ(STEPS + 1, fromStart.times.size());
+    ASSERT_EQ(STEPS + 1, fromLastStep.times.size());
+    ASSERT_EQ(STEPS / 7 + 1, slow.times.size());
+
+    for(int k = 1; k <= STEPS; ++k) {
+        ASSERT_EQ(start + k * milliseconds(1), fromLastStep.times[k]);
+        ASSERT_EQ(milliseconds(1), fromLastStep.stepSizes[k]);
+    }
+
+    EXPECT_EQ(start + milliseconds(7 * (STEPS / 7)), slow.times.back());
+    EXPECT_EQ(fromStart.times, fromLastStep.times);
+
+    // the first step has no predecessor
+    EXPECT_EQ(Ticks::max(), fromStart.stepSizes.front());
+
+}
+
+
+TEST(TickTimeTest, FloatingPointTimeDrifts) {
+
+    // the same setup with the floating point time base misses steps tracked from the last step
+    double start = 86400.0 * 100.0;
+    constexpr int STEPS = 20000;
+
+    StepCountingModel<double> fromLastStep(0.001, start, Mode::FROM_LAST_STEP);
+
+    sim::TimeServer server{};
+    server.registerModel(&fromLastStep);
+
+    for(int k = 0; k <= STEPS; ++k)
+        server.step(start + k * 0.001);
+
+    EXPECT_LT(fromLastStep.times.size(), STEPS + 1);
+
+}
+
+
+TEST(TickTimeTest, Parallel) {
+
+    parallel::ThreadPool pool(2);
+
+    std::vector<std::unique_ptr<StepCountingModel<Ticks>>> models{};
+    for(int i = 0; i < 16; ++i)
+        models.emplace_back(new StepCountingModel<Ticks>(microseconds(100 * (i % 4 + 1)), Ticks(0),
+                Mode::FROM_LAST_STEP));
+
+    sim::ParallelTickTimeServer server(&pool, 1);
+    for(auto &m : models)
+        server.registerModel(m.get());
+
+    for(int k = 0; k <= 1200; ++k)
+        server.step(k * microseconds(100));
+
+    for(int i = 0; i < 16; ++i)
+        EXPECT_EQ(1200 / (i % 4 + 1) + 1, models[i]->times.size()) << i;
+
+}
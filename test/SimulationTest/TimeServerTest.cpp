@@ -0,0 +1,165 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <simulation/TimeServer.h>
+
+
+class CountingModel : public sim::Model<double> {
+
+public:
+
+    std::vector<double> times{};
+    std::vector<std::pair<size_t, double>> *log = nullptr;
+    size_t index = 0;
+
+    void reset() override {
+
+        times.clear();
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        times.push_back(simTime);
+
+        if(log != nullptr)
+            log->emplace_back(index, simTime);
+
+        return true;
+
+    }
+
+};
+
+
+void setupModel(CountingModel &model, double timeStepSize, double startTime,
+        sim::Model<double>::TimeTrackingOriginMode mode) {
+
+    model.create();
+    model.setTimeTrackingOriginMode(mode);
+    model.setTimeStepSize(timeStepSize);
+    model.setStartExecutionTime(startTime);
+    model.initialize(0.0);
+
+}
+
+
+TEST(TimeServerTest, EqualsPolling) {
+
+    using Mode = sim::Model<double>::TimeTrackingOriginMode;
+
+    // model configurations
+    std::vector<double> stepSizes{0.001, 0.01, 0.1, 0.01, 0.003};
+    std::vector<double> startTimes{0.0, 0.0, 0.5, 0.205, 0.0};
+    std::vector<Mode> modes{Mode::FROM_START, Mode::FROM_LAST_STEP, Mode::FROM_START, Mode::FROM_START,
+                            Mode::FROM_LAST_STEP};
+
+    // models
+    std::vector<CountingModel> polled(stepSizes.size());
+    std::vector<CountingModel> scheduled(stepSizes.size());
+    std::vector<std::pair<size_t, double>> pollLog{};
+    std::vector<std::pair<size_t, double>> scheduleLog{};
+
+    // time server
+    sim::TimeServer server{};
+
+    // setup models
+    for(size_t i = 0; i < stepSizes.size(); ++i) {
+
+        setupModel(polled[i], stepSizes[i], startTimes[i], modes[i]);
+        setupModel(scheduled[i], stepSizes[i], startTimes[i], modes[i]);
+
+        polled[i].log = &pollLog;
+        polled[i].index = i;
+        scheduled[i].log = &scheduleLog;
+        scheduled[i].index = i;
+
+        server.registerModel(&scheduled[i]);
+
+    }
+
+    EXPECT_EQ(stepSizes.size(), server.size());
+
+    // run
+    unsigned long pollSteps = 0;
+    unsigned long scheduleSteps = 0;
+    for(unsigned int i = 0; i < 2000; ++i) {
+
+        double time = 0.001 * i;
+
+        for(auto &m : polled)
+            pollSteps += m.simStep(time) ? 1 : 0;
+
+        scheduleSteps += server.step(time);
+
+    }
+
+    // check
+    EXPECT_EQ(pollSteps, scheduleSteps);
+    EXPECT_EQ(pollLog, scheduleLog);
+
+    for(size_t i = 0; i < polled.size(); ++i)
+        EXPECT_EQ(polled[i].times, scheduled[i].times);
+
+}
+
+
+TEST(TimeServerTest, ActivationAndCatchUp) {
+
+    using Mode = sim::Model<double>::TimeTrackingOriginMode;
+
+    CountingModel model{};
+    setupModel(model, 0.1, 0.0, Mode::FROM_START);
+
+    sim::TimeServer server{};
+    server.registerModel(&model);
+
+    // catch up delayed steps one by one
+    EXPECT_EQ(1, server.step(0.0));
+    EXPECT_EQ(1, server.step(0.35));
+    EXPECT_EQ(1, server.step(0.35));
+    EXPECT_EQ(1, server.step(0.35));
+    EXPECT_EQ(0, server.step(0.35));
+    EXPECT_DOUBLE_EQ(0.4, server.getNextStepTime());
+
+    // inactive models are not stepped
+    model.deactivate();
+    EXPECT_EQ(0, server.step(0.4));
+    EXPECT_EQ(0, server.step(0.5));
+
+    // activation is picked up instantly
+    model.activate();
+    EXPECT_EQ(1, server.step(0.55));
+    EXPECT_EQ(1u, model.times.size());
+
+    // activation resets the step counter, which requires a re-scheduling
+    model.activate();
+    server.reschedule();
+    EXPECT_DOUBLE_EQ(0.0, server.getNextStepTime());
+
+    // null pointer
+    EXPECT_THROW(server.registerModel(nullptr), std::invalid_argument);
+
+}
@@ -0,0 +1,141 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <stats/AtomicHistogram.h>
+#include <stats/Histogram.h>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using stats::AtomicHistogram;
+using stats::Histogram;
+
+
+TEST(AtomicHistogramTest, SnapshotEqualsHistogram) {
+
+    AtomicHistogram atomic(5);
+    Histogram histogram(5);
+
+    std::mt19937_64 generator(42);
+    std::lognormal_distribution<double> distribution(8.0, 1.5);
+
+    for(int i = 0; i < 10000; ++i) {
+        auto value = (uint64_t) distribution(generator);
+        atomic.record(value);
+        histogram.record(value);
+    }
+
+    auto snapshot = atomic.snapshot();
+
+    EXPECT_EQ(10000, atomic.count());
+    EXPECT_EQ(histogram.count(), snapshot.count());
+    EXPECT_EQ(histogram.min(), snapshot.min());
+    EXPECT_EQ(histogram.max(), snapshot.max());
+    EXPECT_DOUBLE_EQ(histogram.mean(), snapshot.mean());
+
+    for(double p : {0.0, 10.0, 50.0, 90.0, 99.0, 99.9, 100.0})
+        EXPECT_EQ(histogram.percentile(p), snapshot.percentile(p));
+
+}
+
+
+TEST(AtomicHistogramTest, HighestValue) {
+
+    EXPECT_THROW(AtomicHistogram(0), std::invalid_argument);
+    EXPECT_THROW(AtomicHistogram(4, 15), std::invalid_argument);
+
+    AtomicHistogram histogram(4, 1000);
+    histogram.record(10);
+    histogram.record(1000000);
+
+    // large values are counted in the highest bucket (upper bound 1023), the maximum is exact
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(2, snapshot.count());
+    EXPECT_EQ(1000000, snapshot.max());
+    EXPECT_EQ(10, snapshot.percentile(50.0));
+    EXPECT_EQ(1023, snapshot.percentile(100.0));
+
+    uint64_t highest = 0;
+    snapshot.forEach([&highest](uint64_t lower, uint64_t, uint64_t) {
+        highest = lower;
+    });
+
+    EXPECT_LE(highest, 1000);
+
+}
+
+
+TEST(AtomicHistogramTest, Reset) {
+
+    AtomicHistogram histogram(3);
+    histogram.record(5);
+    histogram.reset();
+
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(0, snapshot.count());
+    EXPECT_EQ(0, snapshot.min());
+    EXPECT_EQ(0, snapshot.max());
+
+    histogram.record(7);
+    EXPECT_EQ(7, histogram.snapshot().min());
+
+}
+
+
+TEST(AtomicHistogramTest, ConcurrentRecording) {
+
+    const int threads = 4;
+    const uint64_t values = 100000;
+
+    AtomicHistogram histogram(5);
+
+    // the threads record different values, a reader takes snapshots at the same time
+    std::vector<std::thread> writers{};
+    for(int t = 0; t < threads; ++t) {
+        writers.emplace_back([&histogram, t, values]() {
+            for(uint64_t i = 0; i < values; ++i)
+                histogram.record(i % 1000 + (uint64_t) t * 1000);
+        });
+    }
+
+    uint64_t last = 0;
+    for(int i = 0; i < 100; ++i) {
+        auto count = histogram.snapshot().count();
+        EXPECT_GE(count, last);
+        last = count;
+    }
+
+    for(auto &w : writers)
+        w.join();
+
+    auto snapshot = histogram.snapshot();
+    EXPECT_EQ(threads * values, snapshot.count());
+    EXPECT_EQ(0, snapshot.min());
+    EXPECT_EQ(threads * 1000 - 1, snapshot.max());
+    EXPECT_DOUBLE_EQ((threads * 1000 - 1) / 2.0, snapshot.mean());
+
+}
@@ -0,0 +1,135 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <stats/Histogram.h>
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+using stats::Histogram;
+
+
+TEST(HistogramTest, SmallValuesAreExact) {
+
+    Histogram histogram(4);
+
+    for(uint64_t v = 0; v < 16; ++v)
+        histogram.record(v);
+
+    EXPECT_EQ(16, histogram.count());
+    EXPECT_EQ(0, histogram.min());
+    EXPECT_EQ(15, histogram.max());
+    EXPECT_DOUBLE_EQ(7.5, histogram.mean());
+    EXPECT_EQ(7, histogram.percentile(50.0));
+    EXPECT_EQ(15, histogram.percentile(100.0));
+    EXPECT_EQ(0, histogram.percentile(0.0));
+
+    size_t buckets = 0;
+    histogram.forEach([&buckets](uint64_t lower, uint64_t upper, uint64_t count) {
+        EXPECT_EQ(lower, upper);
+        EXPECT_EQ(1, count);
+        ++buckets;
+    });
+
+    EXPECT_EQ(16, buckets);
+
+}
+
+
+TEST(HistogramTest, BucketsCoverAllValues) {
+
+    Histogram histogram(5);
+
+    // the buckets are adjacent and the values are in their bucket
+    uint64_t next = 0;
+    histogram.record(0);
+    histogram.record(UINT64_MAX);
+    for(int shift = 0; shift < 64; ++shift)
+        histogram.record((uint64_t(1) << shift) + 3);
+
+    histogram.forEach([&next](uint64_t lower, uint64_t upper, uint64_t) {
+        EXPECT_GE(lower, next);
+        EXPECT_LE(lower, upper);
+        next = upper + 1;
+    });
+
+    EXPECT_EQ(0, next);     // the last bucket ends at the maximum value
+    EXPECT_EQ(66, histogram.count());
+
+}
+
+
+TEST(HistogramTest, PercentilesHaveBoundedError) {
+
+    Histogram histogram(5);
+
+    std::mt19937_64 random(42);
+    std::lognormal_distribution<double> distribution(10.0, 1.5);
+
+    std::vector<uint64_t> values{};
+    for(int i = 0; i < 100000; ++i) {
+        values.push_back((uint64_t) distribution(random));
+        histogram.record(values.back());
+    }
+
+    std::sort(values.begin(), values.end());
+
+    for(double p : {1.0, 50.0, 90.0, 99.0, 99.9}) {
+        auto exact = (double) values[(size_t) (p / 100.0 * (double) values.size()) - 1];
+        EXPECT_NEAR(exact, (double) histogram.percentile(p), exact / 32.0 + 1.0) << p;
+    }
+
+    EXPECT_EQ(values.back(), histogram.percentile(100.0));
+    EXPECT_EQ(values.front(), histogram.min());
+
+}
+
+
+TEST(HistogramTest, Merge) {
+
+    Histogram a, b, c;
+
+    for(uint64_t v = 0; v < 1000; ++v) {
+        (v % 2 == 0 ? a : b).record(v * 7);
+        c.record(v * 7);
+    }
+
+    a.merge(b);
+
+    EXPECT_EQ(c.count(), a.count());
+    EXPECT_EQ(c.min(), a.min());
+    EXPECT_EQ(c.max(), a.max());
+    EXPECT_DOUBLE_EQ(c.mean(), a.mean());
+    EXPECT_EQ(c.percentile(99.0), a.percentile(99.0));
+
+    EXPECT_THROW(a.merge(Histogram(3)), std::invalid_argument);
+
+    a.reset();
+    EXPECT_EQ(0, a.count());
+    EXPECT_EQ(0, a.percentile(50.0));
+
+}
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <sweep/Runner.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+
+class RunnerTest : public ::testing::Test {
+
+protected:
+
+    sweep::Definition _definition{};
+    std::string _path = "RunnerTest.col";
+
+    void SetUp() override {
+
+        _definition.kP = sweep::Range{0.005, 0.05, 5};
+        _definition.kI = sweep::Range{0.0005, 0.005, 3};
+        _definition.mass = sweep::Range{1000.0, 2000.0, 3};
+        _definition.duration = 10.0;
+
+    }
+
+    void TearDown() override {
+
+        std::remove(_path.c_str());
+
+    }
+
+};
+
+
+TEST_F(RunnerTest, AllRunsOnce) {
+
+    parallel::ThreadPool pool(3);
+
+    for(auto p : std::vector<parallel::ThreadPool *>{nullptr, &pool}) {
+
+        sweep::Runner runner(_definition, p, 4);
+        std::vector<int> count(_definition.size(), 0);
+
+        auto n = runner.run([this, &count](size_t first, const sweep::Scenario *s, const sweep::Metrics *m, size_t n) {
+
+            EXPECT_LE(n, 4);
+            for(size_t j = 0; j < n; ++j) {
+
+                count[first + j]++;
+
+                auto reference = sweep::simulate(_definition.at(first + j), _definition);
+                EXPECT_DOUBLE_EQ(_definition.at(first + j).kP, s[j].kP);
+                EXPECT_DOUBLE_EQ(reference.steadyStateError, m[j].steadyStateError);
+
+            }
+
+        });
+
+        EXPECT_EQ(45, n);
+        for(auto c : count)
+            EXPECT_EQ(1, c);
+
+    }
+
+}
+
+
+TEST_F(RunnerTest, ColumnFile) {
+
+    parallel::ThreadPool pool(2);
+    sweep::Runner runner(_definition, &pool, 8);
+
+    EXPECT_EQ(45, runner.run(_path));
+
+    sweep::ColumnReader reader(_path);
+    EXPECT_EQ(sweep::Runner::columns(), reader.names());
+    ASSERT_EQ(45, reader.rows());
+
+    // blocks arrive in any order, every run is contained once
+    auto runs = reader.column("run");
+    std::sort(runs.begin(), runs.end());
+    for(size_t i = 0; i < runs.size(); ++i)
+        EXPECT_DOUBLE_EQ((double) i, runs[i]);
+
+    // the values belong to the run
+    for(size_t i = 0; i < reader.rows(); ++i) {
+
+        auto index = (size_t) reader.column("run")[i];
+        auto s = _definition.at(index);
+        auto m = sweep::simulate(s, _definition);
+
+        EXPECT_DOUBLE_EQ(s.kP, reader.column("kP")[i]);
+        EXPECT_DOUBLE_EQ(s.kI, reader.column("kI")[i]);
+        EXPECT_DOUBLE_EQ(s.mass, reader.column("mass")[i]);
+        EXPECT_DOUBLE_EQ(m.overshoot, reader.column("overshoot")[i]);
+        EXPECT_DOUBLE_EQ(m.steadyStateError, reader.column("steadyStateError")[i]);
+
+    }
+
+    EXPECT_THROW(reader.column("unknown"), std::out_of_range);
+
+}
+
+
+TEST_F(RunnerTest, Errors) {
+
+    EXPECT_THROW(sweep::Runner(_definition, nullptr, 0), std::invalid_argument);
+    EXPECT_THROW(sweep::ColumnReader("RunnerTest.missing"), std::runtime_error);
+
+    sweep::ColumnWriter writer(_path, {"a", "b"});
+    double values[] = {1.0, 2.0};
+    EXPECT_THROW(writer.write({values}, 2), std::invalid_argument);
+
+    // not a column file
+    std::ofstream(_path) << "something else";
+    EXPECT_THROW(sweep::ColumnReader reader(_path), std::runtime_error);
+
+}
@@ -0,0 +1,143 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <sweep/Sweep.h>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+
+TEST(SweepTest, Range) {
+
+    auto r = sweep::Range::parse("1.0:2.0:5");
+    EXPECT_DOUBLE_EQ(1.0, r.begin);
+    EXPECT_DOUBLE_EQ(2.0, r.end);
+    EXPECT_EQ(5, r.steps);
+    EXPECT_DOUBLE_EQ(1.0, r.at(0));
+    EXPECT_DOUBLE_EQ(1.25, r.at(1));
+    EXPECT_DOUBLE_EQ(2.0, r.at(4));
+
+    auto v = sweep::Range::parse("3.5");
+    EXPECT_EQ(1, v.steps);
+    EXPECT_DOUBLE_EQ(3.5, v.at(0));
+
+    EXPECT_THROW(sweep::Range::parse(""), std::invalid_argument);
+    EXPECT_THROW(sweep::Range::parse("1.0:2.0"), std::invalid_argument);
+    EXPECT_THROW(sweep::Range::parse("1.0:2.0:0"), std::invalid_argument);
+    EXPECT_THROW(sweep::Range::parse("a:2.0:3"), std::invalid_argument);
+    EXPECT_THROW(sweep::Range::parse("1.0x"), std::invalid_argument);
+
+}
+
+
+TEST(SweepTest, Definition) {
+
+    sweep::Definition d{};
+    d.kP = sweep::Range{0.0, 1.0, 2};
+    d.mass = sweep::Range{1000.0, 3000.0, 3};
+    d.targetSpeed = sweep::Range{10.0, 20.0, 2};
+
+    ASSERT_EQ(12, d.size());
+
+    // first range changes fastest
+    auto s = d.at(0);
+    EXPECT_DOUBLE_EQ(0.0, s.kP);
+    EXPECT_DOUBLE_EQ(1000.0, s.mass);
+    EXPECT_DOUBLE_EQ(10.0, s.targetSpeed);
+
+    s = d.at(1);
+    EXPECT_DOUBLE_EQ(1.0, s.kP);
+    EXPECT_DOUBLE_EQ(1000.0, s.mass);
+
+    s = d.at(11);
+    EXPECT_DOUBLE_EQ(1.0, s.kP);
+    EXPECT_DOUBLE_EQ(0.001, s.kI);
+    EXPECT_DOUBLE_EQ(3000.0, s.mass);
+    EXPECT_DOUBLE_EQ(5000.0, s.maxTorque);
+    EXPECT_DOUBLE_EQ(20.0, s.targetSpeed);
+
+    EXPECT_THROW(d.at(12), std::out_of_range);
+
+}
+
+
+TEST(SweepTest, Metrics) {
+
+    sweep::Definition d{};
+
+    // default gains settle at the target speed
+    auto m = sweep::simulate(d.at(0), d);
+    EXPECT_FALSE(std::isnan(m.settlingTime));
+    EXPECT_GT(m.settlingTime, 0.0);
+    EXPECT_LT(m.settlingTime, d.duration);
+    EXPECT_GE(m.overshoot, 0.0);
+    EXPECT_LT(m.steadyStateError, d.settlingBand * 20.0);
+
+    // no controller: the vehicle does not move
+    sweep::Scenario off{0.0, 0.0, 0.0, 1300.0, 5000.0, 20.0};
+    m = sweep::simulate(off, d);
+    EXPECT_TRUE(std::isnan(m.settlingTime));
+    EXPECT_DOUBLE_EQ(0.0, m.overshoot);
+    EXPECT_DOUBLE_EQ(20.0, m.steadyStateError);
+
+    // aggressive integral gain overshoots
+    sweep::Scenario aggressive{0.01, 0.05, 0.0, 1300.0, 5000.0, 20.0};
+    EXPECT_GT(sweep::simulate(aggressive, d).overshoot, 0.01);
+
+}
+
+
+TEST(SweepTest, BatchMatchesSingleRuns) {
+
+    sweep::Definition d{};
+    d.kP = sweep::Range{0.005, 0.05, 4};
+    d.kI = sweep::Range{0.0005, 0.02, 3};
+    d.kD = sweep::Range{0.0, 0.001, 2};
+    d.mass = sweep::Range{1000.0, 2000.0, 2};
+    d.duration = 20.0;
+
+    // odd number of runs to cover the remainder of the vector kernels
+    std::vector<sweep::Scenario> scenarios{};
+    for(size_t i = 0; i < d.size() - 1; ++i)
+        scenarios.push_back(d.at(i));
+
+    std::vector<sweep::Metrics> metrics(scenarios.size());
+    sweep::simulate(scenarios.data(), scenarios.size(), d, metrics.data());
+
+    for(size_t i = 0; i < scenarios.size(); ++i) {
+
+        auto m = sweep::simulate(scenarios[i], d);
+
+        EXPECT_EQ(std::isnan(m.settlingTime), std::isnan(metrics[i].settlingTime));
+        if(!std::isnan(m.settlingTime)) {
+            EXPECT_DOUBLE_EQ(m.settlingTime, metrics[i].settlingTime);
+        }
+
+        EXPECT_DOUBLE_EQ(m.overshoot, metrics[i].overshoot);
+        EXPECT_DOUBLE_EQ(m.steadyStateError, metrics[i].steadyStateError);
+
+    }
+
+}
@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <proto/Models.pb.h>
+#include <telemetry/CommandInbox.h>
+#include <telemetry/InProcessBroker.h>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using telemetry::CommandInbox;
+
+
+static std::string command(double pedal) {
+
+    simulation::models::VehicleInput input{};
+    input.set_pedal(pedal);
+
+    return input.SerializeAsString();
+
+}
+
+
+TEST(CommandInboxTest, Parse) {
+
+    size_t unit = 0;
+
+    EXPECT_TRUE(CommandInbox::parse("vehicles", "vehicles/12/input", unit));
+    EXPECT_EQ(12, unit);
+    EXPECT_TRUE(CommandInbox::parse("a/b", "a/b/0/input", unit));
+    EXPECT_EQ(0, unit);
+
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicles/12", unit));
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicles/12/inputs", unit));
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicles//input", unit));
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicles/x/input", unit));
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicle/1/input", unit));
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicles1/1/input", unit));
+    EXPECT_FALSE(CommandInbox::parse("vehicles", "vehicles/12345678901/input", unit));
+
+}
+
+
+TEST(CommandInboxTest, LatestCommandWins) {
+
+    CommandInbox inbox(4);
+    auto start = CommandInbox::Clock::now();
+
+    EXPECT_TRUE(inbox.receive("vehicles/1/input", command(0.25).data(), command(0.25).size(), start));
+    EXPECT_TRUE(inbox.receive("vehicles/1/input", command(0.5).data(), command(0.5).size(), start));
+    EXPECT_TRUE(inbox.post(3, 0.75, start + std::chrono::milliseconds(2)));
+
+    // rejected messages
+    EXPECT_FALSE(inbox.receive("vehicles/4/input", command(1.0).data(), command(1.0).size()));
+    EXPECT_FALSE(inbox.receive("vehicles/2/state", command(1.0).data(), command(1.0).size()));
+    EXPECT_FALSE(inbox.receive("vehicles/2/input", "\xff\xff", 2));
+    EXPECT_FALSE(inbox.post(2, std::nan("")));
+
+    std::map<size_t, std::pair<double, long>> applied{};
+    auto apply = [&applied](size_t unit, double pedal, std::chrono::microseconds latency) {
+        applied[unit] = std::make_pair(pedal, (long) latency.count());
+    };
+
+    EXPECT_EQ(2, inbox.drain(apply, start + std::chrono::milliseconds(5)));
+
+    ASSERT_EQ(2, applied.size());
+    EXPECT_DOUBLE_EQ(0.5, applied[1].first);
+    EXPECT_NEAR(5000, applied[1].second, 1);
+    EXPECT_DOUBLE_EQ(0.75, applied[3].first);
+    EXPECT_NEAR(3000, applied[3].second, 1);
+
+    // the mailboxes are empty now
+    EXPECT_EQ(0, inbox.drain(apply));
+
+    auto s = inbox.statistics();
+    EXPECT_EQ(3, s.received);
+    EXPECT_EQ(2, s.applied);
+    EXPECT_EQ(1, s.superseded);
+    EXPECT_EQ(3, s.malformed);
+    EXPECT_EQ(1, s.unknown);
+
+}
+
+
+TEST(CommandInboxTest, SinglePrecisionPedal) {
+
+    CommandInbox inbox(2);
+
+    // the pedal is rounded to a float, values beyond the float range are rejected
+    EXPECT_TRUE(inbox.post(0, 0.1));
+    EXPECT_FALSE(inbox.post(1, 1e39));
+
+    double pedal = 0.0;
+    EXPECT_EQ(1, inbox.drain([&pedal](size_t, double p, std::chrono::microseconds) { pedal = p; }));
+
+    EXPECT_EQ((double) 0.1f, pedal);
+    EXPECT_NEAR(0.1, pedal, 1e-8);
+    EXPECT_EQ(1, inbox.statistics().malformed);
+
+}
+
+
+TEST(CommandInboxTest, SubscribeToBroker) {
+
+    CommandInbox inbox(100);
+    telemetry::InProcessBroker broker{};
+
+    inbox.subscribe(broker);
+
+    for(size_t i = 0; i < 100; ++i)
+        broker.publish(inbox.topic(i), command(0.01 * (double) i), nullptr);
+
+    broker.publish("vehicles/7/state", command(1.0), nullptr);
+
+    while(broker.delivered() < 101)
+        std::this_thread::yield();
+
+    // all units get their command in one tick
+    std::map<size_t, double> applied{};
+    auto n = inbox.drain([&applied](size_t unit, double pedal, std::chrono::microseconds latency) {
+        EXPECT_GE(latency.count(), 0);
+        applied[unit] = pedal;
+    });
+
+    EXPECT_EQ(100, n);
+    for(size_t i = 0; i < 100; ++i)
+        EXPECT_NEAR(0.01 * (double) i, applied[i], 1e-6);
+
+    EXPECT_EQ(0, inbox.statistics().malformed);
+
+}
+
+
+TEST(CommandInboxTest, ConcurrentPostAndDrain) {
+
+    constexpr size_t UNITS = 16;
+    constexpr int COMMANDS = 20000;
+
+    CommandInbox inbox(UNITS);
+
+    // the producer posts increasing pedal values per unit
+    std::thread producer([&inbox] {
+        for(int k = 1; k <= COMMANDS; ++k)
+            inbox.post((size_t) k % UNITS, (double) k);
+    });
+
+    // the pedal values taken per unit must increase
+    std::vector<double> last(UNITS, 0.0);
+    size_t taken = 0;
+    auto apply = [&last, &taken](size_t unit, double pedal, std::chrono::microseconds) {
+        EXPECT_GT(pedal, last[unit]);
+        last[unit] = pedal;
+        ++taken;
+    };
+
+    while(inbox.statistics().received < COMMANDS)
+        inbox.drain(apply);
+
+    producer.join();
+    inbox.drain(apply);
+
+    // the last command of each unit is taken
+    for(size_t u = 0; u < UNITS; ++u)
+        EXPECT_DOUBLE_EQ((double) (COMMANDS - (COMMANDS - (int) u) % (int) UNITS), last[u]);
+
+    auto s = inbox.statistics();
+    EXPECT_EQ(taken, s.applied);
+    EXPECT_EQ(COMMANDS, s.applied + s.superseded);
+
+}
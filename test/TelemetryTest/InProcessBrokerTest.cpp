@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <telemetry/InProcessBroker.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+TEST(InProcessBrokerTest, Matches) {
+
+    using telemetry::InProcessBroker;
+
+    EXPECT_TRUE(InProcessBroker::matches("vehicles/1", "vehicles/1"));
+    EXPECT_FALSE(InProcessBroker::matches("vehicles/1", "vehicles/12"));
+    EXPECT_FALSE(InProcessBroker::matches("vehicles/12", "vehicles/1"));
+    EXPECT_TRUE(InProcessBroker::matches("vehicles/+", "vehicles/12"));
+    EXPECT_FALSE(InProcessBroker::matches("vehicles/+", "vehicles/12/state"));
+    EXPECT_TRUE(InProcessBroker::matches("vehicles/+/state", "vehicles/12/state"));
+    EXPECT_TRUE(InProcessBroker::matches("vehicles/#", "vehicles/12/state"));
+    EXPECT_TRUE(InProcessBroker::matches("#", "vehicles"));
+    EXPECT_FALSE(InProcessBroker::matches("trucks/#", "vehicles/1"));
+
+}
+
+
+TEST(InProcessBrokerTest, DeliveryAndPause) {
+
+    telemetry::InProcessBroker broker{};
+
+    std::vector<std::string> received{};
+    broker.subscribe("a/+", [&received](const char *topic, const char *payload, size_t size) {
+        received.push_back(std::string(topic) + ":" + std::string(payload, size));
+    });
+
+    std::atomic<int> completed{0};
+    auto completion = [&completed](bool success) { completed += success ? 1 : 0; };
+
+    broker.pause();
+    broker.publish("a/1", "x", completion);
+    broker.publish("b/1", "y", completion);
+    broker.publish("a/2", "z", completion);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    EXPECT_EQ(0, completed);
+
+    broker.resume();
+    while(completed < 3)
+        std::this_thread::yield();
+
+    // delivered in order, only matching topics
+    ASSERT_EQ(2, received.size());
+    EXPECT_EQ("a/1:x", received[0]);
+    EXPECT_EQ("a/2:z", received[1]);
+    EXPECT_EQ(3, broker.delivered());
+
+}
@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <telemetry/InProcessBroker.h>
+#include <telemetry/Publisher.h>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+class PublisherTest : public ::testing::Test {
+
+protected:
+
+    std::mutex _mutex{};
+    std::map<uint32_t, std::vector<double>> _times{};
+    std::vector<size_t> _batchSizes{};
+    std::vector<std::string> _topics{};
+    bool _topicPerVehicle = true;
+
+    // destroyed first, since the subscription uses the members above
+    telemetry::InProcessBroker _broker{};
+
+    void SetUp() override {
+
+        // decode the batches
+        _broker.subscribe("vehicles/#", [this](const char *topic, const char *payload, size_t size) {
+
+            simulation::models::VehicleStateBatch batch{};
+            ASSERT_TRUE(batch.ParseFromArray(payload, (int) size));
+
+            std::lock_guard<std::mutex> lock(_mutex);
+            _batchSizes.push_back((size_t) batch.states_size());
+            _topics.push_back(topic);
+
+            for(auto &s : batch.states()) {
+                if(_topicPerVehicle) {
+                    EXPECT_EQ("vehicles/" + std::to_string(s.id()), topic);
+                }
+
+                EXPECT_DOUBLE_EQ(s.time() * 2.0, s.velocity());
+                _times[s.id()].push_back(s.time());
+            }
+
+        });
+
+    }
+
+    static models::State state(double time) {
+
+        return models::State{0.0, time * 2.0, 0.0};
+
+    }
+
+};
+
+
+TEST_F(PublisherTest, BatchesPerTopic) {
+
+    telemetry::Publisher::Options options{};
+    options.maxBatch = 16;
+
+    telemetry::Publisher publisher(_broker, options);
+
+    // 4 threads with 10 vehicles each
+    std::vector<std::thread> threads{};
+    for(uint32_t t = 0; t < 4; ++t) {
+        threads.emplace_back([&publisher, t] {
+            for(int k = 0; k < 100; ++k) {
+                for(uint32_t id = t * 10; id < (t + 1) * 10; ++id)
+                    EXPECT_TRUE(publisher.push(id, 0.01 * k, state(0.01 * k)));
+            }
+        });
+    }
+
+    for(auto &t : threads)
+        t.join();
+
+    publisher.flush();
+
+    auto statistics = publisher.statistics();
+    EXPECT_EQ(4000, statistics.pushed);
+    EXPECT_EQ(4000, statistics.published);
+    EXPECT_EQ(0, statistics.dropped);
+    EXPECT_EQ(0, statistics.conflated);
+    EXPECT_EQ(0, statistics.failed);
+    EXPECT_GE(statistics.messages, 40 * 7);
+
+    // every state is delivered in order
+    std::lock_guard<std::mutex> lock(_mutex);
+    ASSERT_EQ(40, _times.size());
+    for(auto &e : _times) {
+        ASSERT_EQ(100, e.second.size());
+        for(int k = 0; k < 100; ++k)
+            EXPECT_DOUBLE_EQ(0.01 * k, e.second[k]);
+    }
+
+    for(auto n : _batchSizes)
+        EXPECT_LE(n, 16);
+
+}
+
+
+TEST_F(PublisherTest, Linger) {
+
+    telemetry::Publisher::Options options{};
+    options.linger = std::chrono::milliseconds(1);
+
+    telemetry::Publisher publisher(_broker, options);
+    publisher.push(7, 1.0, state(1.0));
+
+    // published without flush, although the batch is not full
+    for(int i = 0; i < 1000 && publisher.statistics().published == 0; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+    EXPECT_EQ(1, publisher.statistics().published);
+
+}
+
+
+TEST_F(PublisherTest, Backpressure) {
+
+    telemetry::Publisher::Options options{};
+    options.partitions = 1;
+    options.maxBatch = 8;
+    options.maxPending = 32;
+    options.maxInFlight = 2;
+    _topicPerVehicle = false;
+
+    // stalled connection
+    _broker.pause();
+
+    telemetry::Publisher publisher(_broker, options);
+
+    for(int k = 0; k < 1000; ++k) {
+        for(uint32_t id = 0; id < 4; ++id)
+            publisher.push(id, 0.01 * k, state(0.01 * k));
+    }
+
+    // the pushes never block, the I/O thread downsamples
+    while(publisher.statistics().conflated == 0)
+        std::this_thread::yield();
+
+    _broker.resume();
+    publisher.flush();
+
+    auto s = publisher.statistics();
+    EXPECT_EQ(4000, s.pushed);
+    EXPECT_GT(s.conflated, 0);
+    EXPECT_EQ(s.pushed, s.published + s.conflated + s.dropped);
+    EXPECT_LT(s.published, 4000);
+
+    // the latest state of each vehicle is delivered
+    std::lock_guard<std::mutex> lock(_mutex);
+    ASSERT_EQ(4, _times.size());
+    for(auto &e : _times)
+        EXPECT_DOUBLE_EQ(9.99, e.second.back());
+
+    for(auto &t : _topics)
+        EXPECT_EQ("vehicles/0", t);
+
+}
+
+
+TEST_F(PublisherTest, QueueFull) {
+
+    telemetry::Publisher::Options options{};
+    options.queueCapacity = 0;
+
+    telemetry::Publisher publisher(_broker, options);
+    EXPECT_FALSE(publisher.push(1, 0.0, state(0.0)));
+    EXPECT_EQ(1, publisher.statistics().dropped);
+    EXPECT_EQ(0, publisher.statistics().pushed);
+
+    options.maxBatch = 0;
+    EXPECT_THROW(telemetry::Publisher(_broker, options), std::invalid_argument);
+
+}
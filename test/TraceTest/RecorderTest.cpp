@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2019 Jens Klimke <jens.klimke@rwth-aachen.de>. All rights reserved.
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+// Created by agent on 18.10.2026.
+//
+
+#include <gtest/gtest.h>
+#include <trace/Reader.h>
+#include <trace/Recorder.h>
+#include <simulation/TimeServer.h>
+#include <LongitudinalModel/LongitudinalModel.h>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+class TracedVehicle : public sim::Model<double>, public models::LongitudinalModel {
+
+public:
+
+    trace::Recorder *recorder = nullptr;
+    trace::Signal velocity{};
+    trace::Signal distance{};
+
+    bool create() override {
+
+        sim::Model<double>::create();
+
+        // register signals
+        velocity = recorder->addSignal(getID() + ".v");
+        distance = recorder->addSignal(getID() + ".s");
+
+        return true;
+
+    }
+
+    void reset() override {
+
+        setState(models::State{});
+
+    }
+
+    bool step(double simTime, double timeStepSize) override {
+
+        modelStep(0.5, _timeStepSize);
+
+        velocity.record(simTime, getState().v);
+        distance.record(simTime, getState().s);
+
+        return true;
+
+    }
+
+};
+
+
+class RecorderTest : public ::testing::Test {
+
+protected:
+
+    std::string _path = "RecorderTest.trc";
+
+    void TearDown() override {
+
+        std::remove(_path.c_str());
+
+    }
+
+};
+
+
+TEST_F(RecorderTest, ThreadsAndBlocks) {
+
+    std::vector<trace::Compression> compressions{trace::Compression::NONE};
+    if(trace::Recorder::isSupported(trace::Compression::ZLIB))
+        compressions.push_back(trace::Compression::ZLIB);
+
+    for(auto compression : compressions) {
+
+        const int threads = 4;
+        const int signalsPerThread = 25;
+        const int samples = 2000;
+
+        // small rings and blocks to cover stalls and several chunks per signal
+        trace::Recorder::Options options{};
+        options.ringCapacity = 256;
+        options.blockSamples = 10000;
+        options.compression = compression;
+
+        {
+            trace::Recorder recorder(_path, options);
+
+            std::vector<trace::Signal> signals{};
+            for(int i = 0; i < threads * signalsPerThread; ++i)
+                signals.push_back(recorder.addSignal("signal-" + std::to_string(i)));
+
+            std::vector<std::thread> workers{};
+            for(int t = 0; t < threads; ++t) {
+                workers.emplace_back([&signals, t] {
+                    for(int k = 0; k < samples; ++k) {
+                        for(int i = t * signalsPerThread; i < (t + 1) * signalsPerThread; ++i)
+                            signals[i].record(0.001 * k, 1000.0 * i + k);
+                    }
+                });
+            }
+
+            for(auto &w : workers)
+                w.join();
+
+            recorder.close();
+
+            EXPECT_EQ(100, recorder.signals());
+            EXPECT_EQ(threads * signalsPerThread * samples, recorder.written());
+            EXPECT_THROW(signals[0].record(1.0, 1.0), std::logic_error);
+            EXPECT_THROW(recorder.addSignal("late"), std::logic_error);
+
+        }
+
+        trace::Reader reader(_path);
+        ASSERT_EQ(100, reader.size());
+
+        std::vector<double> times{}, values{};
+        for(uint32_t i = 0; i < 100; ++i) {
+
+            EXPECT_EQ(i, reader.find("signal-" + std::to_string(i)));
+            EXPECT_EQ(samples, reader.samples(i));
+
+            reader.read(i, times, values);
+            ASSERT_EQ(samples, times.size());
+
+            for(int k = 0; k < samples; ++k) {
+                EXPECT_DOUBLE_EQ(0.001 * k, times[k]);
+                EXPECT_DOUBLE_EQ(1000.0 * i + k, values[k]);
+            }
+
+        }
+
+        // signals are split into several chunks
+        size_t chunks = 0;
+        reader.forEachChunk(42, [&chunks](const double *, const double *, size_t n) { chunks++; });
+        EXPECT_GT(chunks, 1);
+
+    }
+
+}
+
+
+TEST_F(RecorderTest, Models) {
+
+    {
+        trace::Recorder recorder(_path);
+        sim::TimeServer server{};
+
+        std::vector<std::unique_ptr<TracedVehicle>> vehicles{};
+        for(int i = 0; i < 3; ++i) {
+
+            vehicles.emplace_back(new TracedVehicle);
+            auto &v = vehicles.back();
+
+            v->setIDAndName("vehicle" + std::to_string(i), "Vehicle");
+            v->recorder = &recorder;
+            v->create();
+            v->setTimeStepSize(0.01 * (i + 1));
+            v->initialize(0.0);
+
+            server.registerModel(v.get());
+
+        }
+
+        for(int k = 0; k <= 100; ++k)
+            server.step(0.01 * k);
+
+    }
+
+    // the recorder is closed by the destructor
+    trace::Reader reader(_path);
+    EXPECT_EQ(6, reader.size());
+    EXPECT_EQ("vehicle1.v", reader.name(2));
+    EXPECT_EQ(101, reader.samples(reader.find("vehicle0.v")));
+    EXPECT_EQ(51, reader.samples(reader.find("vehicle1.s")));
+    EXPECT_EQ(34, reader.samples(reader.find("vehicle2.s")));
+
+    std::vector<double> times{}, values{};
+    reader.read(reader.find("vehicle0.v"), times, values);
+    EXPECT_DOUBLE_EQ(1.0, times.back());
+    EXPECT_GT(values.back(), values.front());
+
+}
+
+
+TEST_F(RecorderTest, Errors) {
+
+    trace::Recorder::Options options{};
+    options.blockSamples = 0;
+    EXPECT_THROW(trace::Recorder(_path, options), std::invalid_argument);
+
+    options = trace::Recorder::Options{};
+    options.ringCapacity = 3;
+    EXPECT_THROW(trace::Recorder(_path, options), std::invalid_argument);
+
+    {
+        trace::Recorder recorder(_path);
+        EXPECT_THROW(recorder.record(0, 0.0, 0.0), std::out_of_range);
+
+        recorder.addSignal("a");
+        EXPECT_NO_THROW(recorder.record(0, 0.0, 0.0));
+
+        // not closed yet
+        EXPECT_THROW(trace::Reader reader(_path), std::runtime_error);
+    }
+
+    trace::Reader reader(_path);
+    EXPECT_THROW(reader.find("b"), std::out_of_range);
+    EXPECT_THROW(reader.samples(1), std::out_of_range);
+
+    // not a trace file
+    std::ofstream(_path) << "something else, which is long enough";
+    EXPECT_THROW(trace::Reader reader(_path), std::runtime_error);
+
+}
+
+
+TEST_F(RecorderTest, FailedBackgroundThread) {
+
+    // writing to the full device fails, when the first block is flushed
+    if(!std::ifstream("/dev/full"))
+        return;
+
+    trace::Recorder::Options options{};
+    options.ringCapacity = 4;
+    options.blockSamples = 1;
+
+    trace::Recorder recorder("/dev/full", options);
+    auto signal = recorder.addSignal("a");
+
+    // the samples are dropped instead of waiting for the failed thread
+    for(int i = 0; i < 100000; ++i)
+        signal.record(i, i);
+
+    EXPECT_GT(recorder.dropped(), 0);
+    EXPECT_THROW(recorder.close(), std::runtime_error);
+
+}